@@ -0,0 +1,132 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_STATICARRAY_HPP_
+#define AXOM_STATICARRAY_HPP_
+
+#include "axom/config.hpp"           // for compile-time defines
+#include "axom/core/Macros.hpp"      // for axom macros
+#include "axom/core/StackArray.hpp"  // for StackArray
+
+// C/C++ includes
+#include <cassert>  // for assert()
+
+namespace axom
+{
+/*!
+ * \accelerated
+ * \class StaticArray
+ *
+ * \brief Provides a variable-size array with a compile time capacity, stored
+ *  in a StackArray. Unlike axom::Array, it never allocates memory and may be
+ *  copied into and used within device kernels.
+ *
+ * \tparam T the type of the values to hold.
+ * \tparam N the maximum number of values in the array.
+ */
+template <typename T, int N>
+class StaticArray : public StackArray<T, N>
+{
+public:
+  /// Returns the maximum number of values in the array
+  AXOM_HOST_DEVICE static constexpr int capacity() { return N; }
+
+  /// Returns the number of values in the array
+  AXOM_HOST_DEVICE int size() const { return m_size; }
+
+  /// Returns true if the array holds no values
+  AXOM_HOST_DEVICE bool empty() const { return m_size == 0; }
+
+  /*!
+   * \brief Sets the number of values in the array.
+   *
+   * \param [in] size the new number of values.
+   * \note The values that are added are default-initialized.
+   * \pre 0 <= size <= N
+   */
+  AXOM_HOST_DEVICE void resize(int size)
+  {
+    assert(size >= 0 && size <= N);
+    m_size = size;
+  }
+
+  /*!
+   * \brief Appends a value to the end of the array.
+   *
+   * \param [in] value the value to append.
+   * \pre size() < N
+   */
+  AXOM_HOST_DEVICE void push_back(const T& value)
+  {
+    assert(m_size < N);
+    this->m_data[m_size++] = value;
+  }
+
+  /// Removes all the values from the array
+  AXOM_HOST_DEVICE void clear() { m_size = 0; }
+
+  /// Returns a pointer to the values of the array
+  /// @{
+  AXOM_HOST_DEVICE T* data() noexcept { return &this->m_data[0]; }
+  AXOM_HOST_DEVICE const T* data() const noexcept { return &this->m_data[0]; }
+  /// @}
+
+  /*!
+   * \brief Begin/end iterators over the values of the array
+   */
+  /// @{
+  AXOM_HOST_DEVICE T* end() noexcept { return &this->m_data[0] + m_size; }
+  AXOM_HOST_DEVICE const T* end() const noexcept
+  {
+    return &this->m_data[0] + m_size;
+  }
+  /// @}
+
+private:
+  int m_size {0};
+};
+
+/*!
+ * \brief Equality comparison operator for StaticArray
+ *
+ * \param [in] lhs left StaticArray to compare
+ * \param [in] rhs right StaticArray to compare
+ * \return true if the StaticArrays have the same size and element values
+ */
+template <typename T, int N>
+AXOM_HOST_DEVICE bool operator==(const StaticArray<T, N>& lhs,
+                                 const StaticArray<T, N>& rhs)
+{
+  if(lhs.size() != rhs.size())
+  {
+    return false;
+  }
+  for(int i = 0; i < lhs.size(); ++i)
+  {
+    if(lhs[i] != rhs[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!
+ * \brief Inequality comparison operator for StaticArray
+ *
+ * \param [in] lhs left StaticArray to compare
+ * \param [in] rhs right StaticArray to compare
+ * \return true if the StaticArrays have different sizes or element values
+ */
+template <typename T, int N>
+AXOM_HOST_DEVICE bool operator!=(const StaticArray<T, N>& lhs,
+                                 const StaticArray<T, N>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+} /* namespace axom */
+
+#endif /* AXOM_STATICARRAY_HPP_ */
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/StaticArray.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/memory_management.hpp"
+#include "gtest/gtest.h"
+#include <string>
+
+TEST(core_static_array, size_and_capacity)
+{
+  constexpr int N = 10;
+  axom::StaticArray<int, N> arr;
+  EXPECT_EQ(arr.capacity(), N);
+  EXPECT_EQ(arr.size(), 0);
+  EXPECT_TRUE(arr.empty());
+  EXPECT_EQ(arr.begin(), arr.end());
+
+  for(int i = 0; i < N; ++i)
+  {
+    arr.push_back(i * i);
+    EXPECT_EQ(arr.size(), i + 1);
+    EXPECT_EQ(arr[i], i * i);
+  }
+  EXPECT_FALSE(arr.empty());
+  EXPECT_EQ(arr.end() - arr.begin(), N);
+  EXPECT_EQ(arr.data(), &arr[0]);
+
+  // resizing keeps the leading values
+  arr.resize(3);
+  EXPECT_EQ(arr.size(), 3);
+  EXPECT_EQ(arr.end() - arr.begin(), 3);
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(arr[i], i * i);
+  }
+
+  arr.clear();
+  EXPECT_EQ(arr.size(), 0);
+  EXPECT_TRUE(arr.empty());
+}
+
+TEST(core_static_array, copy_and_compare)
+{
+  constexpr int N = 5;
+  axom::StaticArray<std::string, N> arr;
+  for(int i = 0; i < 3; ++i)
+  {
+    arr.push_back(std::to_string(i));
+  }
+
+  axom::StaticArray<std::string, N> copy(arr);
+  EXPECT_EQ(copy.size(), arr.size());
+  EXPECT_NE(copy.data(), arr.data());
+  EXPECT_EQ(copy, arr);
+
+  // arrays with different sizes differ, regardless of unused values
+  copy.push_back("3");
+  EXPECT_NE(copy, arr);
+  copy.resize(3);
+  EXPECT_EQ(copy, arr);
+
+  copy[1] = "one";
+  EXPECT_NE(copy, arr);
+}
+
+TEST(core_static_array, for_all)
+{
+  constexpr int N = 4;
+  constexpr int NUM_ARRAYS = 16;
+  using ArrayType = axom::StaticArray<int, N>;
+
+  // Arrays of different sizes are filled and summed in a kernel
+  int* sums = axom::allocate<int>(NUM_ARRAYS);
+  axom::for_all<axom::SEQ_EXEC>(
+    NUM_ARRAYS,
+    AXOM_LAMBDA(axom::IndexType i) {
+      ArrayType arr;
+      for(int j = 0; j < i % (N + 1); ++j)
+      {
+        arr.push_back(j + 1);
+      }
+
+      int sum = 0;
+      for(const int value : arr)
+      {
+        sum += value;
+      }
+      sums[i] = sum;
+    });
+
+  for(int i = 0; i < NUM_ARRAYS; ++i)
+  {
+    const int n = i % (N + 1);
+    EXPECT_EQ(sums[i], n * (n + 1) / 2);
+  }
+  axom::deallocate(sums);
+}
@@ -38,29 +38,5 @@ void processAbort()
 #endif
 }
 
-int binomialCoefficient(int n, int k)
-{
-  if(k > n || k < 0)  // check if out-of-bounds
-  {
-    return 0;
-  }
-  if(k == n || k == 0)  // early return
-  {
-    return 1;
-  }
-  if(k > n - k)  // exploit symmetry to reduce work
-  {
-    k = n - k;
-  }
-
-  int val = 1;
-  for(int i = 1; i <= k; ++i)
-  {
-    val *= (n - k + i);
-    val /= i;
-  }
-  return val;
-}
-
 }  // end namespace utilities
 }  // end namespace axom
@@ -178,7 +178,29 @@ inline AXOM_HOST_DEVICE T clampLower(T val, T lower)
  * \return \f$ {n\choose k}  = n! / (k! * (n-k)!)\f$
  * when \f$ n \ge k \ge 0 \f$, 0 otherwise.
  */
-int binomialCoefficient(int n, int k);
+inline AXOM_HOST_DEVICE int binomialCoefficient(int n, int k)
+{
+  if(k > n || k < 0)  // check if out-of-bounds
+  {
+    return 0;
+  }
+  if(k == n || k == 0)  // early return
+  {
+    return 1;
+  }
+  if(k > n - k)  // exploit symmetry to reduce work
+  {
+    k = n - k;
+  }
+
+  int val = 1;
+  for(int i = 1; i <= k; ++i)
+  {
+    val *= (n - k + i);
+    val /= i;
+  }
+  return val;
+}
 
 /*!
  * \brief Returns a random real number within the specified interval
@@ -55,9 +55,19 @@ void BinaryTreeCommunicator::initialize(MPI_Comm comm, int ranksLimit)
   {
     m_rightChildRank = -1;
   }
+
+  std::vector<int> childRanks;
+  for(int childRank : {m_leftChildRank, m_rightChildRank})
+  {
+    if(childRank != -1)
+    {
+      childRanks.push_back(childRank);
+    }
+  }
+  m_nonBlockingPushes.initialize(m_mpiComm, m_parentRank, childRanks);
 }
 
-void BinaryTreeCommunicator::finalize() { }
+void BinaryTreeCommunicator::finalize() { m_nonBlockingPushes.finalize(); }
 
 int BinaryTreeCommunicator::rank() { return m_mpiCommRank; }
 
@@ -105,6 +115,26 @@ void BinaryTreeCommunicator::push(const char* packedMessagesToBeSent,
   MPI_Barrier(m_mpiComm);
 }
 
+bool BinaryTreeCommunicator::isNonBlockingPushSupported() { return true; }
+
+void BinaryTreeCommunicator::pushNonBlocking(const char* packedMessagesToBeSent)
+{
+  m_nonBlockingPushes.push(packedMessagesToBeSent);
+}
+
+bool BinaryTreeCommunicator::testPushes(
+  std::vector<const char*>& receivedPackedMessages)
+{
+  return m_nonBlockingPushes.test(receivedPackedMessages);
+}
+
+bool BinaryTreeCommunicator::childrenFinished()
+{
+  return m_nonBlockingPushes.childrenFinished();
+}
+
+void BinaryTreeCommunicator::finishPushes() { m_nonBlockingPushes.finish(); }
+
 bool BinaryTreeCommunicator::isOutputNode()
 {
   if(m_mpiCommRank == 0)
@@ -17,6 +17,7 @@
 #include "mpi.h"
 
 #include "axom/lumberjack/Communicator.hpp"
+#include "axom/lumberjack/MPIUtility.hpp"
 
 namespace axom
 {
@@ -123,6 +124,55 @@ public:
   void push(const char* packedMessagesToBeSent,
             std::vector<const char*>& receivedPackedMessages);
 
+  /*!
+   *****************************************************************************
+   * \brief Returns true, since this Communicator supports non-blocking
+   *  pushes.
+   *****************************************************************************
+   */
+  bool isNonBlockingPushSupported();
+
+  /*!
+   *****************************************************************************
+   * \brief Starts sending the given packed messages to its parent without
+   *  waiting, and takes ownership of the buffer.
+   *
+   * \param [in] packedMessagesToBeSent All of this rank's Message classes
+   *  packed into a single buffer.
+   *****************************************************************************
+   */
+  void pushNonBlocking(const char* packedMessagesToBeSent);
+
+  /*!
+   *****************************************************************************
+   * \brief Completes the sends and receives of non-blocking pushes that have
+   *  arrived, without waiting. The receives from this node's children are
+   *  posted ahead of time.
+   *
+   * \param [in,out] receivedPackedMessages Received packed message buffers from
+   *  this node's children.
+   *
+   * \return Whether all buffers pushed by this rank have been sent
+   *****************************************************************************
+   */
+  bool testPushes(std::vector<const char*>& receivedPackedMessages);
+
+  /*!
+   *****************************************************************************
+   * \brief Returns whether both children of this node have called
+   *  finishPushes().
+   *****************************************************************************
+   */
+  bool childrenFinished();
+
+  /*!
+   *****************************************************************************
+   * \brief Waits for the non-blocking pushes of this rank to be sent, then
+   *  signals its parent that this rank has finished pushing.
+   *****************************************************************************
+   */
+  void finishPushes();
+
   /*!
    *****************************************************************************
    * \brief Function used by the Lumberjack to indicate whether this node should
@@ -143,6 +193,7 @@ private:
   int m_leftChildRank;
   int m_rightChildRank;
   int m_childCount;
+  MPINonBlockingPushes m_nonBlockingPushes;
 };
 
 }  // end namespace lumberjack
@@ -17,6 +17,8 @@
 
 #include "axom/lumberjack/Message.hpp"
 
+#include <cstddef>
+
 namespace axom
 {
 namespace lumberjack
@@ -63,6 +65,31 @@ public:
   virtual bool shouldMessagesBeCombined(const Message& leftMessage,
                                         const Message& rightMessage) = 0;
 
+  /*!
+   *****************************************************************************
+   * \brief Returns whether this Combiner implements hash().
+   *
+   * When every Combiner held by Lumberjack has a hash, Message classes are
+   * combined by looking up Message classes with equal hashes instead of
+   * comparing each Message against every other one. Default is false.
+   *****************************************************************************
+   */
+  virtual bool hasHash() { return false; }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns a hash of the parts of the Message that determine whether
+   *  it is combined.
+   *
+   * Two Message classes for which shouldMessagesBeCombined() returns true
+   * must have equal hashes, and combine() must not change the hash of the
+   * combined Message. Only called if hasHash() returns true.
+   *
+   * \param [in] message The Message to be hashed.
+   *****************************************************************************
+   */
+  virtual std::size_t hash(const Message& /* message */) { return 0; }
+
   /*!
    *****************************************************************************
    * \brief Combines the combinee into the combined Message.
@@ -133,6 +133,66 @@ public:
   virtual void push(const char* packedMessagesToBeSent,
                     std::vector<const char*>& receivedPackedMessages) = 0;
 
+  /*!
+   *****************************************************************************
+   * \brief Returns whether this Communicator implements the non-blocking
+   *  pushes: pushNonBlocking(), testPushes(), childrenFinished() and
+   *  finishPushes().
+   *
+   * These are only called by Lumberjack when this returns true.
+   *****************************************************************************
+   */
+  virtual bool isNonBlockingPushSupported() { return false; }
+
+  /*!
+   *****************************************************************************
+   * \brief Starts sending the given packed messages to this node's parent and
+   *  returns without waiting for the parent.
+   *
+   * \param [in] packedMessagesToBeSent All of this rank's Message classes
+   *  packed into a single buffer. Unless the buffer is empty, the
+   *  Communicator takes ownership of it and deletes it once it has been sent.
+   *
+   * Unlike push(), this is not a collective operation.
+   *****************************************************************************
+   */
+  virtual void pushNonBlocking(const char* /* packedMessagesToBeSent */) { }
+
+  /*!
+   *****************************************************************************
+   * \brief Makes progress on the non-blocking pushes without waiting.
+   *
+   * \param [in,out] receivedPackedMessages Packed message buffers that have
+   *  been received from this node's children since the last call.
+   *
+   * \return Whether all buffers given to pushNonBlocking() have been sent
+   *****************************************************************************
+   */
+  virtual bool testPushes(
+    std::vector<const char*>& /* receivedPackedMessages */)
+  {
+    return true;
+  }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns whether all children of this node have called
+   *  finishPushes(), as observed by testPushes().
+   *****************************************************************************
+   */
+  virtual bool childrenFinished() { return true; }
+
+  /*!
+   *****************************************************************************
+   * \brief Waits until all buffers given to pushNonBlocking() have been sent,
+   *  then signals this node's parent that this node has finished pushing.
+   *
+   * Called once childrenFinished() is true, and after the Message classes
+   * received from the children have been pushed on.
+   *****************************************************************************
+   */
+  virtual void finishPushes() { }
+
   /*!
    *****************************************************************************
    * \brief Function indicates whether this node should be outputting messages.
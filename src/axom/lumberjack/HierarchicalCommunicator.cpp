@@ -0,0 +1,202 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ ******************************************************************************
+ *
+ * \file HierarchicalCommunicator.cpp
+ *
+ * \brief Implementation of the HierarchicalCommunicator class.
+ *
+ ******************************************************************************
+ */
+
+#include "axom/lumberjack/HierarchicalCommunicator.hpp"
+
+#include "mpi.h"
+
+#include "axom/lumberjack/MPIUtility.hpp"
+#include "axom/lumberjack/Message.hpp"
+
+#include <algorithm>
+
+namespace axom
+{
+namespace lumberjack
+{
+HierarchicalCommunicator::HierarchicalCommunicator(int fanIn)
+  : m_fanIn(std::max(fanIn, 1))
+{ }
+
+void HierarchicalCommunicator::initialize(MPI_Comm comm, int ranksLimit)
+{
+  int commRank = 0;
+  MPI_Comm_rank(comm, &commRank);
+
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(comm,
+                      MPI_COMM_TYPE_SHARED,
+                      commRank,
+                      MPI_INFO_NULL,
+                      &nodeComm);
+  initialize(comm, nodeComm, ranksLimit);
+  MPI_Comm_free(&nodeComm);
+}
+
+void HierarchicalCommunicator::initialize(MPI_Comm comm,
+                                          MPI_Comm nodeComm,
+                                          int ranksLimit)
+{
+  m_mpiComm = comm;
+  MPI_Comm_rank(m_mpiComm, &m_mpiCommRank);
+  MPI_Comm_size(m_mpiComm, &m_mpiCommSize);
+  m_ranksLimit = ranksLimit;
+  m_childRanks.clear();
+
+  // The leader of a node is its lowest rank in comm
+  int nodeSize = 0;
+  MPI_Comm_size(nodeComm, &nodeSize);
+  std::vector<int> nodeRanks(nodeSize);
+  MPI_Allgather(&m_mpiCommRank,
+                1,
+                MPI_INT,
+                nodeRanks.data(),
+                1,
+                MPI_INT,
+                nodeComm);
+  std::sort(nodeRanks.begin(), nodeRanks.end());
+  m_isNodeLeader = (nodeRanks[0] == m_mpiCommRank);
+
+  // Only the leaders communicate between nodes, ordered by their rank so that
+  // rank 0 is the root of the tree
+  MPI_Comm leaderComm;
+  MPI_Comm_split(m_mpiComm,
+                 m_isNodeLeader ? 0 : MPI_UNDEFINED,
+                 m_mpiCommRank,
+                 &leaderComm);
+
+  if(m_isNodeLeader)
+  {
+    int leaderIndex = 0;
+    int leaderCount = 0;
+    MPI_Comm_rank(leaderComm, &leaderIndex);
+    MPI_Comm_size(leaderComm, &leaderCount);
+    std::vector<int> leaderRanks(leaderCount);
+    MPI_Allgather(&m_mpiCommRank,
+                  1,
+                  MPI_INT,
+                  leaderRanks.data(),
+                  1,
+                  MPI_INT,
+                  leaderComm);
+    MPI_Comm_free(&leaderComm);
+
+    m_parentRank =
+      (leaderIndex == 0) ? -1 : leaderRanks[(leaderIndex - 1) / m_fanIn];
+    m_childRanks.assign(nodeRanks.begin() + 1, nodeRanks.end());
+    for(int i = 1; i <= m_fanIn; ++i)
+    {
+      const int childIndex = leaderIndex * m_fanIn + i;
+      if(childIndex >= leaderCount)
+      {
+        break;
+      }
+      m_childRanks.push_back(leaderRanks[childIndex]);
+    }
+  }
+  else
+  {
+    m_parentRank = nodeRanks[0];
+  }
+
+  // Every rank computes the same height of the tree of leaders, which is the
+  // depth of the last leader
+  int leaderFlag = m_isNodeLeader ? 1 : 0;
+  int leaderCount = 0;
+  MPI_Allreduce(&leaderFlag, &leaderCount, 1, MPI_INT, MPI_SUM, m_mpiComm);
+  int maxNodeSize = 0;
+  MPI_Allreduce(&nodeSize, &maxNodeSize, 1, MPI_INT, MPI_MAX, m_mpiComm);
+
+  m_numPushesToFlush = (maxNodeSize > 1) ? 1 : 0;
+  for(int i = leaderCount - 1; i > 0; i = (i - 1) / m_fanIn)
+  {
+    ++m_numPushesToFlush;
+  }
+
+  m_nonBlockingPushes.initialize(m_mpiComm, m_parentRank, m_childRanks);
+}
+
+void HierarchicalCommunicator::finalize() { m_nonBlockingPushes.finalize(); }
+
+int HierarchicalCommunicator::rank() { return m_mpiCommRank; }
+
+void HierarchicalCommunicator::ranksLimit(int value) { m_ranksLimit = value; }
+
+int HierarchicalCommunicator::ranksLimit() { return m_ranksLimit; }
+
+int HierarchicalCommunicator::numPushesToFlush() { return m_numPushesToFlush; }
+
+void HierarchicalCommunicator::push(
+  const char* packedMessagesToBeSent,
+  std::vector<const char*>& receivedPackedMessages)
+{
+  MPI_Barrier(m_mpiComm);
+  if(m_parentRank != -1)
+  {
+    if(isPackedMessagesEmpty(packedMessagesToBeSent))
+    {
+      mpiNonBlockingSendMessages(m_mpiComm, m_parentRank, zeroMessage);
+    }
+    else
+    {
+      mpiNonBlockingSendMessages(m_mpiComm,
+                                 m_parentRank,
+                                 packedMessagesToBeSent);
+    }
+  }
+
+  const int childCount = static_cast<int>(m_childRanks.size());
+  for(int childrenDoneCount = 0; childrenDoneCount < childCount;
+      ++childrenDoneCount)
+  {
+    const char* currPackedMessages = mpiBlockingReceiveMessages(m_mpiComm);
+    if(isPackedMessagesEmpty(currPackedMessages))
+    {
+      delete[] currPackedMessages;
+    }
+    else
+    {
+      receivedPackedMessages.push_back(currPackedMessages);
+    }
+  }
+
+  MPI_Barrier(m_mpiComm);
+}
+
+bool HierarchicalCommunicator::isNonBlockingPushSupported() { return true; }
+
+void HierarchicalCommunicator::pushNonBlocking(
+  const char* packedMessagesToBeSent)
+{
+  m_nonBlockingPushes.push(packedMessagesToBeSent);
+}
+
+bool HierarchicalCommunicator::testPushes(
+  std::vector<const char*>& receivedPackedMessages)
+{
+  return m_nonBlockingPushes.test(receivedPackedMessages);
+}
+
+bool HierarchicalCommunicator::childrenFinished()
+{
+  return m_nonBlockingPushes.childrenFinished();
+}
+
+void HierarchicalCommunicator::finishPushes() { m_nonBlockingPushes.finish(); }
+
+bool HierarchicalCommunicator::isOutputNode() { return m_parentRank == -1; }
+
+}  // end namespace lumberjack
+}  // end namespace axom
@@ -0,0 +1,258 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ *******************************************************************************
+ * \file HierarchicalCommunicator.hpp
+ *
+ * \brief This file contains the class definition of the
+ *  HierarchicalCommunicator.
+ *******************************************************************************
+ */
+
+#ifndef HIERARCHICALCOMMUNICATOR_HPP
+#define HIERARCHICALCOMMUNICATOR_HPP
+
+#include "mpi.h"
+
+#include "axom/lumberjack/Communicator.hpp"
+#include "axom/lumberjack/MPIUtility.hpp"
+
+#include <vector>
+
+namespace axom
+{
+namespace lumberjack
+{
+/*!
+ *******************************************************************************
+ * \class HierarchicalCommunicator
+ *
+ * \brief A Communicator that first gathers Message classes within each
+ *  shared-memory node, then passes them through a tree of node leaders.
+ *
+ *  The ranks sharing a node, as given by MPI_Comm_split_type, send their
+ *  Message classes to the lowest rank on the node, its leader. The leaders
+ *  form a tree with a configurable fan-in, rooted at rank 0, which is the only
+ *  node allowed to output messages. Messages only cross the network between
+ *  leaders, so the number of Messages received by the root scales with the
+ *  number of nodes instead of the number of ranks.
+ *
+ *  You will need to add your Communicator using Lumberjack::initialize.
+ *
+ * \see Communicator Lumberjack
+ *******************************************************************************
+ */
+class HierarchicalCommunicator : public Communicator
+{
+public:
+  /*!
+   *****************************************************************************
+   * \brief Constructs the Communicator.
+   *
+   * \param [in] fanIn Maximum number of leaders that push to each leader in the
+   *  tree of node leaders. Values below 1 are treated as 1.
+   *****************************************************************************
+   */
+  explicit HierarchicalCommunicator(int fanIn = 8);
+
+  /*!
+   *****************************************************************************
+   * \brief Called to initialize the Communicator.
+   *
+   * This performs any setup work the Communicator needs before doing any work.
+   * It is required that this is called before using the Communicator. The
+   * ranks are grouped by shared-memory node.
+   *
+   * \param [in] comm The MPI Communicator
+   * \param [in] ranksLimit Limit on how many ranks are individually tracked per
+   *  Message.
+   *****************************************************************************
+   */
+  void initialize(MPI_Comm comm, int ranksLimit);
+
+  /*!
+   *****************************************************************************
+   * \brief Called to initialize the Communicator with the given grouping of
+   *  ranks instead of the shared-memory nodes.
+   *
+   * \param [in] comm The MPI Communicator
+   * \param [in] nodeComm A communicator containing this rank and the other
+   *  ranks of comm in its group, such as the result of MPI_Comm_split.
+   * \param [in] ranksLimit Limit on how many ranks are individually tracked per
+   *  Message.
+   *
+   * \note This is a collective operation on comm.
+   *****************************************************************************
+   */
+  void initialize(MPI_Comm comm, MPI_Comm nodeComm, int ranksLimit);
+
+  /*!
+   *****************************************************************************
+   * \brief Called to finalize the Communicator.
+   *
+   * This performs any cleanup work the Communicator needs to do before going
+   * away. It is required that this is the last function called by the
+   * Communicator.
+   *****************************************************************************
+   */
+  void finalize();
+
+  /*!
+   *****************************************************************************
+   * \brief Returns the MPI rank of this node
+   *****************************************************************************
+   */
+  int rank();
+
+  /*!
+   *****************************************************************************
+   * \brief Sets the rank limit.
+   *
+   * This is the limit on how many ranks generated a given message are
+   * individually tracked per Message.  After the limit has been reached, only
+   * the Message::rankCount is incremented.
+   *
+   * \param [in] value limits how many ranks are tracked per Message.
+   *****************************************************************************
+   */
+  void ranksLimit(int value);
+
+  /*!
+   *****************************************************************************
+   * \brief Returns the rank limit.
+   *
+   * This is the limit on how many ranks generated a given message are
+   * individually tracked per Message.  After the limit has been reached, only
+   * the Message::rankCount is incremented.
+   *****************************************************************************
+   */
+  int ranksLimit();
+
+  /*!
+   *****************************************************************************
+   * \brief Function used by the Lumberjack class to indicate how many
+   *  individual pushes fully flush all currently held Message classes to the
+   *  root node. This is one push within the nodes, if any node has more than
+   *  one rank, plus the height of the tree of node leaders.
+   *****************************************************************************
+   */
+  int numPushesToFlush();
+
+  /*!
+   *****************************************************************************
+   * \brief All children push their Message classes to their parent and then
+   *  they are combined.
+   *
+   * \param [in] packedMessagesToBeSent All of this rank's Message classes
+   *  packed into a single buffer.
+   * \param [in,out] receivedPackedMessages Received packed message buffers from
+   *  this nodes children.
+   *
+   * The children of a leader are the other ranks on its node and the leaders
+   * below it in the tree. This does not guarantee your Message will be ready to
+   * output.
+   *****************************************************************************
+   */
+  void push(const char* packedMessagesToBeSent,
+            std::vector<const char*>& receivedPackedMessages);
+
+  /*!
+   *****************************************************************************
+   * \brief Returns true, since this Communicator supports non-blocking
+   *  pushes.
+   *****************************************************************************
+   */
+  bool isNonBlockingPushSupported();
+
+  /*!
+   *****************************************************************************
+   * \brief Starts sending the given packed messages to this node's parent
+   *  without waiting, and takes ownership of the buffer.
+   *
+   * \param [in] packedMessagesToBeSent All of this rank's Message classes
+   *  packed into a single buffer.
+   *****************************************************************************
+   */
+  void pushNonBlocking(const char* packedMessagesToBeSent);
+
+  /*!
+   *****************************************************************************
+   * \brief Completes the sends and receives of non-blocking pushes that have
+   *  arrived, without waiting. The receives from this node's children are
+   *  posted ahead of time.
+   *
+   * \param [in,out] receivedPackedMessages Received packed message buffers from
+   *  this node's children.
+   *
+   * \return Whether all buffers pushed by this rank have been sent
+   *****************************************************************************
+   */
+  bool testPushes(std::vector<const char*>& receivedPackedMessages);
+
+  /*!
+   *****************************************************************************
+   * \brief Returns whether all children of this node have called
+   *  finishPushes().
+   *****************************************************************************
+   */
+  bool childrenFinished();
+
+  /*!
+   *****************************************************************************
+   * \brief Waits for the non-blocking pushes of this rank to be sent, then
+   *  signals its parent that this rank has finished pushing.
+   *****************************************************************************
+   */
+  void finishPushes();
+
+  /*!
+   *****************************************************************************
+   * \brief Function used by the Lumberjack to indicate whether this node should
+   *  be outputting messages. Only the root node outputs messages.
+   *
+   * \return Boolean indicates whether you should output messages
+   *****************************************************************************
+   */
+  bool isOutputNode();
+
+  /*!
+   *****************************************************************************
+   * \brief Returns whether this rank is the leader of its node.
+   *****************************************************************************
+   */
+  bool isNodeLeader() const { return m_isNodeLeader; }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns the rank this rank pushes to, or -1 for the root node.
+   *****************************************************************************
+   */
+  int parentRank() const { return m_parentRank; }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns the ranks that push to this rank.
+   *****************************************************************************
+   */
+  const std::vector<int>& childRanks() const { return m_childRanks; }
+
+private:
+  MPI_Comm m_mpiComm;
+  int m_mpiCommRank;
+  int m_mpiCommSize;
+  int m_ranksLimit;
+  int m_fanIn;
+  int m_numPushesToFlush;
+  bool m_isNodeLeader;
+  int m_parentRank;
+  std::vector<int> m_childRanks;
+  MPINonBlockingPushes m_nonBlockingPushes;
+};
+
+}  // end namespace lumberjack
+}  // end namespace axom
+
+#endif
@@ -15,6 +15,9 @@
 
 #include "axom/lumberjack/Lumberjack.hpp"
 
+#include <cstddef>
+#include <unordered_map>
+
 namespace axom
 {
 namespace lumberjack
@@ -177,8 +180,96 @@ void Lumberjack::pushMessagesFully()
   combineMessages();
 }
 
+void Lumberjack::pushMessagesNonBlocking()
+{
+  if(!m_communicator->isNonBlockingPushSupported())
+  {
+    pushMessagesOnce();
+    return;
+  }
+
+  if(!m_communicator->isOutputNode())
+  {
+    combineMessages();
+    const char* packedMessagesToBeSent = packMessages(m_messages);
+    clearMessages();
+    m_communicator->pushNonBlocking(packedMessagesToBeSent);
+  }
+  progressMessages();
+}
+
+bool Lumberjack::progressMessages()
+{
+  if(!m_communicator->isNonBlockingPushSupported())
+  {
+    return true;
+  }
+
+  std::vector<const char*> receivedPackedMessages;
+  const bool isSent = m_communicator->testPushes(receivedPackedMessages);
+
+  // Forwarding received messages starts a new send
+  const bool isForwarding =
+    !receivedPackedMessages.empty() && !m_communicator->isOutputNode();
+  forwardReceivedMessages(receivedPackedMessages);
+
+  return isSent && !isForwarding;
+}
+
+void Lumberjack::finishPushingMessages()
+{
+  if(!m_communicator->isNonBlockingPushSupported())
+  {
+    pushMessagesFully();
+    return;
+  }
+
+  if(!m_communicator->isOutputNode())
+  {
+    combineMessages();
+    const char* packedMessagesToBeSent = packMessages(m_messages);
+    clearMessages();
+    m_communicator->pushNonBlocking(packedMessagesToBeSent);
+  }
+
+  std::vector<const char*> receivedPackedMessages;
+  bool childrenFinished = false;
+  while(!childrenFinished)
+  {
+    m_communicator->testPushes(receivedPackedMessages);
+    childrenFinished = m_communicator->childrenFinished();
+    forwardReceivedMessages(receivedPackedMessages);
+  }
+  m_communicator->finishPushes();
+
+  combineMessages();
+}
+
 bool Lumberjack::isOutputNode() { return m_communicator->isOutputNode(); }
 
+void Lumberjack::forwardReceivedMessages(
+  std::vector<const char*>& receivedPackedMessages)
+{
+  if(receivedPackedMessages.empty())
+  {
+    return;
+  }
+
+  for(int i = 0; i < (int)receivedPackedMessages.size(); ++i)
+  {
+    unpackMessages(m_messages, receivedPackedMessages[i], m_ranksLimit);
+    delete[] receivedPackedMessages[i];
+  }
+  receivedPackedMessages.clear();
+
+  combineMessages();
+  if(!m_communicator->isOutputNode())
+  {
+    m_communicator->pushNonBlocking(packMessages(m_messages));
+    clearMessages();
+  }
+}
+
 void Lumberjack::combineMessages()
 {
   int messagesSize = (int)m_messages.size();
@@ -187,9 +278,24 @@ void Lumberjack::combineMessages()
     return;
   }
 
+  int combinersSize = (int)m_combiners.size();
+  bool allCombinersHash = true;
+  for(int combinerIndex = 0; combinerIndex < combinersSize; ++combinerIndex)
+  {
+    if(!m_combiners[combinerIndex]->hasHash())
+    {
+      allCombinersHash = false;
+      break;
+    }
+  }
+  if(allCombinersHash)
+  {
+    combineMessagesByHash();
+    return;
+  }
+
   std::vector<Message*> finalMessages;
   std::vector<int> indexesToBeDeleted;
-  int combinersSize = (int)m_combiners.size();
   bool combinedMessage = false;
   finalMessages.push_back(m_messages[0]);
   for(int allIndex = 1; allIndex < messagesSize; ++allIndex)
@@ -228,5 +334,82 @@ void Lumberjack::combineMessages()
   }
   m_messages.swap(finalMessages);
 }
+
+void Lumberjack::combineMessagesByHash()
+{
+  using HashTable = std::unordered_map<std::size_t, std::vector<int>>;
+
+  const int messagesSize = (int)m_messages.size();
+  const int combinersSize = (int)m_combiners.size();
+
+  // Per Combiner, the indexes of the kept Messages with each hash, in the
+  // order that they were kept
+  std::vector<HashTable> hashTables(combinersSize);
+  std::vector<std::size_t> hashes(combinersSize);
+
+  std::vector<Message*> finalMessages;
+  for(int allIndex = 0; allIndex < messagesSize; ++allIndex)
+  {
+    Message* message = m_messages[allIndex];
+
+    // Find the first kept Message that any Combiner would combine this one
+    // with, which is the one the pairwise comparison would have chosen
+    int finalIndex = -1;
+    for(int combinerIndex = 0; combinerIndex < combinersSize; ++combinerIndex)
+    {
+      Combiner* combiner = m_combiners[combinerIndex];
+      hashes[combinerIndex] = combiner->hash(*message);
+
+      HashTable& hashTable = hashTables[combinerIndex];
+      HashTable::const_iterator it = hashTable.find(hashes[combinerIndex]);
+      if(it == hashTable.end())
+      {
+        continue;
+      }
+
+      for(int candidateIndex : it->second)
+      {
+        if(finalIndex != -1 && candidateIndex >= finalIndex)
+        {
+          break;
+        }
+        if(combiner->shouldMessagesBeCombined(*finalMessages[candidateIndex],
+                                              *message))
+        {
+          finalIndex = candidateIndex;
+          break;
+        }
+      }
+    }
+
+    if(finalIndex == -1)
+    {
+      for(int combinerIndex = 0; combinerIndex < combinersSize; ++combinerIndex)
+      {
+        hashTables[combinerIndex][hashes[combinerIndex]].push_back(
+          (int)finalMessages.size());
+      }
+      finalMessages.push_back(message);
+      continue;
+    }
+
+    // Combiners that are added first have precedence
+    for(int combinerIndex = 0; combinerIndex < combinersSize; ++combinerIndex)
+    {
+      if(m_combiners[combinerIndex]->shouldMessagesBeCombined(
+           *finalMessages[finalIndex],
+           *message))
+      {
+        m_combiners[combinerIndex]->combine(*finalMessages[finalIndex],
+                                            *message,
+                                            m_ranksLimit);
+        break;
+      }
+    }
+    delete message;
+  }
+
+  m_messages.swap(finalMessages);
+}
 }  // end namespace lumberjack
 }  // end namespace axom
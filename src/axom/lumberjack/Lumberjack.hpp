@@ -219,6 +219,48 @@ public:
    */
   void pushMessagesFully();
 
+  /*!
+   *****************************************************************************
+   * \brief This starts pushing all messages up the Communicator class's tree
+   *  structure without waiting for other nodes.
+   *
+   * The Message classes are combined and sent to the parent node, which
+   * forwards them on whenever it calls progressMessages(). Unlike
+   * pushMessagesOnce(), this is not a collective operation. If the
+   * Communicator does not support non-blocking pushes, this calls
+   * pushMessagesOnce() instead.
+   *****************************************************************************
+   */
+  void pushMessagesNonBlocking();
+
+  /*!
+   *****************************************************************************
+   * \brief This makes progress on the non-blocking pushes without waiting.
+   *
+   * Message classes received from the children of this node are combined with
+   * the messages held by this node. On the output node they are kept, and on
+   * any other node they are pushed on to the parent node.
+   *
+   * \return Whether all messages pushed by this node have been sent
+   *****************************************************************************
+   */
+  bool progressMessages();
+
+  /*!
+   *****************************************************************************
+   * \brief This finishes the non-blocking pushes, so that all messages reach
+   *  the output node.
+   *
+   * This pushes the messages held by this node, then waits until the messages
+   * pushed by all nodes have been forwarded to the output node. This is a
+   * collective operation, which only needs to be called once the messages are
+   * required at the output node, such as before finalizing. If the
+   * Communicator does not support non-blocking pushes, this calls
+   * pushMessagesFully() instead.
+   *****************************************************************************
+   */
+  void finishPushingMessages();
+
   /*!
    *****************************************************************************
    * \brief Function indicates whether this node should be outputting messages.
@@ -234,10 +276,34 @@ private:
    *****************************************************************************
    * \brief All Message classes are combined by the currently held Combiner
    *  classes.
+   *
+   * If every Combiner implements Combiner::hash(), this looks up the Message
+   * classes to combine in hash tables. Otherwise, every Message is compared
+   * against all of the Message classes that have been kept so far.
    *****************************************************************************
    */
   void combineMessages();
 
+  /*!
+   *****************************************************************************
+   * \brief Unpacks and deletes the given buffers received by a non-blocking
+   *  push, then pushes the messages on unless this is the output node.
+   *****************************************************************************
+   */
+  void forwardReceivedMessages(
+    std::vector<const char*>& receivedPackedMessages);
+
+  /*!
+   *****************************************************************************
+   * \brief Combines all Message classes through the hashes of the currently
+   *  held Combiner classes.
+   *
+   * Message classes are only compared against kept Message classes with an
+   * equal hash. The result is the same as combining them pairwise.
+   *****************************************************************************
+   */
+  void combineMessagesByHash();
+
   Communicator* m_communicator;
   int m_ranksLimit;
   std::vector<Combiner*> m_combiners;
@@ -14,6 +14,7 @@
  */
 
 #include "axom/lumberjack/MPIUtility.hpp"
+#include "axom/lumberjack/Message.hpp"
 
 #include <cstring>
 
@@ -22,6 +23,8 @@ namespace axom
 namespace lumberjack
 {
 constexpr int LJ_TAG = 55432;
+constexpr int LJ_SIZE_TAG = 55433;
+constexpr int LJ_DATA_TAG = 55434;
 
 const char* mpiBlockingReceiveMessages(MPI_Comm comm)
 {
@@ -55,7 +58,7 @@ void mpiNonBlockingSendMessages(MPI_Comm comm,
 {
   MPI_Request mpiRequest;
   MPI_Isend(const_cast<char*>(packedMessagesToBeSent),
-            strlen(packedMessagesToBeSent),
+            packedMessagesSize(packedMessagesToBeSent),
             MPI_CHAR,
             destinationRank,
             LJ_TAG,
@@ -64,5 +67,177 @@ void mpiNonBlockingSendMessages(MPI_Comm comm,
   MPI_Request_free(&mpiRequest);
 }
 
+void MPINonBlockingPushes::initialize(MPI_Comm comm,
+                                      int parentRank,
+                                      const std::vector<int>& childRanks)
+{
+  m_mpiComm = comm;
+  m_parentRank = parentRank;
+  m_childRanks = childRanks;
+
+  const int childCount = static_cast<int>(m_childRanks.size());
+  m_childSizes.assign(childCount, 0);
+  m_childBuffers.assign(childCount, nullptr);
+  m_childRequests.assign(childCount, MPI_REQUEST_NULL);
+  m_isStarted = false;
+  m_childrenFinishedCount = 0;
+}
+
+void MPINonBlockingPushes::finalize()
+{
+  for(int i = 0; i < static_cast<int>(m_childRequests.size()); ++i)
+  {
+    if(m_childRequests[i] != MPI_REQUEST_NULL)
+    {
+      MPI_Cancel(&m_childRequests[i]);
+      MPI_Wait(&m_childRequests[i], MPI_STATUS_IGNORE);
+    }
+    delete[] m_childBuffers[i];
+    m_childBuffers[i] = nullptr;
+  }
+  m_isStarted = false;
+
+  for(Send& send : m_sends)
+  {
+    MPI_Waitall(2, send.requests, MPI_STATUSES_IGNORE);
+    delete[] send.packedMessages;
+  }
+  m_sends.clear();
+}
+
+void MPINonBlockingPushes::postSizeReceive(int child)
+{
+  MPI_Irecv(&m_childSizes[child],
+            1,
+            MPI_INT,
+            m_childRanks[child],
+            LJ_SIZE_TAG,
+            m_mpiComm,
+            &m_childRequests[child]);
+}
+
+void MPINonBlockingPushes::push(const char* packedMessagesToBeSent)
+{
+  if(isPackedMessagesEmpty(packedMessagesToBeSent))
+  {
+    return;
+  }
+
+  m_sends.emplace_back();
+  Send& send = m_sends.back();
+  send.packedMessages = packedMessagesToBeSent;
+  send.size = packedMessagesSize(packedMessagesToBeSent);
+  MPI_Isend(&send.size,
+            1,
+            MPI_INT,
+            m_parentRank,
+            LJ_SIZE_TAG,
+            m_mpiComm,
+            &send.requests[0]);
+  MPI_Isend(const_cast<char*>(send.packedMessages),
+            send.size,
+            MPI_CHAR,
+            m_parentRank,
+            LJ_DATA_TAG,
+            m_mpiComm,
+            &send.requests[1]);
+}
+
+bool MPINonBlockingPushes::test(
+  std::vector<const char*>& receivedPackedMessages)
+{
+  if(!m_isStarted)
+  {
+    for(int i = 0; i < static_cast<int>(m_childRanks.size()); ++i)
+    {
+      postSizeReceive(i);
+    }
+    m_isStarted = true;
+  }
+
+  for(int i = 0; i < static_cast<int>(m_childRanks.size()); ++i)
+  {
+    // A child's next size and contents are received in turn, so a completed
+    // request may immediately be followed by another one
+    int isComplete = 0;
+    while(m_childRequests[i] != MPI_REQUEST_NULL)
+    {
+      MPI_Test(&m_childRequests[i], &isComplete, MPI_STATUS_IGNORE);
+      if(!isComplete)
+      {
+        break;
+      }
+
+      if(m_childBuffers[i] != nullptr)
+      {
+        // Contents received, wait for the next size
+        receivedPackedMessages.push_back(m_childBuffers[i]);
+        m_childBuffers[i] = nullptr;
+        postSizeReceive(i);
+      }
+      else if(m_childSizes[i] > 0)
+      {
+        // Size received, receive the contents
+        m_childBuffers[i] = new char[m_childSizes[i] + 1];
+        m_childBuffers[i][m_childSizes[i]] = '\0';
+        MPI_Irecv(m_childBuffers[i],
+                  m_childSizes[i],
+                  MPI_CHAR,
+                  m_childRanks[i],
+                  LJ_DATA_TAG,
+                  m_mpiComm,
+                  &m_childRequests[i]);
+      }
+      else
+      {
+        // The child has finished, and its request stays null until finish()
+        ++m_childrenFinishedCount;
+      }
+    }
+  }
+
+  for(auto it = m_sends.begin(); it != m_sends.end();)
+  {
+    int isComplete = 0;
+    MPI_Testall(2, it->requests, &isComplete, MPI_STATUSES_IGNORE);
+    if(isComplete)
+    {
+      delete[] it->packedMessages;
+      it = m_sends.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  return m_sends.empty();
+}
+
+bool MPINonBlockingPushes::childrenFinished() const
+{
+  return m_childrenFinishedCount == static_cast<int>(m_childRanks.size());
+}
+
+void MPINonBlockingPushes::finish()
+{
+  for(Send& send : m_sends)
+  {
+    MPI_Waitall(2, send.requests, MPI_STATUSES_IGNORE);
+    delete[] send.packedMessages;
+  }
+  m_sends.clear();
+
+  if(m_parentRank >= 0)
+  {
+    int finishedSize = 0;
+    MPI_Send(&finishedSize, 1, MPI_INT, m_parentRank, LJ_SIZE_TAG, m_mpiComm);
+  }
+
+  // All receives have completed, the next round posts them again
+  m_isStarted = false;
+  m_childrenFinishedCount = 0;
+}
+
 }  // end namespace lumberjack
 }  // end namespace axom
@@ -16,6 +16,9 @@
 
 #include "mpi.h"
 
+#include <list>
+#include <vector>
+
 namespace axom
 {
 namespace lumberjack
@@ -45,6 +48,105 @@ const char* mpiBlockingReceiveMessages(MPI_Comm comm);
 void mpiNonBlockingSendMessages(MPI_Comm comm,
                                 int destinationRank,
                                 const char* packedMessagesToBeSent);
+
+/*!
+ *******************************************************************************
+ * \class MPINonBlockingPushes
+ *
+ * \brief Implements the non-blocking pushes of a Communicator, given the
+ *  parent and children of this rank in its communication tree.
+ *
+ *  Each packed buffer is sent to the parent as its size followed by its
+ *  contents.  A receive for the size of the next buffer from each child is
+ *  posted ahead of time, and the receive of the contents is posted as soon as
+ *  the size arrives.  None of the functions wait on other ranks, except for
+ *  finish(), which sends a size of zero to the parent to signal that this
+ *  rank has finished.
+ *
+ * \see Communicator::pushNonBlocking
+ *******************************************************************************
+ */
+class MPINonBlockingPushes
+{
+public:
+  /*!
+   *****************************************************************************
+   * \brief Sets the ranks this rank communicates with.
+   *
+   * \param [in] comm The MPI Communicator.
+   * \param [in] parentRank Rank the buffers are sent to, or -1 if none.
+   * \param [in] childRanks Ranks buffers are received from.
+   *****************************************************************************
+   */
+  void initialize(MPI_Comm comm,
+                  int parentRank,
+                  const std::vector<int>& childRanks);
+
+  /*!
+   *****************************************************************************
+   * \brief Cancels the outstanding receives and waits for the outstanding
+   *  sends.
+   *****************************************************************************
+   */
+  void finalize();
+
+  /*!
+   *****************************************************************************
+   * \brief Starts sending the given packed messages to the parent rank and
+   *  takes ownership of the buffer. Empty packed messages are not sent.
+   *****************************************************************************
+   */
+  void push(const char* packedMessagesToBeSent);
+
+  /*!
+   *****************************************************************************
+   * \brief Completes the sends and receives that have arrived, without
+   *  waiting, and appends the received packed messages.
+   *
+   * \return Whether all buffers pushed by this rank have been sent
+   *****************************************************************************
+   */
+  bool test(std::vector<const char*>& receivedPackedMessages);
+
+  /*!
+   *****************************************************************************
+   * \brief Returns whether all children have called finish().
+   *****************************************************************************
+   */
+  bool childrenFinished() const;
+
+  /*!
+   *****************************************************************************
+   * \brief Waits for the sends of this rank, then signals the parent rank
+   *  that this rank has finished.  Should only be called once
+   *  childrenFinished() is true, and starts a new round of pushes.
+   *****************************************************************************
+   */
+  void finish();
+
+private:
+  struct Send
+  {
+    const char* packedMessages;
+    int size;
+    MPI_Request requests[2];
+  };
+
+  void postSizeReceive(int child);
+
+  MPI_Comm m_mpiComm;
+  int m_parentRank;
+  std::vector<int> m_childRanks;
+
+  bool m_isStarted {false};
+  int m_childrenFinishedCount {0};
+  std::vector<int> m_childSizes;
+  std::vector<char*> m_childBuffers;
+  std::vector<MPI_Request> m_childRequests;
+
+  std::list<Send> m_sends;
+};
+
 }  // end namespace lumberjack
 }  // end namespace axom
 
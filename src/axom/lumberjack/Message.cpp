@@ -16,8 +16,10 @@
 #include "axom/lumberjack/Message.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 
 namespace axom
 {
@@ -269,68 +271,106 @@ void Message::unpackRanks(const std::string& ranksString, int ranksLimit)
   }
 }
 
-const char* packMessages(const std::vector<Message*>& messages)
+namespace
 {
-  if(messages.size() == 0)
-  {
-    return zeroMessage;
-  }
+/// Leading bytes of the binary format written by packMessages()
+const char binaryMagic[] = {'L', 'J', 'B', '1'};
+const int binaryMagicSize = sizeof(binaryMagic);
 
-  int totalSize = 1;  // include size for null terminator
+/// Size of the magic bytes followed by the 32-bit total size
+const int binaryHeaderSize = binaryMagicSize + 4;
 
-  //Calculate total size of char array after all messages are
-  //  combined.
-  std::vector<std::string> packedMessages;
-  std::vector<std::string> sizeStrings;
-  int currSize = 0;
-  int messageCount = (int)messages.size();
-  for(int i = 0; i < messageCount; ++i)
+bool isBinaryPacked(const char* packedMessages)
+{
+  // strncmp stops at a null terminator, so this never reads past the end of
+  // a shorter text buffer
+  return std::strncmp(packedMessages, binaryMagic, binaryMagicSize) == 0;
+}
+
+std::uint64_t zigzagEncode(std::int64_t value)
+{
+  return (static_cast<std::uint64_t>(value) << 1) ^
+    static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t zigzagDecode(std::uint64_t value)
+{
+  return static_cast<std::int64_t>(value >> 1) ^
+    -static_cast<std::int64_t>(value & 1);
+}
+
+void writeVarint(std::string& buffer, std::uint64_t value)
+{
+  while(value >= 0x80)
   {
-    packedMessages.push_back(messages[i]->pack());
-    currSize = packedMessages[i].size();
-    sizeStrings.push_back(std::to_string(currSize));
-    //           message size + size string size + memberDelimiter size
-    totalSize += currSize + sizeStrings[i].size() + 1;
+    buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
   }
+  buffer.push_back(static_cast<char>(value));
+}
 
-  // Create and calculate size of message count
-  std::string messageCountString = std::to_string(messageCount) + memberDelimiter;
-  totalSize += messageCountString.size();
+void writeString(std::string& buffer, const std::string& value)
+{
+  writeVarint(buffer, value.size());
+  buffer.append(value);
+}
 
-  const char* packedMessagesString = new char[totalSize];
-  char* packedMessagesIndex = (char*)packedMessagesString;
+/// Reads values from a binary packed buffer without copying it
+class BinaryReader
+{
+public:
+  BinaryReader(const char* begin, const char* end)
+    : m_position(begin)
+    , m_end(end)
+    , m_isValid(true)
+  { }
 
-  // Copy message count to start of packed message
-  std::memcpy(packedMessagesIndex,
-              messageCountString.c_str(),
-              messageCountString.size());
-  packedMessagesIndex += messageCountString.size();
+  bool isValid() const { return m_isValid; }
 
-  for(int i = 0; i < messageCount; ++i)
+  std::uint64_t readVarint()
   {
-    // Copy current message size
-    std::memcpy(packedMessagesIndex,
-                sizeStrings[i].c_str(),
-                sizeStrings[i].size());
-    packedMessagesIndex += sizeStrings[i].size();
-    // Copy memberDelimiter
-    // ToDo: better way to copy this I'm sure
-    std::memcpy(packedMessagesIndex, &memberDelimiter, sizeof(char));
-    packedMessagesIndex += 1;
-    // Copy packed message
-    std::memcpy(packedMessagesIndex,
-                packedMessages[i].c_str(),
-                packedMessages[i].size());
-    packedMessagesIndex += packedMessages[i].size();
-  }
-
-  packedMessagesIndex[0] = '\0';
-  return packedMessagesString;
-}
+    std::uint64_t value = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+      if(m_position == m_end)
+      {
+        break;
+      }
+      const unsigned char byte = static_cast<unsigned char>(*m_position++);
+      value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if((byte & 0x80) == 0)
+      {
+        return value;
+      }
+    }
+    m_isValid = false;
+    return 0;
+  }
 
-void unpackMessages(std::vector<Message*>& messages,
-                    const char* packedMessages,
-                    const int ranksLimit)
+  int readInt() { return static_cast<int>(zigzagDecode(readVarint())); }
+
+  /// Assigns the next string to value, reusing its storage
+  void readString(std::string& value)
+  {
+    const std::uint64_t length = readVarint();
+    if(!m_isValid || length > static_cast<std::uint64_t>(m_end - m_position))
+    {
+      m_isValid = false;
+      return;
+    }
+    value.assign(m_position, length);
+    m_position += length;
+  }
+
+private:
+  const char* m_position;
+  const char* m_end;
+  bool m_isValid;
+};
+
+void unpackTextMessages(std::vector<Message*>& messages,
+                        const char* packedMessages,
+                        const int ranksLimit)
 {
   std::string packedMessagesString = std::string(packedMessages);
   std::size_t start, end;
@@ -362,5 +402,163 @@ void unpackMessages(std::vector<Message*>& messages,
   }
 }
 
+}  // end anonymous namespace
+
+const char* packMessages(const std::vector<Message*>& messages)
+{
+  if(messages.size() == 0)
+  {
+    return zeroMessage;
+  }
+
+  // Intern the file names, which are shared by many messages
+  std::unordered_map<std::string, int> fileNameIndices;
+  std::vector<const std::string*> fileNames;
+  std::vector<int> messageFileIndices;
+  messageFileIndices.reserve(messages.size());
+  for(const Message* message : messages)
+  {
+    auto inserted =
+      fileNameIndices.emplace(message->m_fileName, (int)fileNames.size());
+    if(inserted.second)
+    {
+      fileNames.push_back(&message->m_fileName);
+    }
+    messageFileIndices.push_back(inserted.first->second);
+  }
+
+  std::string buffer(binaryMagic, binaryMagicSize);
+  buffer.append(binaryHeaderSize - binaryMagicSize, '\0');
+
+  writeVarint(buffer, messages.size());
+  writeVarint(buffer, fileNames.size());
+  for(const std::string* fileName : fileNames)
+  {
+    writeString(buffer, *fileName);
+  }
+
+  const int messageCount = (int)messages.size();
+  for(int i = 0; i < messageCount; ++i)
+  {
+    const Message& message = *messages[i];
+    writeVarint(buffer, messageFileIndices[i]);
+    writeVarint(buffer, zigzagEncode(message.m_lineNumber));
+    writeVarint(buffer, zigzagEncode(message.m_level));
+    writeVarint(buffer, zigzagEncode(message.m_count));
+    writeString(buffer, message.m_tag);
+    writeString(buffer, message.m_text);
+
+    writeVarint(buffer, message.m_ranks.size());
+    std::int64_t previousRank = 0;
+    for(const int rank : message.m_ranks)
+    {
+      writeVarint(buffer, zigzagEncode(rank - previousRank));
+      previousRank = rank;
+    }
+  }
+
+  // Store the total size in the header, independent of the host byte order
+  const std::uint32_t totalSize = static_cast<std::uint32_t>(buffer.size());
+  for(int i = 0; i < 4; ++i)
+  {
+    buffer[binaryMagicSize + i] =
+      static_cast<char>((totalSize >> (8 * i)) & 0xff);
+  }
+
+  // Null terminate the buffer like the text format, so it can never be
+  // mistaken for an empty string
+  char* packedMessages = new char[buffer.size() + 1];
+  std::memcpy(packedMessages, buffer.data(), buffer.size());
+  packedMessages[buffer.size()] = '\0';
+  return packedMessages;
+}
+
+int packedMessagesSize(const char* packedMessages)
+{
+  if(packedMessages == nullptr)
+  {
+    return 0;
+  }
+  if(!isBinaryPacked(packedMessages))
+  {
+    return (int)std::strlen(packedMessages);
+  }
+
+  std::uint32_t totalSize = 0;
+  for(int i = 0; i < 4; ++i)
+  {
+    const unsigned char byte =
+      static_cast<unsigned char>(packedMessages[binaryMagicSize + i]);
+    totalSize |= static_cast<std::uint32_t>(byte) << (8 * i);
+  }
+  return (int)totalSize;
+}
+
+void unpackMessages(std::vector<Message*>& messages,
+                    const char* packedMessages,
+                    const int ranksLimit)
+{
+  if(!isBinaryPacked(packedMessages))
+  {
+    unpackTextMessages(messages, packedMessages, ranksLimit);
+    return;
+  }
+
+  BinaryReader reader(packedMessages + binaryHeaderSize,
+                      packedMessages + packedMessagesSize(packedMessages));
+
+  const std::uint64_t messageCount = reader.readVarint();
+  const std::uint64_t fileNameCount = reader.readVarint();
+  std::vector<std::string> fileNames;
+  for(std::uint64_t i = 0; i < fileNameCount && reader.isValid(); ++i)
+  {
+    fileNames.emplace_back();
+    reader.readString(fileNames.back());
+  }
+
+  for(std::uint64_t i = 0; i < messageCount && reader.isValid(); ++i)
+  {
+    Message* message = new Message();
+    const std::uint64_t fileIndex = reader.readVarint();
+    message->m_lineNumber = reader.readInt();
+    message->m_level = reader.readInt();
+    message->m_count = reader.readInt();
+    reader.readString(message->m_tag);
+    reader.readString(message->m_text);
+
+    const std::uint64_t rankCount = reader.readVarint();
+    const std::size_t trackedRanks =
+      std::min(rankCount, static_cast<std::uint64_t>(std::max(ranksLimit, 0)));
+    message->m_ranks.reserve(trackedRanks);
+    std::int64_t rank = 0;
+    for(std::uint64_t j = 0; j < rankCount; ++j)
+    {
+      rank += zigzagDecode(reader.readVarint());
+      if(j < trackedRanks)
+      {
+        message->m_ranks.push_back(static_cast<int>(rank));
+      }
+    }
+    message->m_ranksLimitReached =
+      message->m_ranks.size() == static_cast<std::size_t>(ranksLimit);
+
+    if(!reader.isValid() || fileIndex >= fileNames.size())
+    {
+      std::cerr << "Error: Lumberjack received truncated or corrupted "
+                << "binary packed messages." << std::endl;
+      delete message;
+      return;
+    }
+    message->m_fileName = fileNames[fileIndex];
+    messages.push_back(message);
+  }
+
+  if(!reader.isValid())
+  {
+    std::cerr << "Error: Lumberjack received truncated or corrupted "
+              << "binary packed messages." << std::endl;
+  }
+}
+
 }  // end namespace lumberjack
 }  // end namespace axom
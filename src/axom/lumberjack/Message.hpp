@@ -303,6 +303,11 @@ public:
 private:
   void unpackRanks(const std::string& ranksString, int ranksLimit);
 
+  friend const char* packMessages(const std::vector<Message*>& messages);
+  friend void unpackMessages(std::vector<Message*>& messages,
+                             const char* packedMessages,
+                             const int ranksLimit);
+
   std::string m_text;
   std::vector<int> m_ranks;
   bool m_ranksLimitReached;
@@ -318,9 +323,22 @@ private:
  * \brief This packs all given Message classes into one const char
  *  buffer.
  *
- * The messages are packed into the following format:
- *  <message count>[*<packed message size>*<packed message>]...
- * This function does not alter the messages vector.
+ * The messages are packed into a binary format that starts with a fixed
+ * header holding the bytes "LJB1" and the total size of the buffer as a
+ * little-endian 32-bit integer.  The header is followed by:
+ *  <message count><file name count>[<file name>]...[<packed message>]...
+ * where every packed message is:
+ *  <file name index><line number><level><count><tag><text>
+ *  <rank count>[<rank delta>]...
+ * Integers are stored as variable-length integers, 7 bits per byte, and
+ * signed values are zigzag encoded.  Strings are stored as their length
+ * followed by their characters.  Each distinct file name is stored once, and
+ * the ranks of a message are stored as the differences between consecutive
+ * ranks.  Since the buffer may contain null characters, its size must be
+ * queried with packedMessagesSize().
+ *
+ * An empty vector of messages is packed into zeroMessage.  This function does
+ * not alter the messages vector.
  *
  * \param [in] messages Message classes to be packed for sending
  *
@@ -334,10 +352,11 @@ const char* packMessages(const std::vector<Message*>& messages);
  * \brief This unpacks the given const char buffer and adds the created Messages
  *  classes to the given vector.
  *
- * The messages are packed into the following format:
+ * The messages are decoded directly from the binary format written by
+ * packMessages().  For compatibility, the older text format
  *  <message count>[*<packed message size>*<packed message>]...
- * This function only adds to the messages vector and does not alter the
- * packagedMessages parameter.
+ * is also accepted.  This function only adds to the messages vector and does
+ * not alter the packagedMessages parameter.
  *
  * \param [in,out] messages Vector to append created messages to
  * \param [in]  packedMessages Packed messages to be unpacked
@@ -348,6 +367,17 @@ void unpackMessages(std::vector<Message*>& messages,
                     const char* packedMessages,
                     const int ranksLimit);
 
+/*!
+ *****************************************************************************
+ * \brief Returns the number of bytes in the given packed messages, which is
+ *  the number of bytes that have to be sent to another rank.
+ *
+ * \param [in]  packedMessages Packed messages, either in the binary format
+ *  written by packMessages() or a null-terminated string.
+ *****************************************************************************
+ */
+int packedMessagesSize(const char* packedMessages);
+
 /*!
  *****************************************************************************
  * \brief This checks if a given set of packed messages is empty.
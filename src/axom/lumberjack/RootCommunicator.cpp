@@ -29,9 +29,22 @@ void RootCommunicator::initialize(MPI_Comm comm, int ranksLimit)
   MPI_Comm_rank(m_mpiComm, &m_mpiCommRank);
   MPI_Comm_size(m_mpiComm, &m_mpiCommSize);
   m_ranksLimit = ranksLimit;
+
+  // Every rank pushes directly to the root node
+  std::vector<int> childRanks;
+  if(m_mpiCommRank == 0)
+  {
+    for(int i = 1; i < m_mpiCommSize; ++i)
+    {
+      childRanks.push_back(i);
+    }
+  }
+  m_nonBlockingPushes.initialize(m_mpiComm,
+                                 m_mpiCommRank == 0 ? -1 : 0,
+                                 childRanks);
 }
 
-void RootCommunicator::finalize() { }
+void RootCommunicator::finalize() { m_nonBlockingPushes.finalize(); }
 
 int RootCommunicator::rank() { return m_mpiCommRank; }
 
@@ -80,6 +93,26 @@ void RootCommunicator::push(const char* packedMessagesToBeSent,
   MPI_Barrier(m_mpiComm);
 }
 
+bool RootCommunicator::isNonBlockingPushSupported() { return true; }
+
+void RootCommunicator::pushNonBlocking(const char* packedMessagesToBeSent)
+{
+  m_nonBlockingPushes.push(packedMessagesToBeSent);
+}
+
+bool RootCommunicator::testPushes(
+  std::vector<const char*>& receivedPackedMessages)
+{
+  return m_nonBlockingPushes.test(receivedPackedMessages);
+}
+
+bool RootCommunicator::childrenFinished()
+{
+  return m_nonBlockingPushes.childrenFinished();
+}
+
+void RootCommunicator::finishPushes() { m_nonBlockingPushes.finish(); }
+
 bool RootCommunicator::isOutputNode()
 {
   if(m_mpiCommRank == 0)
@@ -20,6 +20,7 @@
 
 #include "axom/lumberjack/Communicator.hpp"
 #include "axom/lumberjack/Message.hpp"
+#include "axom/lumberjack/MPIUtility.hpp"
 
 namespace axom
 {
@@ -121,6 +122,55 @@ public:
   void push(const char* packedMessagesToBeSent,
             std::vector<const char*>& receivedPackedMessages);
 
+  /*!
+   *****************************************************************************
+   * \brief Returns true, since this Communicator supports non-blocking
+   *  pushes.
+   *****************************************************************************
+   */
+  bool isNonBlockingPushSupported();
+
+  /*!
+   *****************************************************************************
+   * \brief Starts sending the given packed messages to the root node without
+   *  waiting, and takes ownership of the buffer.
+   *
+   * \param [in] packedMessagesToBeSent All of this rank's Message classes
+   *  packed into a single buffer.
+   *****************************************************************************
+   */
+  void pushNonBlocking(const char* packedMessagesToBeSent);
+
+  /*!
+   *****************************************************************************
+   * \brief Completes the sends and receives of non-blocking pushes that have
+   *  arrived, without waiting. The root node posts the receives from all
+   *  other ranks ahead of time.
+   *
+   * \param [in,out] receivedPackedMessages Received packed message buffers from
+   *  all other ranks.
+   *
+   * \return Whether all buffers pushed by this rank have been sent
+   *****************************************************************************
+   */
+  bool testPushes(std::vector<const char*>& receivedPackedMessages);
+
+  /*!
+   *****************************************************************************
+   * \brief Returns whether all other ranks have called finishPushes(), which
+   *  is always true on ranks other than the root node.
+   *****************************************************************************
+   */
+  bool childrenFinished();
+
+  /*!
+   *****************************************************************************
+   * \brief Waits for the non-blocking pushes of this rank to be sent, then
+   *  signals the root node that this rank has finished pushing.
+   *****************************************************************************
+   */
+  void finishPushes();
+
   /*!
    *****************************************************************************
    * \brief Function used by the Lumberjack to indicate whether this node should
@@ -134,6 +184,7 @@ private:
   int m_mpiCommRank;
   int m_mpiCommSize;
   int m_ranksLimit;
+  MPINonBlockingPushes m_nonBlockingPushes;
 };
 
 }  // end namespace lumberjack
@@ -18,6 +18,8 @@
 #include "axom/lumberjack/Combiner.hpp"
 #include "axom/lumberjack/Message.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace axom
@@ -72,6 +74,26 @@ public:
     return false;
   }
 
+  /*!
+   *****************************************************************************
+   * \brief Returns true, Message classes are combined through their hashes.
+   *****************************************************************************
+   */
+  bool hasHash() { return true; }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns a hash of the Message::text, which is the only part of a
+   *  Message that determines whether it is combined.
+   *
+   * \param [in] message The Message to be hashed.
+   *****************************************************************************
+   */
+  std::size_t hash(const Message& message)
+  {
+    return std::hash<std::string>()(message.text());
+  }
+
   /*!
    *****************************************************************************
    * \brief Combines the combinee into the combined Message.
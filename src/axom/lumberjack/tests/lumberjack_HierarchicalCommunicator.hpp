@@ -0,0 +1,247 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "mpi.h"
+
+#include "axom/lumberjack/HierarchicalCommunicator.hpp"
+#include "axom/lumberjack/Lumberjack.hpp"
+
+namespace
+{
+// Checks that the output node holds one message per rank and one message
+// shared by all ranks
+void checkHierarchicalMessages(axom::lumberjack::Lumberjack& lj,
+                               int commRank,
+                               int commSize,
+                               const std::string& sharedText)
+{
+  const std::vector<axom::lumberjack::Message*>& messages = lj.getMessages();
+  if(commRank != 0)
+  {
+    EXPECT_TRUE(messages.empty());
+    return;
+  }
+
+  // Failed assertions would leave the other ranks waiting, so only EXPECT
+  EXPECT_EQ((int)messages.size(), commSize + 1);
+  int sharedCount = 0;
+  for(const axom::lumberjack::Message* m : messages)
+  {
+    if(m->text() == sharedText)
+    {
+      ++sharedCount;
+      EXPECT_EQ(m->count(), commSize);
+
+      std::vector<int> ranks = m->ranks();
+      std::sort(ranks.begin(), ranks.end());
+      std::vector<int> expectedRanks(commSize);
+      std::iota(expectedRanks.begin(), expectedRanks.end(), 0);
+      EXPECT_EQ(ranks, expectedRanks);
+    }
+    else
+    {
+      EXPECT_EQ(m->count(), 1);
+      EXPECT_EQ(m->text(), "message from rank " + m->stringOfRanks());
+    }
+  }
+  EXPECT_EQ(sharedCount, 1);
+  lj.clearMessages();
+}
+
+// Groups every two consecutive ranks, as if they shared a node
+MPI_Comm splitPairs(int commRank)
+{
+  MPI_Comm nodeComm;
+  MPI_Comm_split(MPI_COMM_WORLD, commRank / 2, commRank, &nodeComm);
+  return nodeComm;
+}
+
+}  // end anonymous namespace
+
+TEST(lumberjack_HierarchicalCommunicator, basic)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int commRank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+  int commSize = -1;
+  MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+  const int ranksLimit = 5;
+  axom::lumberjack::HierarchicalCommunicator c;
+  c.initialize(MPI_COMM_WORLD, ranksLimit);
+
+  EXPECT_EQ(c.rank(), commRank);
+  EXPECT_EQ(c.isOutputNode(), commRank == 0);
+
+  EXPECT_EQ(c.ranksLimit(), ranksLimit);
+  const int newRanksLimit = 98876;
+  c.ranksLimit(newRanksLimit);
+  EXPECT_EQ(c.ranksLimit(), newRanksLimit);
+
+  // Every rank sends to the leader of its shared-memory node
+  int nodeSize = 0;
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(MPI_COMM_WORLD,
+                      MPI_COMM_TYPE_SHARED,
+                      commRank,
+                      MPI_INFO_NULL,
+                      &nodeComm);
+  MPI_Comm_size(nodeComm, &nodeSize);
+  MPI_Comm_free(&nodeComm);
+  if(c.isNodeLeader())
+  {
+    // The other ranks of the node, followed by the leaders of other nodes
+    EXPECT_GE((int)c.childRanks().size(), nodeSize - 1);
+    for(int childRank : c.childRanks())
+    {
+      EXPECT_GT(childRank, commRank);
+    }
+  }
+  else
+  {
+    EXPECT_TRUE(c.childRanks().empty());
+    EXPECT_LT(c.parentRank(), commRank);
+  }
+  EXPECT_EQ(c.parentRank() == -1, commRank == 0);
+
+  c.finalize();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST(lumberjack_HierarchicalCommunicator, tree)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int commRank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+  int commSize = -1;
+  MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+  const int fanIn = 2;
+  MPI_Comm nodeComm = splitPairs(commRank);
+  axom::lumberjack::HierarchicalCommunicator c(fanIn);
+  c.initialize(MPI_COMM_WORLD, nodeComm, 5);
+  MPI_Comm_free(&nodeComm);
+
+  // The leader of each pair is its even rank, and the leaders form a binary
+  // tree ordered by rank
+  const int node = commRank / 2;
+  const int nodeCount = (commSize + 1) / 2;
+  EXPECT_EQ(c.isNodeLeader(), commRank % 2 == 0);
+  EXPECT_EQ(c.isOutputNode(), commRank == 0);
+
+  std::vector<int> expectedChildren;
+  int expectedParent = -1;
+  if(c.isNodeLeader())
+  {
+    if(commRank + 1 < commSize)
+    {
+      expectedChildren.push_back(commRank + 1);
+    }
+    for(int i = 1; i <= fanIn; ++i)
+    {
+      if(node * fanIn + i < nodeCount)
+      {
+        expectedChildren.push_back(2 * (node * fanIn + i));
+      }
+    }
+    expectedParent = (node == 0) ? -1 : 2 * ((node - 1) / fanIn);
+  }
+  else
+  {
+    expectedParent = commRank - 1;
+  }
+  EXPECT_EQ(c.childRanks(), expectedChildren);
+  EXPECT_EQ(c.parentRank(), expectedParent);
+
+  // One push within the pairs, plus the height of the tree of leaders
+  int expectedPushes = (commSize > 1) ? 1 : 0;
+  for(int i = nodeCount - 1; i > 0; i = (i - 1) / fanIn)
+  {
+    ++expectedPushes;
+  }
+  EXPECT_EQ(c.numPushesToFlush(), expectedPushes);
+
+  c.finalize();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST(lumberjack_HierarchicalCommunicator, pushMessagesFully)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int commRank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+  int commSize = -1;
+  MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+  // Track every rank without reaching the limit
+  const int ranksLimit = commSize + 1;
+  MPI_Comm nodeComm = splitPairs(commRank);
+  axom::lumberjack::HierarchicalCommunicator c(2);
+  c.initialize(MPI_COMM_WORLD, nodeComm, ranksLimit);
+  MPI_Comm_free(&nodeComm);
+  axom::lumberjack::Lumberjack lj;
+  lj.initialize(&c, ranksLimit);
+
+  lj.queueMessage("shared message", "file.cpp", 1, 0, "");
+  lj.queueMessage("message from rank " + std::to_string(commRank));
+  lj.pushMessagesFully();
+  checkHierarchicalMessages(lj, commRank, commSize, "shared message");
+
+  lj.finalize();
+  c.finalize();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST(lumberjack_HierarchicalCommunicator, pushNonBlocking)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int commRank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+  int commSize = -1;
+  MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+  const int ranksLimit = commSize + 1;
+  MPI_Comm nodeComm = splitPairs(commRank);
+  axom::lumberjack::HierarchicalCommunicator c(2);
+  c.initialize(MPI_COMM_WORLD, nodeComm, ranksLimit);
+  MPI_Comm_free(&nodeComm);
+  EXPECT_TRUE(c.isNonBlockingPushSupported());
+  axom::lumberjack::Lumberjack lj;
+  lj.initialize(&c, ranksLimit);
+
+  for(int round = 0; round < 3; ++round)
+  {
+    const std::string sharedText = "shared message " + std::to_string(round);
+    lj.queueMessage(sharedText, "file.cpp", round, 0, "");
+    lj.queueMessage("message from rank " + std::to_string(commRank));
+    lj.pushMessagesNonBlocking();
+    for(int i = 0; i < 10; ++i)
+    {
+      lj.progressMessages();
+    }
+
+    lj.finishPushingMessages();
+    checkHierarchicalMessages(lj, commRank, commSize, sharedText);
+  }
+
+  lj.finalize();
+  c.finalize();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
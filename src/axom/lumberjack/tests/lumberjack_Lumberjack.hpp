@@ -48,6 +48,67 @@ private:
   bool m_isOutputNode;
 };
 
+// Combines Messages from the same file and line, optionally through a hash
+template <bool HASHED>
+class FileLineCombiner : public axom::lumberjack::Combiner
+{
+public:
+  const std::string id() { return HASHED ? "HashedFileLine" : "FileLine"; }
+
+  bool shouldMessagesBeCombined(const axom::lumberjack::Message& leftMessage,
+                                const axom::lumberjack::Message& rightMessage)
+  {
+    return leftMessage.fileName() == rightMessage.fileName() &&
+      leftMessage.lineNumber() == rightMessage.lineNumber();
+  }
+
+  bool hasHash() { return HASHED; }
+
+  std::size_t hash(const axom::lumberjack::Message& message)
+  {
+    return std::hash<std::string>()(message.fileName()) ^
+      std::hash<int>()(message.lineNumber());
+  }
+
+  void combine(axom::lumberjack::Message& combined,
+               const axom::lumberjack::Message& combinee,
+               const int ranksLimit)
+  {
+    combined.addRanks(combinee.ranks(), combinee.count(), ranksLimit);
+  }
+};
+
+template <bool HASHED>
+void checkCombinerPrecedence()
+{
+  int ranksLimit = 5;
+  TestCommunicator communicator;
+  communicator.initialize(MPI_COMM_NULL, ranksLimit);
+  axom::lumberjack::Lumberjack lumberjack;
+  lumberjack.initialize(&communicator, ranksLimit);
+  lumberjack.addCombiner(new FileLineCombiner<HASHED>);
+
+  // The third Message matches the second by text and the first by file and
+  // line; it is combined into the first, which was kept earlier
+  lumberjack.queueMessage("First text.", "foo.cpp", 10, 0, "");
+  lumberjack.queueMessage("Second text.", "bar.cpp", 20, 0, "");
+  lumberjack.queueMessage("Second text.", "foo.cpp", 10, 0, "");
+  lumberjack.queueMessage("Second text.", "baz.cpp", 30, 0, "");
+
+  lumberjack.pushMessagesOnce();
+
+  std::vector<axom::lumberjack::Message*> messages = lumberjack.getMessages();
+
+  EXPECT_EQ((int)messages.size(), 2);
+  EXPECT_EQ(messages[0]->text(), "First text.");
+  EXPECT_EQ(messages[0]->count(), 2);
+  EXPECT_EQ(messages[1]->text(), "Second text.");
+  EXPECT_EQ(messages[1]->count(), 2);
+
+  lumberjack.finalize();
+  communicator.finalize();
+}
+
 TEST(lumberjack_Lumberjack, combineMessagesPushOnce01)
 {
   int ranksLimit = 5;
@@ -437,3 +498,45 @@ TEST(lumberjack_Lumberjack, combineMessagesLargeMessages)
   lumberjack.finalize();
   communicator.finalize();
 }
+
+TEST(lumberjack_Lumberjack, combineMessagesCombinerPrecedence)
+{
+  // Pairwise comparison, since FileLineCombiner<false> has no hash
+  checkCombinerPrecedence<false>();
+
+  // Hashed lookup must choose the same Messages as the pairwise comparison
+  checkCombinerPrecedence<true>();
+}
+
+TEST(lumberjack_Lumberjack, combineMessagesManyRepeatedMessages)
+{
+  int ranksLimit = 5;
+  const int loopCount = 10000;
+  const int numTexts = 100;
+
+  TestCommunicator communicator;
+  communicator.initialize(MPI_COMM_NULL, ranksLimit);
+  axom::lumberjack::Lumberjack lumberjack;
+  lumberjack.initialize(&communicator, ranksLimit);
+
+  for(int i = 0; i < loopCount; ++i)
+  {
+    std::string s = "Should be combined " + std::to_string(i % numTexts) + ".";
+    lumberjack.queueMessage(s);
+  }
+
+  lumberjack.pushMessagesFully();
+
+  std::vector<axom::lumberjack::Message*> messages = lumberjack.getMessages();
+
+  EXPECT_EQ((int)messages.size(), numTexts);
+  for(int i = 0; i < numTexts; ++i)
+  {
+    std::string s = "Should be combined " + std::to_string(i) + ".";
+    EXPECT_EQ(messages[i]->text(), s);
+    EXPECT_EQ(messages[i]->count(), loopCount / numTexts);
+  }
+
+  lumberjack.finalize();
+  communicator.finalize();
+}
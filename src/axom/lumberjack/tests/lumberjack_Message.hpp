@@ -631,12 +631,16 @@ TEST(lumberjack_Message, packMessagesIndividually)
     messages.push_back(m);
 
     const char* packedMessage = axom::lumberjack::packMessages(messages);
+    EXPECT_EQ(std::strncmp(packedMessage, "LJB1", 4), 0);
+    EXPECT_FALSE(axom::lumberjack::isPackedMessagesEmpty(packedMessage));
 
-    std::string answer =
-      "1*" + std::to_string((int)td.packed.length()) + "*" + td.packed;
-
-    EXPECT_EQ(packedMessage, answer);
+    std::vector<axom::lumberjack::Message*> unpackedMessages;
+    axom::lumberjack::unpackMessages(unpackedMessages, packedMessage, 100);
+    ASSERT_EQ(unpackedMessages.size(), 1u);
+    EXPECT_EQ(unpackedMessages[0]->pack(), td.packed);
 
+    delete unpackedMessages[0];
+    delete[] packedMessage;
     delete m;
     messages.clear();
   }
@@ -646,7 +650,6 @@ TEST(lumberjack_Message, packMessages)
 {
   std::vector<axom::lumberjack::Message*> messages;
   std::vector<TestData> testData = getTestData();
-  std::string answer = "";
   for(auto& td : testData)
   {
     axom::lumberjack::Message* m = new axom::lumberjack::Message(td.text,
@@ -656,14 +659,151 @@ TEST(lumberjack_Message, packMessages)
                                                                  td.level,
                                                                  td.tag);
     messages.push_back(m);
+  }
+
+  const char* packedMessages = axom::lumberjack::packMessages(messages);
+  EXPECT_EQ(std::strncmp(packedMessages, "LJB1", 4), 0);
+
+  std::vector<axom::lumberjack::Message*> unpackedMessages;
+  axom::lumberjack::unpackMessages(unpackedMessages, packedMessages, 100);
+  ASSERT_EQ(unpackedMessages.size(), testData.size());
+  for(int i = 0; i < (int)testData.size(); ++i)
+  {
+    EXPECT_EQ(unpackedMessages[i]->pack(), testData[i].packed);
+    delete unpackedMessages[i];
+    delete messages[i];
+  }
+  delete[] packedMessages;
+}
+
+TEST(lumberjack_Message, packMessagesEmpty)
+{
+  std::vector<axom::lumberjack::Message*> messages;
+  const char* packedMessages = axom::lumberjack::packMessages(messages);
+
+  EXPECT_TRUE(axom::lumberjack::isPackedMessagesEmpty(packedMessages));
+  EXPECT_EQ(axom::lumberjack::packedMessagesSize(packedMessages), 1);
+}
 
-    answer += std::to_string((int)td.packed.length()) + "*" + td.packed;
+TEST(lumberjack_Message, packMessagesBinaryRoundTrip)
+{
+  const int ranksLimit = 50;
+  std::vector<axom::lumberjack::Message*> messages;
+
+  // Many messages sharing a few file names, with unsorted and large ranks
+  const int messageCount = 200;
+  for(int i = 0; i < messageCount; ++i)
+  {
+    std::vector<int> ranks;
+    for(int r = 0; r < i % 7; ++r)
+    {
+      ranks.push_back(r % 2 == 0 ? 1000000 + 3 * r + i : 5 * r);
+    }
+    std::string text(i, 'a' + i % 26);
+    messages.push_back(
+      new axom::lumberjack::Message(text,
+                                    ranks,
+                                    i + 1,
+                                    ranksLimit,
+                                    "dir/file" + std::to_string(i % 3) + ".cpp",
+                                    i % 2 == 0 ? -1 : 1 << 30,
+                                    i % 4,
+                                    i % 5 == 0 ? "" : "tag"));
   }
 
   const char* packedMessages = axom::lumberjack::packMessages(messages);
+  const int packedSize = axom::lumberjack::packedMessagesSize(packedMessages);
+
+  // Every file name is stored once
+  const std::string packedString(packedMessages, packedSize);
+  std::size_t found = 0;
+  for(std::size_t pos = packedString.find("dir/file");
+      pos != std::string::npos;
+      pos = packedString.find("dir/file", pos + 1))
+  {
+    ++found;
+  }
+  EXPECT_EQ(found, 3u);
+
+  // The binary format is smaller than the text format
+  std::size_t textSize = 0;
+  for(axom::lumberjack::Message* m : messages)
+  {
+    const std::string packed = m->pack();
+    textSize += std::to_string(packed.size()).size() + 1 + packed.size();
+  }
+  EXPECT_LT((std::size_t)packedSize, textSize);
+
+  std::vector<axom::lumberjack::Message*> unpackedMessages;
+  axom::lumberjack::unpackMessages(unpackedMessages,
+                                   packedMessages,
+                                   ranksLimit);
+  ASSERT_EQ(unpackedMessages.size(), (std::size_t)messageCount);
+  for(int i = 0; i < messageCount; ++i)
+  {
+    const axom::lumberjack::Message* expected = messages[i];
+    const axom::lumberjack::Message* actual = unpackedMessages[i];
+    EXPECT_EQ(actual->text(), expected->text());
+    EXPECT_EQ(actual->ranks(), expected->ranks());
+    EXPECT_EQ(actual->count(), expected->count());
+    EXPECT_EQ(actual->fileName(), expected->fileName());
+    EXPECT_EQ(actual->lineNumber(), expected->lineNumber());
+    EXPECT_EQ(actual->level(), expected->level());
+    EXPECT_EQ(actual->tag(), expected->tag());
+    delete actual;
+    delete expected;
+  }
+
+  // Unpacking with a smaller ranks limit keeps the first ranks
+  axom::lumberjack::Message* m =
+    new axom::lumberjack::Message("ranks",
+                                  std::vector<int> {7, 3, 11},
+                                  3,
+                                  ranksLimit,
+                                  "file.cpp",
+                                  1,
+                                  0,
+                                  "");
+  const char* smallPacked =
+    axom::lumberjack::packMessages(std::vector<axom::lumberjack::Message*> {m});
+  unpackedMessages.clear();
+  axom::lumberjack::unpackMessages(unpackedMessages, smallPacked, 2);
+  ASSERT_EQ(unpackedMessages.size(), 1u);
+  EXPECT_EQ(unpackedMessages[0]->ranks(), (std::vector<int> {7, 3}));
+  EXPECT_EQ(unpackedMessages[0]->stringOfRanks(), "7,3...");
+  EXPECT_EQ(unpackedMessages[0]->count(), 3);
+  delete unpackedMessages[0];
+
+  delete[] smallPacked;
+  delete[] packedMessages;
+  delete m;
+}
 
-  answer = std::to_string((int)testData.size()) + "*" + answer;
-  EXPECT_EQ(packedMessages, answer);
+TEST(lumberjack_Message, unpackMessagesTruncated)
+{
+  std::vector<axom::lumberjack::Message*> messages;
+  messages.push_back(
+    new axom::lumberjack::Message("text", 1, "file.cpp", 2, 0, "tag"));
+  messages.push_back(
+    new axom::lumberjack::Message("more text", 3, "file.cpp", 4, 0, "tag"));
+  const char* packedMessages = axom::lumberjack::packMessages(messages);
+  const int packedSize = axom::lumberjack::packedMessagesSize(packedMessages);
+
+  // Shrink the size in the header so the last message is cut off
+  char* truncated = new char[packedSize + 1];
+  std::memcpy(truncated, packedMessages, packedSize + 1);
+  truncated[4] = static_cast<char>(packedSize - 3);
+
+  std::vector<axom::lumberjack::Message*> unpackedMessages;
+  axom::lumberjack::unpackMessages(unpackedMessages, truncated, 5);
+  ASSERT_EQ(unpackedMessages.size(), 1u);
+  EXPECT_EQ(unpackedMessages[0]->text(), "text");
+
+  delete unpackedMessages[0];
+  delete[] truncated;
+  delete[] packedMessages;
+  delete messages[0];
+  delete messages[1];
 }
 
 TEST(lumberjack_Message, unpackMessagesIndividually)
@@ -5,13 +5,16 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cstring>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include "mpi.h"
 
 #include "axom/lumberjack/RootCommunicator.hpp"
+#include "axom/lumberjack/Lumberjack.hpp"
 
 TEST(lumberjack_RootCommunicator, basic)
 {
@@ -120,3 +123,76 @@ TEST(lumberjack_RootCommunicator, pushNothing)
 
   MPI_Barrier(MPI_COMM_WORLD);
 }
+
+TEST(lumberjack_RootCommunicator, pushNonBlocking)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int commRank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+  int commSize = -1;
+  MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+  axom::lumberjack::RootCommunicator c;
+  // Track every rank without reaching the limit
+  const int ranksLimit = commSize + 1;
+  c.initialize(MPI_COMM_WORLD, ranksLimit);
+  EXPECT_TRUE(c.isNonBlockingPushSupported());
+  axom::lumberjack::Lumberjack lj;
+  lj.initialize(&c, ranksLimit);
+
+  // Every round of non-blocking pushes ends with a collective finish
+  for(int round = 0; round < 3; ++round)
+  {
+    const std::string sharedText = "shared message " + std::to_string(round);
+    lj.queueMessage(sharedText, "file.cpp", round, 0, "");
+    lj.queueMessage("message from rank " + std::to_string(commRank));
+    lj.pushMessagesNonBlocking();
+    for(int i = 0; i < 10; ++i)
+    {
+      lj.progressMessages();
+    }
+
+    // Other ranks may start the next round once this returns, so the messages
+    // are checked without making progress again
+    lj.finishPushingMessages();
+
+    const std::vector<axom::lumberjack::Message*>& messages = lj.getMessages();
+    if(commRank != 0)
+    {
+      EXPECT_TRUE(messages.empty());
+      continue;
+    }
+
+    // Failed assertions would leave the other ranks waiting, so only EXPECT
+    EXPECT_EQ((int)messages.size(), commSize + 1);
+    int sharedCount = 0;
+    for(const axom::lumberjack::Message* m : messages)
+    {
+      if(m->text() == sharedText)
+      {
+        ++sharedCount;
+        EXPECT_EQ(m->count(), commSize);
+        EXPECT_EQ(m->lineNumber(), round);
+
+        std::vector<int> ranks = m->ranks();
+        std::sort(ranks.begin(), ranks.end());
+        std::vector<int> expectedRanks(commSize);
+        std::iota(expectedRanks.begin(), expectedRanks.end(), 0);
+        EXPECT_EQ(ranks, expectedRanks);
+      }
+      else
+      {
+        EXPECT_EQ(m->count(), 1);
+        EXPECT_EQ(m->text(), "message from rank " + m->stringOfRanks());
+      }
+    }
+    EXPECT_EQ(sharedCount, 1);
+    lj.clearMessages();
+  }
+
+  lj.finalize();
+  c.finalize();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
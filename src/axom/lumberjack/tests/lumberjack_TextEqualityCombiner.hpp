@@ -66,3 +66,28 @@ TEST(lumberjack_TextEqualityCombiner, case02)
   EXPECT_EQ(m2.count(), 1);
   EXPECT_EQ(m2.ranks()[0], 14);
 }
+
+TEST(lumberjack_TextEqualityCombiner, hash)
+{
+  //Messages that are combined must have equal hashes
+  axom::lumberjack::Message m1;
+  m1.text("Same text");
+  m1.fileName("foo.cpp");
+  m1.lineNumber(154);
+
+  axom::lumberjack::Message m2;
+  m2.text("Same text");
+  m2.fileName("bar.cpp");
+  m2.lineNumber(12);
+
+  axom::lumberjack::Message m3;
+  m3.text("Different text");
+
+  axom::lumberjack::TextEqualityCombiner c;
+
+  EXPECT_TRUE(c.hasHash());
+  EXPECT_TRUE(c.shouldMessagesBeCombined(m1, m2));
+  EXPECT_EQ(c.hash(m1), c.hash(m2));
+  EXPECT_FALSE(c.shouldMessagesBeCombined(m1, m3));
+  EXPECT_NE(c.hash(m1), c.hash(m3));
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/lumberjack/Lumberjack.hpp"
+#include "axom/lumberjack/Communicator.hpp"
+#include "axom/lumberjack/Message.hpp"
+
+#include <string>
+#include <vector>
+
+/*!
+ * \file
+ *
+ * Benchmarks of Lumberjack::pushMessagesOnce() on a single output node, which
+ * measures the cost of combining the queued messages. The number of queued
+ * messages ranges from 1e3 to 1e6, and the messages either all have distinct
+ * text or repeat a small set of texts.
+ *
+ * The hashed benchmarks use the default TextEqualityCombiner. The pairwise
+ * benchmarks replace it with an equivalent combiner without a hash, which
+ * falls back to comparing every message against all kept messages, and are
+ * limited to smaller message counts.
+ */
+
+namespace
+{
+namespace lumberjack = axom::lumberjack;
+
+/// Communicator on a single output node that does not communicate
+class LocalCommunicator : public lumberjack::Communicator
+{
+public:
+  void initialize(MPI_Comm comm, int ranksLimit)
+  {
+    m_mpiComm = comm;
+    m_ranksLimit = ranksLimit;
+  }
+
+  void finalize() { }
+
+  int rank() { return 0; }
+
+  void ranksLimit(int value) { m_ranksLimit = value; }
+
+  int ranksLimit() { return m_ranksLimit; }
+
+  int numPushesToFlush() { return 1; }
+
+  void push(const char* /* packedMessagesToBeSent */,
+            std::vector<const char*>& /* receivedPackedMessages */)
+  { }
+
+  bool isOutputNode() { return true; }
+
+private:
+  MPI_Comm m_mpiComm;
+  int m_ranksLimit;
+};
+
+/// Combines messages with equal text, without providing a hash
+class PairwiseTextCombiner : public lumberjack::Combiner
+{
+public:
+  const std::string id() { return "PairwiseTextCombiner"; }
+
+  bool shouldMessagesBeCombined(const lumberjack::Message& leftMessage,
+                                const lumberjack::Message& rightMessage)
+  {
+    return leftMessage.text() == rightMessage.text();
+  }
+
+  void combine(lumberjack::Message& combined,
+               const lumberjack::Message& combinee,
+               const int ranksLimit)
+  {
+    combined.addRanks(combinee.ranks(), combinee.count(), ranksLimit);
+  }
+};
+
+const int RANKS_LIMIT = 5;
+const int NUM_REPEATED_TEXTS = 100;
+
+void combineMessages(benchmark::State& state, bool hashed, bool repeated)
+{
+  const int numMessages = static_cast<int>(state.range(0));
+
+  std::vector<std::string> texts(numMessages);
+  for(int i = 0; i < numMessages; ++i)
+  {
+    const int id = repeated ? i % NUM_REPEATED_TEXTS : i;
+    texts[i] = "Warning: value out of range in zone " + std::to_string(id);
+  }
+
+  LocalCommunicator communicator;
+  communicator.initialize(MPI_COMM_NULL, RANKS_LIMIT);
+  lumberjack::Lumberjack lj;
+  lj.initialize(&communicator, RANKS_LIMIT);
+  if(!hashed)
+  {
+    lj.clearCombiners();
+    lj.addCombiner(new PairwiseTextCombiner);
+  }
+
+  while(state.KeepRunning())
+  {
+    state.PauseTiming();
+    for(int i = 0; i < numMessages; ++i)
+    {
+      lj.queueMessage(texts[i], "file.cpp", i, 0, "");
+    }
+    state.ResumeTiming();
+
+    lj.pushMessagesOnce();
+
+    state.PauseTiming();
+    benchmark::DoNotOptimize(lj.getMessages().size());
+    lj.clearMessages();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * numMessages);
+
+  lj.finalize();
+  communicator.finalize();
+}
+
+void hashed_distinct(benchmark::State& state)
+{
+  combineMessages(state, true, false);
+}
+
+void hashed_repeated(benchmark::State& state)
+{
+  combineMessages(state, true, true);
+}
+
+void pairwise_distinct(benchmark::State& state)
+{
+  combineMessages(state, false, false);
+}
+
+void pairwise_repeated(benchmark::State& state)
+{
+  combineMessages(state, false, true);
+}
+
+}  // namespace
+
+BENCHMARK(hashed_distinct)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(hashed_repeated)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(pairwise_distinct)->RangeMultiplier(10)->Range(1000, 10000);
+BENCHMARK(pairwise_repeated)->RangeMultiplier(10)->Range(1000, 100000);
+
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
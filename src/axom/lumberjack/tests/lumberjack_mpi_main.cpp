@@ -8,6 +8,7 @@
 #include "mpi.h"
 
 #include "lumberjack_BinaryCommunicator.hpp"
+#include "lumberjack_HierarchicalCommunicator.hpp"
 #include "lumberjack_RootCommunicator.hpp"
 
 int main(int argc, char* argv[])
@@ -5,6 +5,7 @@
 
 #include "axom/lumberjack/Lumberjack.hpp"
 #include "axom/lumberjack/BinaryTreeCommunicator.hpp"
+#include "axom/lumberjack/HierarchicalCommunicator.hpp"
 #include "axom/lumberjack/RootCommunicator.hpp"
 #include "axom/lumberjack/Message.hpp"
 
@@ -25,7 +26,8 @@ int main(int argc, char** argv)
     std::cout << "Error: Wrong amount of command line arguments given. "
               << "Usage:" << std::endl
               << "   " << argv[0]
-              << " <b|r depending on binary or root communicator>"
+              << " <b|r|h depending on binary, root or hierarchical"
+              << " communicator>"
               << " <num messages before push once> <file to be read>"
               << std::endl;
     return 1;
@@ -42,11 +44,15 @@ int main(int argc, char** argv)
   {
     communicatorName = "root";
   }
+  else if(std::string(argv[1]) == "h")
+  {
+    communicatorName = "hierarchical";
+  }
   else
   {
-    std::cout << "Error: First parameter must be either 'b' or 'r' for "
-              << "BinaryTreeCommunicator or RootCommunicator respectively."
-              << std::endl;
+    std::cout << "Error: First parameter must be either 'b', 'r' or 'h' for "
+              << "BinaryTreeCommunicator, RootCommunicator or "
+              << "HierarchicalCommunicator respectively." << std::endl;
     return 1;
   }
 
@@ -79,6 +85,10 @@ int main(int argc, char** argv)
   {
     communicator = new axom::lumberjack::RootCommunicator;
   }
+  else if(communicatorName == "hierarchical")
+  {
+    communicator = new axom::lumberjack::HierarchicalCommunicator;
+  }
   communicator->initialize(MPI_COMM_WORLD, ranksLimit);
 
   // Initialize lumberjack
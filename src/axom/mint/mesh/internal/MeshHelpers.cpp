@@ -8,7 +8,9 @@
 #include "axom/core/utilities/Utilities.hpp"
 
 #include <algorithm>
-#include <unordered_map>
+#include <numeric>
+#include <sstream>
+#include <utility>
 #include <vector>
 
 namespace axom
@@ -51,23 +53,133 @@ IndexType otherSide(IndexType* f2c, IndexType thisSide)
 }
 
 //------------------------------------------------------------------------------
-struct FaceTypeCellsNodes
+namespace
 {
-  FaceTypeCellsNodes() : facetype(UNDEFINED_CELL) { }
+/*!
+ * \brief A fixed-width face key, holding the sorted node IDs of a face.
+ *
+ *  Keys are ordered lexicographically, and a key that is a prefix of another
+ *  key is ordered first, as with utilities::LexiComparator.
+ */
+struct FaceKey
+{
+  int size;
+  IndexType nodes[MAX_FACE_NODES];
 
-  FaceTypeCellsNodes(CellType ftype,
-                     std::vector<IndexType>& fcells,
-                     std::vector<IndexType>& fnodes)
-    : facetype(ftype)
-    , facecells(fcells)
-    , facenodes(fnodes)
-  { }
+  bool operator<(const FaceKey& other) const
+  {
+    const int minsize = std::min(size, other.size);
+    for(int i = 0; i < minsize; ++i)
+    {
+      if(nodes[i] != other.nodes[i])
+      {
+        return nodes[i] < other.nodes[i];
+      }
+    }
+    return size < other.size;
+  }
 
-  CellType facetype;
-  std::vector<IndexType> facecells;
-  std::vector<IndexType> facenodes;
+  bool operator==(const FaceKey& other) const
+  {
+    return size == other.size &&
+      std::equal(nodes, nodes + size, other.nodes);
+  }
 };
 
+/*!
+ * \brief A face of a cell, identified by the cell ID and the index of the
+ *  face within the cell, packed into a single ID.
+ */
+inline IndexType packCellFace(IndexType cellID, int face)
+{
+  return cellID * MAX_CELL_FACES + face;
+}
+
+inline IndexType cellOfCellFace(IndexType cellFace)
+{
+  return cellFace / MAX_CELL_FACES;
+}
+
+inline int faceOfCellFace(IndexType cellFace)
+{
+  return static_cast<int>(cellFace % MAX_CELL_FACES);
+}
+
+/*!
+ * \brief Copies the nodes of face \a face of a cell into \a faceNodes, in
+ *  the order listed in the cell's info so that the face normal points out
+ *  of the cell.
+ *
+ * \return The number of nodes of the face.
+ */
+inline int getFaceNodes(const CellInfo& cellInfo,
+                        const IndexType* cellNodes,
+                        int face,
+                        IndexType* faceNodes)
+{
+  int base = 0;
+  for(int f = 0; f < face; ++f)
+  {
+    base += cellInfo.face_nodecount[f];
+  }
+
+  const int numFaceNodes = cellInfo.face_nodecount[face];
+  for(int fn = 0; fn < numFaceNodes; ++fn)
+  {
+    faceNodes[fn] = cellNodes[cellInfo.face_nodes[base + fn]];
+  }
+  return numFaceNodes;
+}
+
+/*!
+ * \brief Returns the key of a face, given its nodes.
+ */
+inline FaceKey makeFaceKey(int numFaceNodes, const IndexType* faceNodes)
+{
+  FaceKey key;
+  key.size = numFaceNodes;
+  std::copy(faceNodes, faceNodes + numFaceNodes, key.nodes);
+  std::sort(key.nodes, key.nodes + numFaceNodes);
+  return key;
+}
+
+/*!
+ * \brief Returns the key of face \a face of cell \a cellID of \a mesh.
+ */
+inline FaceKey makeFaceKey(const Mesh* mesh, IndexType cellID, int face)
+{
+  IndexType nodes[MAX_CELL_NODES];
+  IndexType faceNodes[MAX_FACE_NODES];
+  mesh->getCellNodeIDs(cellID, nodes);
+  const CellInfo& cellInfo = getCellInfo(mesh->getCellType(cellID));
+  const int numFaceNodes = getFaceNodes(cellInfo, nodes, face, faceNodes);
+  return makeFaceKey(numFaceNodes, faceNodes);
+}
+
+/*!
+ * \brief Calls \a func with the cell face ID and the smallest node ID of
+ *  each face of cell \a cellID of \a mesh.
+ */
+template <typename FuncType>
+inline void forEachCellFaceMinNode(const Mesh* mesh,
+                                   IndexType cellID,
+                                   FuncType&& func)
+{
+  IndexType nodes[MAX_CELL_NODES];
+  IndexType faceNodes[MAX_FACE_NODES];
+  mesh->getCellNodeIDs(cellID, nodes);
+  const CellInfo& cellInfo = getCellInfo(mesh->getCellType(cellID));
+
+  for(int f = 0; f < cellInfo.num_faces; ++f)
+  {
+    const int numFaceNodes = getFaceNodes(cellInfo, nodes, f, faceNodes);
+    func(packCellFace(cellID, f),
+         *std::min_element(faceNodes, faceNodes + numFaceNodes));
+  }
+}
+
+}  // end anonymous namespace
+
 //------------------------------------------------------------------------------
 bool initFaces(Mesh* mesh,
                IndexType& facecount,
@@ -79,175 +191,227 @@ bool initFaces(Mesh* mesh,
                Array<IndexType>& f2noffsets,
                Array<CellType>& f2ntypes)
 {
-  bool success = true;
-
+  // Faces are identified by their sorted node IDs.  Rather than collecting
+  // the faces in a map keyed on these, the faces of all cells are bucketed
+  // by their smallest node ID with a counting sort.  Each bucket is then
+  // sorted by face key, so that the faces of a cell that are shared with
+  // another cell end up next to each other.  Numbering the unique faces
+  // bucket by bucket visits them in the lexicographic order of their keys.
+  //
+  // The temporary storage is an ID per cell face, plus a few IDs per node
+  // and per cell, and the buckets are processed in parallel with OpenMP.
   facecount = 0;
 
-  using IDtoKeyType = std::unordered_map<IndexType, std::vector<IndexType>>;
-  using FaceBuilderType = std::map<std::vector<IndexType>,
-                                   FaceTypeCellsNodes,
-                                   utilities::LexiComparator<IndexType>>;
-  FaceBuilderType workface;
-
-  // Iterate over each cell.
   const IndexType cellcount = mesh->getNumberOfCells();
-  for(int c = 0; c < cellcount; ++c)
-  {
-    // Step 1. For every cell, get the nodes.
-    IndexType nodes[MAX_CELL_NODES];
-    mesh->getCellNodeIDs(c, nodes);
-    const CellType celltype = mesh->getCellType(c);
-    const CellInfo thisCell = getCellInfo(celltype);
+  const IndexType nodecount = mesh->getNumberOfNodes();
 
-    int base = 0;
-    for(int f = 0; f < thisCell.num_faces; ++f)
-    {
-      // Step 2. The cell nodes will be in "VTK Order," as specified by
-      // https://www.vtk.org/wp-content/uploads/2015/04/file-formats.pdf.
-      // This routine selects the face nodes as listed in the registered
-      // cell info to make sure that face normals point outward.
-      //
-      // For every face, sort the node IDs and join them together in a
-      // string with '.' delimiters.  This is the key for an associative
-      // array whose value is a list of cell IDs.
-      int num_face_nodes = thisCell.face_nodecount[f];
-      std::vector<IndexType> inorder_facenodes(num_face_nodes);
-      const IndexType* face_node_offsets = thisCell.face_nodes + base;
-      for(int fn = 0; fn < num_face_nodes; ++fn)
-      {
-        inorder_facenodes[fn] = nodes[face_node_offsets[fn]];
-      }
-      base += num_face_nodes;
-
-      std::vector<IndexType> sorted_facenodes(inorder_facenodes);
-      std::sort(sorted_facenodes.begin(), sorted_facenodes.end());
+  // Step 1. Count the faces of each cell.
+  std::vector<IndexType> cellFaceOffsets(cellcount + 1, 0);
 
-      FaceTypeCellsNodes cells_of_face;
-      if(workface.count(sorted_facenodes) > 0)
-      {
-        cells_of_face = workface[sorted_facenodes];
-      }
-      else
-      {
-        cells_of_face.facetype = thisCell.face_types[f];
-        cells_of_face.facenodes = inorder_facenodes;
-      }
-      cells_of_face.facecells.push_back(c);
-      workface[sorted_facenodes] = cells_of_face;
-    }
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellcount; ++c)
+  {
+    cellFaceOffsets[c + 1] = getCellInfo(mesh->getCellType(c)).num_faces;
+  }
+  std::partial_sum(cellFaceOffsets.begin(),
+                   cellFaceOffsets.end(),
+                   cellFaceOffsets.begin());
+  const IndexType cellFaceCount = cellFaceOffsets[cellcount];
+
+  // Step 2. Bucket the cell faces by their smallest node ID.
+  std::vector<IndexType> bucketOffsets(nodecount + 1, 0);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellcount; ++c)
+  {
+    forEachCellFaceMinNode(mesh, c, [&](IndexType, IndexType minNode) {
+#ifdef AXOM_USE_OPENMP
+  #pragma omp atomic
+#endif
+      ++bucketOffsets[minNode + 1];
+    });
+  }
+  std::partial_sum(bucketOffsets.begin(),
+                   bucketOffsets.end(),
+                   bucketOffsets.begin());
+
+  std::vector<IndexType> cellFaces(cellFaceCount);
+  std::vector<IndexType> bucketCursors(bucketOffsets.begin(),
+                                       bucketOffsets.end() - 1);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellcount; ++c)
+  {
+    forEachCellFaceMinNode(mesh, c, [&](IndexType cellFace, IndexType minNode) {
+      IndexType pos;
+#ifdef AXOM_USE_OPENMP
+  #pragma omp atomic capture
+#endif
+      pos = bucketCursors[minNode]++;
+      cellFaces[pos] = cellFace;
+    });
   }
 
-  // Step 3. For each face, record its incident cells.
-  // Here we use ConnectivityArray::reserve() and then append() each
-  // face.  This means the kth inserted face gets ID k.
-  IndexType faceID = 0;
-  IndexType faceNodeTotal = 0;
-  IDtoKeyType keys;
-  f2c.resize(2 * workface.size());
-  for(FaceBuilderType::value_type v : workface)
+  // Step 3. Sort each bucket by face key, breaking ties by cell face ID so
+  // that the incident cells of a face are listed in increasing order.  Flag
+  // the first cell face of each unique face, and count the unique faces in
+  // each bucket.  Fail if a face has more than two incident cells.
+  std::vector<char> isFirstCellFace(cellFaceCount, 0);
+  std::vector<IndexType> bucketFaceOffsets(nodecount + 1, 0);
+  IndexType badFaceCount = 0;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel
+#endif
   {
-    FaceTypeCellsNodes theFace = v.second;
-    faceNodeTotal += static_cast<IndexType>(theFace.facenodes.size());
-    int faceCellCount = static_cast<int>(theFace.facecells.size());
-    IndexType* faceCells = theFace.facecells.data();
+    std::vector<std::pair<FaceKey, IndexType>> bucket;
 
-    if(faceCellCount < 1 || faceCellCount > 2)
+#ifdef AXOM_USE_OPENMP
+  #pragma omp for schedule(dynamic, 256) reduction(+ : badFaceCount)
+#endif
+    for(IndexType n = 0; n < nodecount; ++n)
     {
-      success = false;
-    }
-    else
-    {
-      f2c[2 * faceID] = faceCells[0];
-      f2c[2 * faceID + 1] = (faceCellCount > 1 ? faceCells[1] : -1);
-    }
+      const IndexType begin = bucketOffsets[n];
+      const IndexType end = bucketOffsets[n + 1];
 
-    keys[faceID] = v.first;
+      bucket.clear();
+      for(IndexType i = begin; i < end; ++i)
+      {
+        const IndexType cellFace = cellFaces[i];
+        bucket.emplace_back(makeFaceKey(mesh,
+                                        cellOfCellFace(cellFace),
+                                        faceOfCellFace(cellFace)),
+                            cellFace);
+      }
+      std::sort(bucket.begin(), bucket.end());
 
-    faceID += 1;
+      IndexType numFaces = 0;
+      int numFaceCells = 0;
+      for(IndexType i = begin; i < end; ++i)
+      {
+        const IndexType k = i - begin;
+        cellFaces[i] = bucket[k].second;
+
+        if(k == 0 || !(bucket[k].first == bucket[k - 1].first))
+        {
+          isFirstCellFace[i] = 1;
+          ++numFaces;
+          numFaceCells = 0;
+        }
+
+        if(++numFaceCells == 3)
+        {
+          ++badFaceCount;
+        }
+      }
+      bucketFaceOffsets[n + 1] = numFaces;
+    }
   }
 
-  // If we have any face with less than one or more than two incident cells,
-  // clean up and return failure.  We won't do any more work here.
-  if(!success)
+  // If we have any face with more than two incident cells, clean up and
+  // return failure.  We won't do any more work here.
+  if(badFaceCount > 0)
   {
     f2c.clear();
-    return success;
+    return false;
   }
 
+  std::partial_sum(bucketFaceOffsets.begin(),
+                   bucketFaceOffsets.end(),
+                   bucketFaceOffsets.begin());
+
   // Record how many faces we have in this mesh.
-  facecount = faceID;
+  facecount = bucketFaceOffsets[nodecount];
 
-  // Now that we have a count of all the face-nodes, and we know we have no
-  // faces with more than two nodes, record the face-node relations.
-  f2n.resize(faceNodeTotal);
+  // Step 4. Number the unique faces, and record their incident cells, the
+  // first cell face of each, and the faces of each cell.
+  f2c.resize(2 * facecount);
+  c2f.resize(cellFaceCount);
+  c2n.resize(cellFaceCount);
+  c2foffsets.resize(cellcount + 1);
   f2noffsets.resize(facecount + 1);
   f2ntypes.resize(facecount);
-  int faceNodeOffset = 0;
-  for(int fidx = 0; fidx < facecount; ++fidx)
-  {
-    FaceTypeCellsNodes theFace = workface[keys[fidx]];
-    std::vector<IndexType>& faceNodes = theFace.facenodes;
-    std::copy(faceNodes.begin(), faceNodes.end(), f2n.begin() + faceNodeOffset);
-    f2noffsets[fidx] = faceNodeOffset;
-    f2ntypes[fidx] = theFace.facetype;
-    faceNodeOffset += static_cast<int>(faceNodes.size());
-  }
-  f2noffsets[facecount] = faceNodeOffset;
 
-  // Step 4. Now that we have face IDs, record cell-to-face relation.
-  typedef std::unordered_map<IndexType, std::vector<IndexType>> CellFaceBuilderType;
+  std::vector<IndexType> faceCellFaces(facecount);
 
-  CellFaceBuilderType cell_to_face;
-  int cellFaceCount = 0;
-  for(int f = 0; f < facecount; ++f)
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 256)
+#endif
+  for(IndexType n = 0; n < nodecount; ++n)
   {
-    for(IndexType c : workface[keys[f]].facecells)
+    IndexType faceID = bucketFaceOffsets[n] - 1;
+    for(IndexType i = bucketOffsets[n]; i < bucketOffsets[n + 1]; ++i)
     {
-      std::vector<IndexType> cell_faces;
-      if(cell_to_face.count(c) > 0)
+      const IndexType cellFace = cellFaces[i];
+      const IndexType cellID = cellOfCellFace(cellFace);
+      const int face = faceOfCellFace(cellFace);
+
+      if(isFirstCellFace[i])
       {
-        cell_faces = cell_to_face[c];
+        ++faceID;
+        faceCellFaces[faceID] = cellFace;
+        f2c[2 * faceID] = cellID;
+        f2c[2 * faceID + 1] = -1;
+
+        const CellInfo& cellInfo = getCellInfo(mesh->getCellType(cellID));
+        f2noffsets[faceID + 1] = cellInfo.face_nodecount[face];
+        f2ntypes[faceID] = cellInfo.face_types[face];
       }
-      cellFaceCount += 1;
-      cell_faces.push_back(f);
-      cell_to_face[c] = cell_faces;
+      else
+      {
+        f2c[2 * faceID + 1] = cellID;
+      }
+
+      c2f[cellFaceOffsets[cellID] + face] = faceID;
     }
   }
 
-  // Step 4b. Put cell-to-face relation into output arrays.
-  c2f.resize(cellFaceCount);
-  c2n.resize(cellFaceCount);
-  c2foffsets.resize(cellcount + 1);
-  cellFaceCount = 0;
+  // Step 5. Record the face-node relation, with the nodes of each face in
+  // the order of the first cell that has it.
+  f2noffsets[0] = 0;
+  std::partial_sum(f2noffsets.begin(), f2noffsets.end(), f2noffsets.begin());
+  f2n.resize(f2noffsets[facecount]);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType f = 0; f < facecount; ++f)
+  {
+    const IndexType cellID = cellOfCellFace(faceCellFaces[f]);
+    IndexType nodes[MAX_CELL_NODES];
+    mesh->getCellNodeIDs(cellID, nodes);
+    getFaceNodes(getCellInfo(mesh->getCellType(cellID)),
+                 nodes,
+                 faceOfCellFace(faceCellFaces[f]),
+                 &f2n[f2noffsets[f]]);
+  }
 
+  // Step 6. Sort the faces of each cell by face ID, and record the
+  // neighbor across each face.
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
   for(IndexType cellID = 0; cellID < cellcount; ++cellID)
   {
-    // For the current cell ID, set its type and value offset
-    //  cellTypes[cellID] = m_cell_connectivity->getIDType(cellID);
-    c2foffsets[cellID] = cellFaceCount;
+    const IndexType begin = cellFaceOffsets[cellID];
+    const IndexType end = cellFaceOffsets[cellID + 1];
 
-    if(cell_to_face.count(cellID) > 0)
+    c2foffsets[cellID] = begin;
+    std::sort(c2f.begin() + begin, c2f.begin() + end);
+    for(IndexType i = begin; i < end; ++i)
     {
-      // If we have faces for the current cell (which we certainly
-      // *SHOULD* have), copy them in.
-      std::vector<IndexType>& theCells = cell_to_face[cellID];
-      IndexType* faceIDs = theCells.data();
-      int thisCellFaceCount = static_cast<int>(theCells.size());
-
-      // Copy in values
-      for(int f = 0; f < thisCellFaceCount; ++f)
-      {
-        c2f[cellFaceCount + f] = faceIDs[f];
-        c2n[cellFaceCount + f] = otherSide(&f2c[2 * faceIDs[f]], cellID);
-      }
-
-      // Maintain offset
-      cellFaceCount += thisCellFaceCount;
+      c2n[i] = otherSide(&f2c[2 * c2f[i]], cellID);
     }
   }
   c2foffsets[cellcount] = cellFaceCount;
 
-  return success;
+  return true;
 }
 
 } /* namespace internal */
@@ -55,11 +55,16 @@ std::string make_face_key(int vcount, IndexType* values, char sep);
  * returns false, the output arrays are set to nullptr and facecount is set
  * to 0.
  *
- * This routine visits each of the cells of the mesh.  For each cell face, it
- * retrieves the face's nodes and joins the sorted node IDs to make a unique
- * hash key.  The incident cells are recorded in a list for each face's hash
- * key.  The final face-cell and cell-face relations are constructed from this
- * data structure.
+ * This routine visits each of the cells of the mesh.  Each cell face is
+ * identified by its sorted node IDs, held in a fixed-width key.  The cell
+ * faces are bucketed by their smallest node ID with a counting sort, and the
+ * buckets are sorted by key, so that the cell faces that share a face are
+ * adjacent.  The unique faces are numbered in the lexicographic order of
+ * their keys, and the face-cell and cell-face relations are constructed from
+ * the sorted buckets.  When Axom is built with OpenMP, the cells and buckets
+ * are processed in parallel; the results do not depend on the number of
+ * threads.  The temporary storage is proportional to the number of cell
+ * faces, nodes and cells.
  *
  * This routine is intended to be used in constructing an UnstructuredMesh's
  * face relations, though it will give correct results for any Mesh.
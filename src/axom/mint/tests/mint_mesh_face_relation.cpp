@@ -11,6 +11,7 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -1421,6 +1422,126 @@ TEST(mint_mesh_face_relation, correct_construction)
   }
 }
 
+/*! \brief Checks the face relations of a larger hexahedral mesh.
+ *
+ * The nodes of an n x n x n grid of hexahedra are numbered in a scrambled
+ * order.  The test checks the face count, that the faces are ordered by
+ * their sorted node IDs, and that the face-to-cell and cell-to-face
+ * relations are consistent.
+ */
+TEST(mint_mesh_face_relation, scrambled_hex_grid)
+{
+  using namespace axom::mint;
+
+  constexpr IndexType n = 12;
+  constexpr IndexType nn = n + 1;
+  constexpr IndexType nodecount = nn * nn * nn;
+
+  // A prime stride coprime to the node count scrambles the node IDs
+  auto nodeID = [=](IndexType i, IndexType j, IndexType k) {
+    return ((i + nn * (j + nn * k)) * 1009) % nodecount;
+  };
+
+  UnstructuredMesh<SINGLE_SHAPE> mesh(3, HEX);
+  std::vector<double> coords(3 * nodecount);
+  for(IndexType k = 0; k < nn; ++k)
+  {
+    for(IndexType j = 0; j < nn; ++j)
+    {
+      for(IndexType i = 0; i < nn; ++i)
+      {
+        const IndexType id = nodeID(i, j, k);
+        coords[3 * id] = i;
+        coords[3 * id + 1] = j;
+        coords[3 * id + 2] = k;
+      }
+    }
+  }
+  for(IndexType id = 0; id < nodecount; ++id)
+  {
+    mesh.appendNode(coords[3 * id], coords[3 * id + 1], coords[3 * id + 2]);
+  }
+  for(IndexType k = 0; k < n; ++k)
+  {
+    for(IndexType j = 0; j < n; ++j)
+    {
+      for(IndexType i = 0; i < n; ++i)
+      {
+        const IndexType cell[8] = {nodeID(i, j, k),
+                                   nodeID(i + 1, j, k),
+                                   nodeID(i + 1, j + 1, k),
+                                   nodeID(i, j + 1, k),
+                                   nodeID(i, j, k + 1),
+                                   nodeID(i + 1, j, k + 1),
+                                   nodeID(i + 1, j + 1, k + 1),
+                                   nodeID(i, j + 1, k + 1)};
+        mesh.appendCell(cell);
+      }
+    }
+  }
+
+  IndexType facecount = -1;
+  axom::Array<IndexType> f2c, c2f, c2n, c2foffsets, f2n, f2noffsets;
+  axom::Array<CellType> f2ntypes;
+  ASSERT_TRUE(internal::initFaces(&mesh,
+                                  facecount,
+                                  f2c,
+                                  c2f,
+                                  c2n,
+                                  c2foffsets,
+                                  f2n,
+                                  f2noffsets,
+                                  f2ntypes));
+
+  EXPECT_EQ(3 * n * n * nn, facecount);
+
+  // The faces are ordered by their sorted node IDs
+  std::vector<IndexType> prevKey;
+  IndexType boundaryFaces = 0;
+  for(IndexType f = 0; f < facecount; ++f)
+  {
+    EXPECT_EQ(QUAD, f2ntypes[f]);
+    ASSERT_EQ(4, f2noffsets[f + 1] - f2noffsets[f]);
+
+    std::vector<IndexType> key(f2n.data() + f2noffsets[f],
+                               f2n.data() + f2noffsets[f + 1]);
+    std::sort(key.begin(), key.end());
+    if(f > 0)
+    {
+      EXPECT_LT(prevKey, key) << "Face " << f;
+    }
+    prevKey = key;
+
+    // The incident cells are in increasing order
+    if(f2c[2 * f + 1] == -1)
+    {
+      ++boundaryFaces;
+    }
+    else
+    {
+      EXPECT_LT(f2c[2 * f], f2c[2 * f + 1]);
+    }
+  }
+  EXPECT_EQ(6 * n * n, boundaryFaces);
+
+  // Each cell lists its six faces in increasing order, and its neighbors
+  for(IndexType c = 0; c < n * n * n; ++c)
+  {
+    ASSERT_EQ(6 * c, c2foffsets[c]);
+    for(IndexType i = c2foffsets[c]; i < c2foffsets[c + 1]; ++i)
+    {
+      if(i > c2foffsets[c])
+      {
+        EXPECT_LT(c2f[i - 1], c2f[i]);
+      }
+
+      const IndexType f = c2f[i];
+      EXPECT_TRUE(f2c[2 * f] == c || f2c[2 * f + 1] == c);
+      EXPECT_EQ(f2c[2 * f] == c ? f2c[2 * f + 1] : f2c[2 * f], c2n[i]);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char *argv[])
 {
@@ -26,13 +26,16 @@
 #include "axom/slic.hpp"
 
 // C/C++ includes
-#include <cmath>   /* for std::exp */
-#include <cstdio>  /* for std::remove */
-#include <fstream> /* for std::ifstream */
-#include <iomanip> /* for std::setfill, std::setw */
-#include <string>  /* for std::string */
-#include <sstream> /* for std::stringstream */
-#include <set>     /* for std::set */
+#include <algorithm> /* for std::reverse */
+#include <cmath>     /* for std::exp */
+#include <cstdint>   /* for std::uint16_t */
+#include <cstdio>    /* for std::remove */
+#include <cstring>   /* for std::memcpy */
+#include <fstream>   /* for std::ifstream */
+#include <iomanip>   /* for std::setfill, std::setw */
+#include <string>    /* for std::string */
+#include <sstream>   /* for std::stringstream */
+#include <set>       /* for std::set */
 
 // gtest includes
 #include "gtest/gtest.h"
@@ -256,14 +259,128 @@ void create_multidim_data(Mesh* mesh)
  * \brief Creates artificial mesh data and then writes the mesh out to disk.
  * \param [in] mesh the mesh to write out.
  * \param [in] path the path of the file to be written.
+ * \param [in] options the options to write the file with.
  * \pre mesh != nullptr
  */
-void populate_and_write(Mesh* mesh, const std::string& path)
+void populate_and_write(Mesh* mesh,
+                        const std::string& path,
+                        const VTKWriteOptions& options = VTKWriteOptions())
 {
   create_scalar_data(mesh);
   create_vector_data(mesh);
   create_multidim_data(mesh);
-  write_vtk(mesh, path);
+  EXPECT_EQ(write_vtk(mesh, path, options), 0);
+}
+
+/*!
+ * \brief Reads \a count big-endian values of type \a T from a binary VTK
+ *  file and writes them to \a out in ASCII, one value per line.
+ */
+template <typename T>
+void convert_binary_values(std::ifstream& in,
+                           IndexType count,
+                           std::ostream& out)
+{
+  const std::uint16_t one = 1;
+  unsigned char first_byte;
+  std::memcpy(&first_byte, &one, 1);
+  const bool swap = (first_byte == 1);
+
+  char bytes[sizeof(T)];
+  for(IndexType i = 0; i < count; ++i)
+  {
+    in.read(bytes, sizeof(T));
+    if(swap)
+    {
+      std::reverse(bytes, bytes + sizeof(T));
+    }
+
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    out << value << "\n";
+  }
+
+  // skip the newline that terminates each binary array
+  EXPECT_EQ(in.get(), '\n');
+}
+
+/*!
+ * \brief Converts a VTK file written in the legacy binary format into the
+ *  equivalent ASCII file, so that it can be checked by the parsers below.
+ * \param [in] binary_path the path of the binary file to read.
+ * \param [in] ascii_path the path of the ASCII file to write.
+ */
+void convert_to_ascii(const std::string& binary_path,
+                      const std::string& ascii_path)
+{
+  std::ifstream in(binary_path.c_str(), std::ios::in | std::ios::binary);
+  ASSERT_TRUE(in);
+  std::ofstream out(ascii_path.c_str());
+  ASSERT_TRUE(out);
+  out << std::setprecision(17);
+
+  std::string line, keyword, type;
+  IndexType data_size = 0;
+  while(std::getline(in, line))
+  {
+    std::istringstream tokens(line);
+    tokens >> keyword;
+    if(keyword == "BINARY")
+    {
+      out << "ASCII\n";
+      continue;
+    }
+
+    out << line << "\n";
+    IndexType count = 0;
+    if(keyword == "POINTS")
+    {
+      tokens >> count;
+      convert_binary_values<double>(in, 3 * count, out);
+    }
+    else if(keyword == "CELLS")
+    {
+      tokens >> count >> count;
+      convert_binary_values<int>(in, count, out);
+    }
+    else if(keyword == "CELL_TYPES")
+    {
+      tokens >> count;
+      convert_binary_values<int>(in, count, out);
+    }
+    else if(keyword == "X_COORDINATES" || keyword == "Y_COORDINATES" ||
+            keyword == "Z_COORDINATES")
+    {
+      tokens >> count;
+      convert_binary_values<double>(in, count, out);
+    }
+    else if(keyword == "POINT_DATA" || keyword == "CELL_DATA")
+    {
+      tokens >> data_size;
+    }
+    else if(keyword == "SCALARS" || keyword == "VECTORS")
+    {
+      std::string name;
+      tokens >> name >> type;
+      if(keyword == "SCALARS")
+      {
+        // the lookup table line precedes the values
+        std::getline(in, line);
+        out << line << "\n";
+      }
+
+      count = (keyword == "SCALARS") ? data_size : 3 * data_size;
+      if(type == "double")
+      {
+        convert_binary_values<double>(in, count, out);
+      }
+      else
+      {
+        EXPECT_EQ(type, "int");
+        convert_binary_values<int>(in, count, out);
+      }
+    }
+  }
 }
 
 /*!
@@ -809,10 +926,20 @@ Mesh* build_mesh(int dimension)
 }
 
 template <class MeshType>
-void test_mesh(MeshType* mesh, const std::string& path)
+void test_mesh(MeshType* mesh, const std::string& path, bool binary = false)
 {
-  populate_and_write(mesh, path);
-  std::ifstream file(path.c_str());
+  VTKWriteOptions options;
+  options.binary = binary;
+  populate_and_write(mesh, path, options);
+
+  // binary files are converted to ASCII and checked by the same parsers
+  const std::string ascii_path = binary ? path + ".ascii" : path;
+  if(binary)
+  {
+    convert_to_ascii(path, ascii_path);
+  }
+
+  std::ifstream file(ascii_path.c_str());
   ASSERT_TRUE(file);
   check_header(file);
   check_mesh(mesh, file);
@@ -822,6 +949,10 @@ void test_mesh(MeshType* mesh, const std::string& path)
   delete mesh;
 #if DELETE_VTK_FILES
   std::remove(path.c_str());
+  if(binary)
+  {
+    std::remove(ascii_path.c_str());
+  }
 #endif
 }
 
@@ -932,6 +1063,53 @@ TEST(mint_util_write_vtk, ParticleMesh)
   }
 }
 
+/*!
+ * \brief Writes each type of mesh out to disk in the binary VTK format and
+ *  then reads the file back in to check for correctness.
+ */
+TEST(mint_util_write_vtk, BinaryMeshes)
+{
+  const bool binary = true;
+  for(int dim = 1; dim <= 3; ++dim)
+  {
+    const std::string suffix = std::to_string(dim) + "D_binary.vtk";
+
+    internal::test_mesh(static_cast<UniformMesh*>(
+                          internal::build_mesh<STRUCTURED_UNIFORM_MESH>(dim)),
+                        "uniformMesh" + suffix,
+                        binary);
+
+    internal::test_mesh(
+      static_cast<RectilinearMesh*>(
+        internal::build_mesh<STRUCTURED_RECTILINEAR_MESH>(dim)),
+      "rectilinearMesh" + suffix,
+      binary);
+
+    internal::test_mesh(
+      static_cast<CurvilinearMesh*>(
+        internal::build_mesh<STRUCTURED_CURVILINEAR_MESH>(dim)),
+      "curvilinearMesh" + suffix,
+      binary);
+
+    internal::test_mesh(
+      static_cast<UnstructuredMesh<SINGLE_SHAPE>*>(
+        internal::build_mesh<UNSTRUCTURED_MESH, SINGLE_SHAPE>(dim)),
+      "unstructuredMesh" + suffix,
+      binary);
+
+    internal::test_mesh(
+      static_cast<UnstructuredMesh<MIXED_SHAPE>*>(
+        internal::build_mesh<UNSTRUCTURED_MESH, MIXED_SHAPE>(dim)),
+      "unstructuredMixedMesh" + suffix,
+      binary);
+
+    internal::test_mesh(
+      static_cast<ParticleMesh*>(internal::build_mesh<PARTICLE_MESH>(dim)),
+      "particleMesh" + suffix,
+      binary);
+  }
+}
+
 } /* end namespace mint */
 } /* end namespace axom */
 
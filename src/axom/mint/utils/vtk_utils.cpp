@@ -27,8 +27,13 @@
 #include "axom/fmt.hpp"
 
 // C/C++ includes
-#include <fstream>  // for std::ofstream
-#include <string>   // for std::string
+#include <algorithm>  // for std::reverse
+#include <cstdint>    // for std::uint16_t
+#include <cstring>    // for std::memcpy
+#include <fstream>    // for std::ofstream
+#include <limits>     // for std::numeric_limits
+#include <string>     // for std::string
+#include <vector>     // for std::vector
 
 namespace axom
 {
@@ -39,6 +44,87 @@ namespace mint
 //------------------------------------------------------------------------------
 namespace internal
 {
+/*!
+ * \brief Returns true if the host stores multi-byte values in little-endian
+ *  byte order.
+ */
+bool is_little_endian()
+{
+  const std::uint16_t one = 1;
+  unsigned char first_byte;
+  std::memcpy(&first_byte, &one, 1);
+  return first_byte == 1;
+}
+
+/*!
+ * \brief Writes an array of values of type \a T to a VTK file in the
+ *  big-endian byte order required by the legacy binary format.
+ *
+ * Values are byte-swapped as needed and buffered, so that large arrays are
+ * written in a few contiguous blocks rather than one value at a time. The
+ * caller pushes each value of the array and then calls finish().
+ */
+template <typename T>
+class BinaryArrayWriter
+{
+public:
+  explicit BinaryArrayWriter(std::ofstream& file)
+    : m_file(file)
+    , m_swap(is_little_endian())
+    , m_buffer(BLOCK_SIZE * sizeof(T))
+    , m_size(0)
+  { }
+
+  /// Appends a value to the array
+  void push(T value)
+  {
+    char* bytes = m_buffer.data() + m_size;
+    std::memcpy(bytes, &value, sizeof(T));
+    if(m_swap)
+    {
+      std::reverse(bytes, bytes + sizeof(T));
+    }
+
+    m_size += sizeof(T);
+    if(m_size == m_buffer.size())
+    {
+      flush();
+    }
+  }
+
+  /// Writes out any buffered values and terminates the array
+  void finish()
+  {
+    flush();
+    m_file << "\n";
+  }
+
+private:
+  void flush()
+  {
+    m_file.write(m_buffer.data(), m_size);
+    m_size = 0;
+  }
+
+  static constexpr std::size_t BLOCK_SIZE = 1 << 16;
+
+  std::ofstream& m_file;
+  const bool m_swap;
+  std::vector<char> m_buffer;
+  std::size_t m_size;
+};
+
+/*!
+ * \brief Returns the VTK type name of 64-bit integer field data.
+ *
+ * \note The legacy binary reader sizes a "long" by the platform's long,
+ *  so binary files use the fixed-width vtktypeint64 name instead.
+ */
+const char* int64_type_name(bool binary)
+{
+  return binary ? "vtktypeint64" : "long";
+}
+
 /*!
  * \brief Computes the maximum number of nodes of a cell on the given mesh.
  *
@@ -79,12 +165,13 @@ IndexType get_max_cell_nodes(const Mesh* mesh, IndexType& total_cell_nodes)
 }
 
 /*!
- * \brief Writes mesh node locations to a VTK file in legacy ASCII format.
+ * \brief Writes mesh node locations to a VTK file in legacy format.
  * \param [in] mesh the mesh whose nodes will be written.
+ * \param [in] binary if true, the locations are written in binary.
  * \param [in] file the stream to write to.
  * \pre mesh != nullptr
  */
-void write_points(const Mesh* mesh, std::ofstream& file)
+void write_points(const Mesh* mesh, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(mesh != nullptr);
   const IndexType num_nodes = mesh->getNumberOfNodes();
@@ -99,6 +186,19 @@ void write_points(const Mesh* mesh, std::ofstream& file)
     (mesh_dim > 2) ? mesh->getCoordinateArray(Z_COORDINATE) : nullptr;
 
   fmt::print(file, "POINTS {} double\n", num_nodes);
+  if(binary)
+  {
+    BinaryArrayWriter<double> writer(file);
+    for(IndexType nodeIdx = 0; nodeIdx < num_nodes; ++nodeIdx)
+    {
+      writer.push(x[nodeIdx]);
+      writer.push((y != nullptr) ? y[nodeIdx] : 0.0);
+      writer.push((z != nullptr) ? z[nodeIdx] : 0.0);
+    }
+    writer.finish();
+    return;
+  }
+
   for(IndexType nodeIdx = 0; nodeIdx < num_nodes; ++nodeIdx)
   {
     double xx = x[nodeIdx];
@@ -108,14 +208,34 @@ void write_points(const Mesh* mesh, std::ofstream& file)
   }
 }
 
+/*!
+ * \brief Checks whether the node IDs and the connectivity array of a mesh
+ *  fit in the 32-bit integers of the binary legacy VTK format.
+ * \param [in] mesh the mesh to check.
+ * \pre mesh != nullptr
+ */
+bool fits_binary_format(const Mesh* mesh)
+{
+  SLIC_ASSERT(mesh != nullptr);
+
+  IndexType total_size;
+  get_max_cell_nodes(mesh, total_size);
+  total_size += mesh->getNumberOfCells();
+
+  constexpr IndexType MAX_INT32 = std::numeric_limits<axom::int32>::max();
+  return total_size <= MAX_INT32 && mesh->getNumberOfNodes() <= MAX_INT32;
+}
+
 /*!
  * \brief Writes mesh cell connectivity and type to a VTK file
- *  using the legacy ASCII format.
+ *  using the legacy format.
  * \param [in] mesh the mesh whose cells will be written.
+ * \param [in] binary if true, the cells are written in binary.
  * \param [in] file the stream to write to.
  * \pre mesh != nullptr
+ * \pre !binary || fits_binary_format(mesh)
  */
-void write_cells(const Mesh* mesh, std::ofstream& file)
+void write_cells(const Mesh* mesh, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(mesh != nullptr);
   const IndexType num_cells = mesh->getNumberOfCells();
@@ -129,25 +249,57 @@ void write_cells(const Mesh* mesh, std::ofstream& file)
 
   /* Write out the mesh cell connectivity. */
   IndexType* cell_nodes = new IndexType[max_cell_nodes];
-  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  if(binary)
   {
-    const int num_cell_nodes = mesh->getNumberOfCellNodes(cellIdx);
-    mesh->getCellNodeIDs(cellIdx, cell_nodes);
+    BinaryArrayWriter<axom::int32> writer(file);
+    for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+    {
+      const int num_cell_nodes = mesh->getNumberOfCellNodes(cellIdx);
+      mesh->getCellNodeIDs(cellIdx, cell_nodes);
+
+      writer.push(num_cell_nodes);
+      for(int i = 0; i < num_cell_nodes; ++i)
+      {
+        writer.push(static_cast<axom::int32>(cell_nodes[i]));
+      }
+    }
+    writer.finish();
+  }
+  else
+  {
+    for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+    {
+      const int num_cell_nodes = mesh->getNumberOfCellNodes(cellIdx);
+      mesh->getCellNodeIDs(cellIdx, cell_nodes);
 
-    fmt::print(file,
-               "{} {}\n",
-               num_cell_nodes,
-               fmt::join(cell_nodes, cell_nodes + num_cell_nodes, " "));
+      fmt::print(file,
+                 "{} {}\n",
+                 num_cell_nodes,
+                 fmt::join(cell_nodes, cell_nodes + num_cell_nodes, " "));
+    }
   }
 
   delete[] cell_nodes;
 
   /* Write out the mesh cell types. */
   fmt::print(file, "CELL_TYPES {}\n", num_cells);
-  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  if(binary)
   {
-    CellType cell_type = mesh->getCellType(cellIdx);
-    fmt::print(file, "{}\n", getCellInfo(cell_type).vtk_type);
+    BinaryArrayWriter<axom::int32> writer(file);
+    for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+    {
+      CellType cell_type = mesh->getCellType(cellIdx);
+      writer.push(getCellInfo(cell_type).vtk_type);
+    }
+    writer.finish();
+  }
+  else
+  {
+    for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+    {
+      CellType cell_type = mesh->getCellType(cellIdx);
+      fmt::print(file, "{}\n", getCellInfo(cell_type).vtk_type);
+    }
   }
 }
 
@@ -188,13 +340,15 @@ void write_dimensions(const StructuredMesh* mesh, std::ofstream& file)
 }
 
 /*!
- * \brief Writes a rectilinear mesh to a VTK file using the legacy
- *  ASCII format.
+ * \brief Writes a rectilinear mesh to a VTK file using the legacy format.
  * \param [in] mesh the rectilinear mesh to write out.
+ * \param [in] binary if true, the coordinates are written in binary.
  * \param [in] file the stream to write to.
  * \pre mesh != nullptr
  */
-void write_rectilinear_mesh(const RectilinearMesh* mesh, std::ofstream& file)
+void write_rectilinear_mesh(const RectilinearMesh* mesh,
+                            bool binary,
+                            std::ofstream& file)
 {
   SLIC_ASSERT(mesh != nullptr);
 
@@ -211,13 +365,35 @@ void write_rectilinear_mesh(const RectilinearMesh* mesh, std::ofstream& file)
                coord_names[dim],
                mesh->getNodeResolution(dim));
     const double* coords = mesh->getCoordinateArray(dim);
-    fmt::print(file,
-               "{}\n",
-               fmt::join(coords, coords + mesh->getNodeResolution(dim), " "));
+    if(binary)
+    {
+      BinaryArrayWriter<double> writer(file);
+      for(IndexType i = 0; i < mesh->getNodeResolution(dim); ++i)
+      {
+        writer.push(coords[i]);
+      }
+      writer.finish();
+    }
+    else
+    {
+      fmt::print(file,
+                 "{}\n",
+                 fmt::join(coords, coords + mesh->getNodeResolution(dim), " "));
+    }
   }
   for(int dim = mesh->getDimension(); dim < 3; ++dim)
   {
-    fmt::print(file, "{} 1 double\n0.0\n", coord_names[dim]);
+    fmt::print(file, "{} 1 double\n", coord_names[dim]);
+    if(binary)
+    {
+      BinaryArrayWriter<double> writer(file);
+      writer.push(0.0);
+      writer.finish();
+    }
+    else
+    {
+      fmt::print(file, "0.0\n");
+    }
   }
 }
 
@@ -248,6 +424,7 @@ void write_uniform_mesh(const UniformMesh* mesh, std::ofstream& file)
 template <typename T>
 void write_scalar_helper(const std::string& type,
                          const Field* field,
+                         bool binary,
                          std::ofstream& file)
 {
   const T* data_ptr = Field::getDataPtr<T>(field);
@@ -257,18 +434,30 @@ void write_scalar_helper(const std::string& type,
   fmt::print(file, fmt::format("{}\n", type));
   fmt::print(file, "LOOKUP_TABLE default\n");
   const IndexType num_values = field->getNumTuples();
+  if(binary)
+  {
+    BinaryArrayWriter<T> writer(file);
+    for(IndexType i = 0; i < num_values; ++i)
+    {
+      writer.push(data_ptr[i]);
+    }
+    writer.finish();
+    return;
+  }
+
   fmt::print(file, "{}\n", fmt::join(data_ptr, data_ptr + num_values, "\n"));
 }
 
 /*!
- * \brief Writes a scalar field to a VTK file using the legacy ASCII format
+ * \brief Writes a scalar field to a VTK file using the legacy format
  *
  * \param [in] field the scalar field to write out.
+ * \param [in] binary if true, the field is written in binary.
  * \param [in] file the stream to write to.
  * \pre field != nullptr
  * \pre field->getNumComponents() == 1
  */
-void write_scalar_data(const Field* field, std::ofstream& file)
+void write_scalar_data(const Field* field, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(field != nullptr);
   SLIC_ASSERT(field->getNumComponents() == 1);
@@ -276,16 +465,19 @@ void write_scalar_data(const Field* field, std::ofstream& file)
   switch(field->getType())
   {
   case FLOAT_FIELD_TYPE:
-    write_scalar_helper<float>("float", field, file);
+    write_scalar_helper<float>("float", field, binary, file);
     break;
   case DOUBLE_FIELD_TYPE:
-    write_scalar_helper<double>("double", field, file);
+    write_scalar_helper<double>("double", field, binary, file);
     break;
   case INT32_FIELD_TYPE:
-    write_scalar_helper<axom::int32>("int", field, file);
+    write_scalar_helper<axom::int32>("int", field, binary, file);
     break;
   case INT64_FIELD_TYPE:
-    write_scalar_helper<axom::int64>("long", field, file);
+    write_scalar_helper<axom::int64>(int64_type_name(binary),
+                                     field,
+                                     binary,
+                                     file);
     break;
   default:
     SLIC_WARNING(
@@ -303,6 +495,7 @@ void write_scalar_data(const Field* field, std::ofstream& file)
 template <typename T>
 void write_vector_helper(const std::string& type,
                          const Field* field,
+                         bool binary,
                          std::ofstream& file)
 {
   const T* data_ptr = Field::getDataPtr<T>(field);
@@ -313,6 +506,20 @@ void write_vector_helper(const std::string& type,
 
   const int num_components = field->getNumComponents();
   const IndexType num_values = field->getNumTuples();
+  if(binary)
+  {
+    BinaryArrayWriter<T> writer(file);
+    for(IndexType i = 0; i < num_values; ++i)
+    {
+      writer.push(data_ptr[num_components * i + 0]);
+      writer.push(data_ptr[num_components * i + 1]);
+      writer.push(num_components == 2 ? T(0)
+                                      : data_ptr[num_components * i + 2]);
+    }
+    writer.finish();
+    return;
+  }
+
   for(IndexType i = 0; i < num_values; ++i)
   {
     fmt::print(file,
@@ -324,14 +531,15 @@ void write_vector_helper(const std::string& type,
 }
 
 /*!
- * \brief Writes a vector field to a VTK file using the legacy ASCII format
+ * \brief Writes a vector field to a VTK file using the legacy format
  *
  * \param [in] field the vector field to write out.
+ * \param [in] binary if true, the field is written in binary.
  * \param [in] file the stream to write to.
  * \pre field != nullptr
  * \pre field->getNumComponents() == 2 || field->getNumComponents() == 3
  */
-void write_vector_data(const Field* field, std::ofstream& file)
+void write_vector_data(const Field* field, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(field != nullptr);
   const int num_components = field->getNumComponents();
@@ -341,16 +549,19 @@ void write_vector_data(const Field* field, std::ofstream& file)
   switch(field->getType())
   {
   case FLOAT_FIELD_TYPE:
-    write_vector_helper<float>("float", field, file);
+    write_vector_helper<float>("float", field, binary, file);
     break;
   case DOUBLE_FIELD_TYPE:
-    write_vector_helper<double>("double", field, file);
+    write_vector_helper<double>("double", field, binary, file);
     break;
   case INT32_FIELD_TYPE:
-    write_vector_helper<axom::int32>("int", field, file);
+    write_vector_helper<axom::int32>("int", field, binary, file);
     break;
   case INT64_FIELD_TYPE:
-    write_vector_helper<axom::int64>("long", field, file);
+    write_vector_helper<axom::int64>(int64_type_name(binary),
+                                     field,
+                                     binary,
+                                     file);
     break;
   default:
     SLIC_WARNING(
@@ -368,6 +579,7 @@ void write_vector_data(const Field* field, std::ofstream& file)
 template <typename T>
 void write_multidim_helper(const std::string& type,
                            const Field* field,
+                           bool binary,
                            std::ofstream& file)
 {
   const T* data_ptr = Field::getDataPtr<T>(field);
@@ -382,6 +594,17 @@ void write_multidim_helper(const std::string& type,
     fmt::print(file, "SCALARS {}_{:0>3} {}\n", field->getName(), cur_comp, type);
     fmt::print(file, "LOOKUP_TABLE default\n");
 
+    if(binary)
+    {
+      BinaryArrayWriter<T> writer(file);
+      for(IndexType i = 0; i < num_values; ++i)
+      {
+        writer.push(data_ptr[num_components * i + cur_comp]);
+      }
+      writer.finish();
+      continue;
+    }
+
     for(IndexType i = 0; i < num_values; ++i)
     {
       fmt::print(file, "{}\n", data_ptr[num_components * i + cur_comp]);
@@ -391,29 +614,35 @@ void write_multidim_helper(const std::string& type,
 
 /*!
  * \brief Writes a multidimensional field to a VTK file using the legacy
- *  ASCII format.
+ *  format.
  * \param [in] field the multidimensional field to write out.
+ * \param [in] binary if true, the field is written in binary.
  * \param [in] file the stream to write to.
  * \pre field != nullptr
  * \pre field->getNumComponents > 3
  */
-void write_multidim_data(const Field* field, std::ofstream& file)
+void write_multidim_data(const Field* field,
+                         bool binary,
+                         std::ofstream& file)
 {
   SLIC_ASSERT(field != nullptr);
 
   switch(field->getType())
   {
   case FLOAT_FIELD_TYPE:
-    write_multidim_helper<float>("float", field, file);
+    write_multidim_helper<float>("float", field, binary, file);
     break;
   case DOUBLE_FIELD_TYPE:
-    write_multidim_helper<double>("double", field, file);
+    write_multidim_helper<double>("double", field, binary, file);
     break;
   case INT32_FIELD_TYPE:
-    write_multidim_helper<axom::int32>("int", field, file);
+    write_multidim_helper<axom::int32>("int", field, binary, file);
     break;
   case INT64_FIELD_TYPE:
-    write_multidim_helper<axom::int64>("long", field, file);
+    write_multidim_helper<axom::int64>(int64_type_name(binary),
+                                       field,
+                                       binary,
+                                       file);
     break;
   default:
     SLIC_WARNING(
@@ -425,14 +654,16 @@ void write_multidim_data(const Field* field, std::ofstream& file)
 }
 
 /*!
- * \brief Writes mesh FieldData to a VTK file using the legacy ASCII format.
+ * \brief Writes mesh FieldData to a VTK file using the legacy format.
  * \param [in] field_data the data to write out.
  * \param [in] num_values the number of tuples each field is expected to have.
+ * \param [in] binary if true, the fields are written in binary.
  * \param [in] file the stream to write to.
  * \pre field_data != nullptr
  */
 void write_data(const FieldData* field_data,
                 IndexType AXOM_DEBUG_PARAM(num_values),
+                bool binary,
                 std::ofstream& file)
 {
   const int numFields = field_data->getNumFields();
@@ -449,15 +680,15 @@ void write_data(const FieldData* field_data,
 
     if(num_components == 1)
     {
-      write_scalar_data(field, file);
+      write_scalar_data(field, binary, file);
     }
     else if(num_components == 2 || num_components == 3)
     {
-      write_vector_data(field, file);
+      write_vector_data(field, binary, file);
     }
     else if(num_components > 3)
     {
-      write_multidim_data(field, file);
+      write_multidim_data(field, binary, file);
     }
     else
     {
@@ -469,12 +700,24 @@ void write_data(const FieldData* field_data,
 } /* namespace internal */
 
 //------------------------------------------------------------------------------
-int write_vtk(const Mesh* mesh, const std::string& file_path)
+int write_vtk(const Mesh* mesh,
+              const std::string& file_path,
+              const VTKWriteOptions& options)
 {
   SLIC_ASSERT(mesh != nullptr);
   int mesh_type = mesh->getMeshType();
+  const bool binary = options.binary;
+  const bool unstructured =
+    (mesh_type == mint::UNSTRUCTURED_MESH || mesh_type == mint::PARTICLE_MESH);
+
+  if(binary && unstructured && !internal::fits_binary_format(mesh))
+  {
+    SLIC_WARNING("Mesh connectivity is too large for the binary VTK format.");
+    return -1;
+  }
 
-  std::ofstream file(file_path.c_str());
+  std::ofstream file(file_path.c_str(),
+                     binary ? std::ios::out | std::ios::binary : std::ios::out);
   if(!file.good())
   {
     SLIC_WARNING("Could not open file at path " << file_path);
@@ -484,27 +727,27 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
   /* Write the VTK header */
   file << "# vtk DataFile Version 3.0\n";
   file << "Mesh generated by axom::mint::write_vtk\n";
-  file << "ASCII\n";
+  file << (binary ? "BINARY\n" : "ASCII\n");
 
   /* Write out the mesh node and cell coordinates. */
-  if(mesh_type == mint::UNSTRUCTURED_MESH || mesh_type == mint::PARTICLE_MESH)
+  if(unstructured)
   {
     file << "DATASET UNSTRUCTURED_GRID\n";
-    internal::write_points(mesh, file);
-    internal::write_cells(mesh, file);
+    internal::write_points(mesh, binary, file);
+    internal::write_cells(mesh, binary, file);
   }
   else if(mesh_type == mint::STRUCTURED_CURVILINEAR_MESH)
   {
     file << "DATASET STRUCTURED_GRID\n";
     const StructuredMesh* struc_mesh = dynamic_cast<const StructuredMesh*>(mesh);
     internal::write_dimensions(struc_mesh, file);
-    internal::write_points(struc_mesh, file);
+    internal::write_points(struc_mesh, binary, file);
   }
   else if(mesh_type == mint::STRUCTURED_RECTILINEAR_MESH)
   {
     file << "DATASET RECTILINEAR_GRID\n";
     const RectilinearMesh* rect_mesh = dynamic_cast<const RectilinearMesh*>(mesh);
-    internal::write_rectilinear_mesh(rect_mesh, file);
+    internal::write_rectilinear_mesh(rect_mesh, binary, file);
   }
   else if(mesh_type == mint::STRUCTURED_UNIFORM_MESH)
   {
@@ -527,7 +770,7 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
   if(node_data->getNumFields() > 0)
   {
     fmt::print(file, "POINT_DATA {}\n", num_nodes);
-    internal::write_data(node_data, num_nodes, file);
+    internal::write_data(node_data, num_nodes, binary, file);
   }
 
   /* Write out the cell data if any. */
@@ -538,7 +781,7 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
     if(cell_data->getNumFields() > 0)
     {
       fmt::print(file, "CELL_DATA {}\n", num_cells);
-      internal::write_data(cell_data, num_cells, file);
+      internal::write_data(cell_data, num_cells, binary, file);
     }
   }
 
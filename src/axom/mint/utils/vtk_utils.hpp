@@ -17,15 +17,34 @@ class Mesh;
 class FiniteElement;
 
 /*!
- * \brief Writes a mesh to a VTK file using the legacy ASCII format.
+ * \brief Options controlling how a mesh is written to a VTK file.
+ */
+struct VTKWriteOptions
+{
+  /*!
+   * \brief If true, the mesh and field arrays are written in the legacy
+   *  big-endian binary format instead of the default ASCII format.
+   *
+   * \note Binary files are smaller and much faster to write and read for
+   *  large meshes. The cell connectivity is stored as 32-bit integers, so
+   *  meshes whose connectivity does not fit in that range cannot be written.
+   */
+  bool binary {false};
+};
+
+/*!
+ * \brief Writes a mesh to a VTK file using the legacy VTK format
  *  that can be visualized with VisIt or ParaView.
  * \param [in] mesh the mesh to write out.
  * \param [in] file_path the path of the file to write to.
+ * \param [in] options the write options, by default the file is ASCII.
  * \return an error code, zero signifies a successful write.
  * \pre mesh != nullptr
  * \note This method is primarily intended for debugging.
  */
-int write_vtk(const Mesh* mesh, const std::string& file_path);
+int write_vtk(const Mesh* mesh,
+              const std::string& file_path,
+              const VTKWriteOptions& options = VTKWriteOptions());
 
 /*!
  * \brief Writes a FiniteElement to a VTK file in the legacy ASCII format.
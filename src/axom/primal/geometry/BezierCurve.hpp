@@ -13,6 +13,7 @@
 #define AXOM_PRIMAL_BEZIERCURVE_HPP_
 
 #include "axom/core.hpp"
+#include "axom/core/StaticArray.hpp"
 #include "axom/slic.hpp"
 
 #include "axom/primal/geometry/NumericArray.hpp"
@@ -26,18 +27,20 @@
 
 #include <vector>
 #include <ostream>
+#include <type_traits>
 
 namespace axom
 {
 namespace primal
 {
 // Forward declare the templated classes and operator functions
-template <typename T, int NDIMS>
+template <typename T, int NDIMS, int MAX_ORDER = -1>
 class BezierCurve;
 
 /*! \brief Overloaded output operator for Bezier Curves*/
-template <typename T, int NDIMS>
-std::ostream& operator<<(std::ostream& os, const BezierCurve<T, NDIMS>& bCurve);
+template <typename T, int NDIMS, int MAX_ORDER>
+std::ostream& operator<<(std::ostream& os,
+                         const BezierCurve<T, NDIMS, MAX_ORDER>& bCurve);
 
 /*!
  * \class BezierCurve
@@ -45,6 +48,8 @@ std::ostream& operator<<(std::ostream& os, const BezierCurve<T, NDIMS>& bCurve);
  * \brief Represents a Bezier curve defined by an array of control points
  * \tparam T the coordinate type, e.g., double, float, etc.
  * \tparam NDIMS the number of dimensions
+ * \tparam MAX_ORDER the maximum order of the curve, or -1 (the default) for
+ *  curves of any order
  *
  * The order of a Bezier curve with N+1 control points is N.
  * The curve is approximated by the control points,
@@ -55,8 +60,14 @@ std::ostream& operator<<(std::ostream& os, const BezierCurve<T, NDIMS>& bCurve);
  * Algorithms for Rational Bezier curves derived from 
  * Gerald Farin, "Algorithms for rational Bezier curves"
  * Computer-Aided Design, Volume 15, Number 2, 1983,
+ *
+ * By default, the control points and weights are stored in axom::Arrays.
+ * When MAX_ORDER is nonnegative, they are stored in StaticArrays with room
+ * for MAX_ORDER+1 entries instead, and the curve may have any order up to
+ * MAX_ORDER. Such curves never allocate memory, even in evaluate(), dt() and
+ * split(), and may be copied into and used within device kernels.
  */
-template <typename T, int NDIMS>
+template <typename T, int NDIMS, int MAX_ORDER>
 class BezierCurve
 {
 public:
@@ -64,15 +75,30 @@ public:
   using VectorType = Vector<T, NDIMS>;
   using NumArrayType = NumericArray<T, NDIMS>;
   using SegmentType = Segment<T, NDIMS>;
-  using CoordsVec = axom::Array<PointType>;
   using BoundingBoxType = BoundingBox<T, NDIMS>;
   using OrientedBoundingBoxType = OrientedBoundingBox<T, NDIMS>;
 
+  /// Whether the curve stores its data in fixed-capacity arrays
+  static constexpr bool IS_FIXED_ORDER = (MAX_ORDER >= 0);
+
+  /// Array of up to MAX_ORDER+1 values, or a dynamic array
+  template <typename U>
+  using ArrayType = typename std::conditional<
+    IS_FIXED_ORDER,
+    axom::StaticArray<U, IS_FIXED_ORDER ? MAX_ORDER + 1 : 1>,
+    axom::Array<U>>::type;
+
+  using CoordsVec = ArrayType<PointType>;
+  using WeightsVec = ArrayType<T>;
+
   AXOM_STATIC_ASSERT_MSG((NDIMS == 2) || (NDIMS == 3),
                          "A Bezier Curve object may be defined in 2-D or 3-D");
   AXOM_STATIC_ASSERT_MSG(
     std::is_arithmetic<T>::value,
     "A Bezier Curve must be defined using an arithmetic type");
+  AXOM_STATIC_ASSERT_MSG(MAX_ORDER >= -1,
+                         "The maximum order of a Bezier Curve must be "
+                         "nonnegative, or -1 for curves of any order");
 
 public:
   /*!
@@ -81,10 +107,16 @@ public:
    *
    * \param [in] order the order of the resulting Bezier curve
    * \pre order is greater than or equal to -1.
+   * \pre order is at most MAX_ORDER, if MAX_ORDER is nonnegative
+   *
+   * \note The order defaults to MAX_ORDER
    */
-  explicit BezierCurve(int ord = -1)
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE
+  explicit BezierCurve(int ord = MAX_ORDER)
   {
     SLIC_ASSERT(ord >= -1);
+    SLIC_ASSERT(!IS_FIXED_ORDER || ord <= MAX_ORDER);
     const int sz = utilities::max(-1, ord + 1);
     m_controlPoints.resize(sz);
 
@@ -103,6 +135,8 @@ public:
    * \param [in] ord Polynomial order of the curve
    * \pre order is greater than or equal to zero
    */
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE
   BezierCurve(T* pts, int ord)
   {
     SLIC_ASSERT(pts != nullptr);
@@ -131,6 +165,8 @@ public:
    * \pre order is greater than or equal to zero
    *
    */
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE
   BezierCurve(PointType* pts, int ord)
   {
     SLIC_ASSERT(pts != nullptr);
@@ -156,6 +192,8 @@ public:
    * \pre order is greater than or equal to zero
    *
    */
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE
   BezierCurve(PointType* pts, T* weights, int ord)
   {
     SLIC_ASSERT(pts != nullptr);
@@ -186,10 +224,14 @@ public:
   BezierCurve(const axom::Array<PointType>& pts, int ord)
   {
     SLIC_ASSERT(ord >= 0);
+    AXOM_UNUSED_VAR(ord);
 
-    const int sz = utilities::max(0, ord + 1);
+    const int sz = static_cast<int>(pts.size());
     m_controlPoints.resize(sz);
-    m_controlPoints = pts;
+    for(int p = 0; p < sz; ++p)
+    {
+      m_controlPoints[p] = pts[p];
+    }
 
     makeNonrational();
   }
@@ -210,25 +252,37 @@ public:
   {
     SLIC_ASSERT(ord >= 0);
     SLIC_ASSERT(pts.size() == weights.size());
+    AXOM_UNUSED_VAR(ord);
 
-    const int sz = utilities::max(0, ord + 1);
+    const int sz = static_cast<int>(pts.size());
     m_controlPoints.resize(sz);
     m_weights.resize(sz);
-
-    m_controlPoints = pts;
-    m_weights = weights;
+    for(int p = 0; p < sz; ++p)
+    {
+      m_controlPoints[p] = pts[p];
+      m_weights[p] = weights[p];
+    }
 
     SLIC_ASSERT(isValidRational());
   }
 
   /// Sets the order of the Bezier Curve
-  void setOrder(int ord) { m_controlPoints.resize(ord + 1); }
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE void setOrder(int ord)
+  {
+    SLIC_ASSERT(!IS_FIXED_ORDER || ord <= MAX_ORDER);
+    m_controlPoints.resize(ord + 1);
+  }
 
   /// Returns the order of the Bezier Curve
-  int getOrder() const { return static_cast<int>(m_controlPoints.size()) - 1; }
+  AXOM_HOST_DEVICE int getOrder() const
+  {
+    return static_cast<int>(m_controlPoints.size()) - 1;
+  }
 
   /// Make trivially rational. If already rational, do nothing
-  void makeRational()
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE void makeRational()
   {
     if(!isRational())
     {
@@ -239,13 +293,15 @@ public:
   }
 
   /// Make nonrational by shrinking array of weights
-  void makeNonrational() { m_weights.resize(0); }
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE void makeNonrational() { m_weights.resize(0); }
 
   /// Use array size as flag for rationality
-  bool isRational() const { return (m_weights.size() != 0); }
+  AXOM_HOST_DEVICE bool isRational() const { return (m_weights.size() != 0); }
 
   /// Clears the list of control points, make nonrational
-  void clear()
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE void clear()
   {
     const int ord = getOrder();
     for(int p = 0; p <= ord; ++p)
@@ -257,10 +313,16 @@ public:
   }
 
   /// Retrieves the control point at index \a idx
-  PointType& operator[](int idx) { return m_controlPoints[idx]; }
+  AXOM_HOST_DEVICE PointType& operator[](int idx)
+  {
+    return m_controlPoints[idx];
+  }
 
   /// Retrieves the control point at index \a idx
-  const PointType& operator[](int idx) const { return m_controlPoints[idx]; }
+  AXOM_HOST_DEVICE const PointType& operator[](int idx) const
+  {
+    return m_controlPoints[idx];
+  }
 
   /*!
    * \brief Get a specific weight
@@ -268,7 +330,7 @@ public:
    * \param [in] idx The index of the weight
    * \pre Requires that the curve be rational
    */
-  const T& getWeight(int idx) const
+  AXOM_HOST_DEVICE const T& getWeight(int idx) const
   {
     SLIC_ASSERT(isRational());
     return m_weights[idx];
@@ -282,7 +344,7 @@ public:
    * \pre Requires that the curve be rational
    * \pre Requires that the weight be positive
    */
-  void setWeight(int idx, T weight)
+  AXOM_HOST_DEVICE void setWeight(int idx, T weight)
   {
     SLIC_ASSERT(isRational());
     SLIC_ASSERT(weight > 0);
@@ -291,15 +353,13 @@ public:
   };
 
   /// Checks equality of two Bezier Curve
-  friend inline bool operator==(const BezierCurve<T, NDIMS>& lhs,
-                                const BezierCurve<T, NDIMS>& rhs)
+  friend inline bool operator==(const BezierCurve& lhs, const BezierCurve& rhs)
   {
     return (lhs.m_controlPoints == rhs.m_controlPoints) &&
       (lhs.m_weights == rhs.m_weights);
   }
 
-  friend inline bool operator!=(const BezierCurve<T, NDIMS>& lhs,
-                                const BezierCurve<T, NDIMS>& rhs)
+  friend inline bool operator!=(const BezierCurve& lhs, const BezierCurve& rhs)
   {
     return !(lhs == rhs);
   }
@@ -308,10 +368,10 @@ public:
   CoordsVec getControlPoints() const { return m_controlPoints; }
 
   /// Returns a copy of the Bezier curve's weights
-  axom::Array<T> getWeights() const { return m_weights; }
+  WeightsVec getWeights() const { return m_weights; }
 
   /// Reverses the order of the Bezier curve's control points and weights
-  void reverseOrientation()
+  AXOM_HOST_DEVICE void reverseOrientation()
   {
     const int ord = getOrder();
     const int mid = (ord + 1) / 2;
@@ -328,7 +388,7 @@ public:
   }
 
   /// Returns an axis-aligned bounding box containing the Bezier curve
-  BoundingBoxType boundingBox() const
+  AXOM_HOST_DEVICE BoundingBoxType boundingBox() const
   {
     return BoundingBoxType(m_controlPoints.data(),
                            static_cast<int>(m_controlPoints.size()));
@@ -349,18 +409,21 @@ public:
    *
    * \note We typically evaluate the curve at \a t between 0 and 1
    */
-  PointType evaluate(T t) const
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE PointType evaluate(T t) const
   {
     using axom::utilities::lerp;
 
     PointType ptval;
 
     const int ord = getOrder();
-    axom::Array<T> dCarray(ord + 1);
+    WeightsVec dCarray;
+    dCarray.resize(ord + 1);
 
     if(isRational())
     {
-      axom::Array<T> dWarray(ord + 1);
+      WeightsVec dWarray;
+      dWarray.resize(ord + 1);
 
       // Run algorithm from Farin '83 on each dimension
       for(int i = 0; i < NDIMS; ++i)
@@ -418,17 +481,20 @@ public:
    *
    * \note We typically find the tangent of the curve at \a t between 0 and 1
    */
-  VectorType dt(T t) const
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE VectorType dt(T t) const
   {
     using axom::utilities::lerp;
     VectorType val;
 
     const int ord = getOrder();
-    axom::Array<T> dCarray(ord + 1);
+    WeightsVec dCarray;
+    dCarray.resize(ord + 1);
 
     if(isRational())
     {
-      axom::Array<T> dWarray(ord + 1);
+      WeightsVec dWarray;
+      dWarray.resize(ord + 1);
 
       // Run algorithm from Farin '83 on each dimension
       for(int i = 0; i < NDIMS; ++i)
@@ -492,7 +558,8 @@ public:
    *
    * \pre Parameter \a t must be between 0 and 1
    */
-  void split(T t, BezierCurve& c1, BezierCurve& c2) const
+  AXOM_SUPPRESS_HD_WARN
+  AXOM_HOST_DEVICE void split(T t, BezierCurve& c1, BezierCurve& c2) const
   {
     int ord = getOrder();
     SLIC_ASSERT(ord >= 0);
@@ -562,7 +629,7 @@ public:
    * \param [in] tol Threshold for sum of squared distances
    * \return True if c1 is near-linear
    */
-  bool isLinear(double tol = 1E-8) const
+  AXOM_HOST_DEVICE bool isLinear(double tol = 1E-8) const
   {
     const int ord = getOrder();
     if(ord <= 1)
@@ -609,7 +676,7 @@ public:
 private:
   /// Check that the weights used are positive, and
   ///  that there is one for each control node
-  bool isValidRational() const
+  AXOM_HOST_DEVICE bool isValidRational() const
   {
     if(!isRational()) return true;
 
@@ -624,14 +691,15 @@ private:
   }
 
   CoordsVec m_controlPoints;
-  axom::Array<T> m_weights;
+  WeightsVec m_weights;
 };
 
 //------------------------------------------------------------------------------
 /// Free functions related to BezierCurve
 //------------------------------------------------------------------------------
-template <typename T, int NDIMS>
-std::ostream& operator<<(std::ostream& os, const BezierCurve<T, NDIMS>& bCurve)
+template <typename T, int NDIMS, int MAX_ORDER>
+std::ostream& operator<<(std::ostream& os,
+                         const BezierCurve<T, NDIMS, MAX_ORDER>& bCurve)
 {
   bCurve.print(os);
   return os;
@@ -93,6 +93,72 @@ primal::Point<T, 2> sector_centroid(const primal::BezierCurve<T, 2>& curve)
   return primal::Point<T, 2> {Mx, My};
 }
 
+/*!
+   * \brief Calculates the sector area of a planar, nonrational Bezier Curve
+   *  with a fixed MAX_ORDER
+   *
+   * Computes the weights of sector_area() for each curve from a table of
+   * binomial coefficients on the stack instead of memoizing them, so it
+   * does not allocate memory and may be called in device kernels.
+   */
+template <typename T, int MAX_ORDER>
+AXOM_HOST_DEVICE T sector_area(
+  const primal::BezierCurve<T, 2, MAX_ORDER>& curve)
+{
+  // Algorithm works only on nonrational Bezier curves
+  SLIC_ASSERT(!curve.isRational());
+
+  T A = 0;
+  const int ord = curve.getOrder();
+  const detail::BinomialTable<T, 2 * MAX_ORDER> binom(2 * ord);
+  for(int p = 0; p <= ord; ++p)
+  {
+    for(int q = p + 1; q <= ord; ++q)
+    {
+      // The weights are antisymmetric, with zeros on the diagonal
+      const T weight = detail::sector_area_weight<T>(ord, p, q, binom);
+      A += weight * (curve[p][1] * curve[q][0] - curve[q][1] * curve[p][0]);
+    }
+  }
+  return A;
+}
+
+/*!
+   * \brief Calculates the sector centroid of a planar, nonrational Bezier
+   *  Curve with a fixed MAX_ORDER
+   *
+   * Computes the weights of sector_centroid() for each curve from a table of
+   * binomial coefficients on the stack instead of memoizing them, so it
+   * does not allocate memory and may be called in device kernels.
+   */
+template <typename T, int MAX_ORDER>
+AXOM_HOST_DEVICE primal::Point<T, 2> sector_centroid(
+  const primal::BezierCurve<T, 2, MAX_ORDER>& curve)
+{
+  // Algorithm works only on nonrational Bezier curves
+  SLIC_ASSERT(!curve.isRational());
+
+  T Mx = 0;
+  T My = 0;
+  const int ord = curve.getOrder();
+  const detail::BinomialTable<T, 3 * MAX_ORDER> binom(3 * ord - 2);
+  for(int r = 0; r <= ord; ++r)
+  {
+    for(int p = 0; p <= ord; ++p)
+    {
+      for(int q = p + 1; q <= ord; ++q)
+      {
+        // The weights are antisymmetric, with zeros on the diagonal
+        const T weight = detail::sector_centroid_weight<T>(ord, p, q, r, binom);
+        const T cross = curve[p][1] * curve[q][0] - curve[q][1] * curve[p][0];
+        Mx += weight * cross * curve[r][0];
+        My += weight * cross * curve[r][1];
+      }
+    }
+  }
+  return primal::Point<T, 2> {Mx, My};
+}
+
 /// \brief Returns the area enclosed by the CurvedPolygon
 template <typename T>
 T area(const primal::CurvedPolygon<T, 2>& poly, double tol = 1e-8)
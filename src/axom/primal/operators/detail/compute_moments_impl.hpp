@@ -28,6 +28,119 @@ namespace primal
 {
 namespace detail
 {
+/// Computes binomial coefficients with utilities::binomialCoefficient()
+struct BinomialCoefficient
+{
+  AXOM_HOST_DEVICE int operator()(int n, int k) const
+  {
+    return utilities::binomialCoefficient(n, k);
+  }
+};
+
+/*!
+ * \brief Table of the binomial coefficients of the first rows of Pascal's
+ *  triangle, stored on the stack
+ *
+ * \tparam T the type of the coefficients
+ * \tparam MAX_ROW the largest row of the triangle that may be stored
+ */
+template <typename T, int MAX_ROW>
+class BinomialTable
+{
+public:
+  /// Computes the rows 0 to \a nrows of Pascal's triangle
+  AXOM_HOST_DEVICE explicit BinomialTable(int nrows)
+  {
+    SLIC_ASSERT(nrows <= MAX_ROW);
+    for(int n = 0; n <= nrows; ++n)
+    {
+      T* row = &m_values[n * (MAX_ROW + 1)];
+      const T* prev = row - (MAX_ROW + 1);
+      row[0] = 1.;
+      row[n] = 1.;
+      for(int k = 1; k < n; ++k)
+      {
+        row[k] = prev[k - 1] + prev[k];
+      }
+    }
+  }
+
+  /// Returns the binomial coefficient `n choose k`, or 0 if it's out of bounds
+  AXOM_HOST_DEVICE T operator()(int n, int k) const
+  {
+    return (n < 0 || k < 0 || k > n) ? T {0} : m_values[n * (MAX_ROW + 1) + k];
+  }
+
+private:
+  StackArray<T, (MAX_ROW + 1) * (MAX_ROW + 1)> m_values;
+};
+
+/*!
+ * \brief Computes entry (i,j) of the weights for the sector_area()
+ *  of a BezierCurve of order \a ord
+ *
+ * \param [in] binom Functor that returns the binomial coefficient `n choose k`
+ *
+ * The weights form an anti-symmetric matrix. The derivation is provided in:
+ *  Ueda, K. "Signed area of sectors between spline curves and the origin"
+ *  IEEE International Conference on Information Visualization, 1999.
+ */
+template <typename T, typename BinomialFunc>
+AXOM_HOST_DEVICE T sector_area_weight(int ord,
+                                      int i,
+                                      int j,
+                                      const BinomialFunc& binom)
+{
+  if(i == j)
+  {
+    return 0.;  // zero on the diagonal
+  }
+  if(i > j)
+  {
+    return -sector_area_weight<T>(ord, j, i, binom);  // antisymmetric
+  }
+
+  T binom_2n_n = static_cast<T>(binom(2 * ord, ord));
+  T binom_ij_i = static_cast<T>(binom(i + j, i));
+  T binom_2nij_nj = static_cast<T>(binom(2 * ord - i - j, ord - j));
+
+  return ((j - i) * ord) / binom_2n_n * (binom_ij_i / static_cast<T>(i + j)) *
+    (binom_2nij_nj / (2. * ord - j - i));
+}
+
+/*!
+ * \brief Computes entry (i,j) of the weights for component \a k of the
+ *  sector_centroid() of a BezierCurve of order \a ord
+ *
+ * \param [in] binom Functor that returns the binomial coefficient `n choose k`
+ *
+ * The weights for each component form an anti-symmetric matrix.
+ */
+template <typename T, typename BinomialFunc>
+AXOM_HOST_DEVICE T sector_centroid_weight(int ord,
+                                          int i,
+                                          int j,
+                                          int k,
+                                          const BinomialFunc& binom)
+{
+  if(i == j)
+  {
+    return 0.;  // zero on the diagonal
+  }
+  if(i > j)
+  {
+    return -sector_centroid_weight<T>(ord, j, i, k, binom);  // antisymmetric
+  }
+
+  T binom_n_i = static_cast<T>(binom(ord, i));
+  T binom_n_j = static_cast<T>(binom(ord, j));
+  T binom_n_k = static_cast<T>(binom(ord, k));
+  T binom_3n2_ijk1 = static_cast<T>(binom(3 * ord - 2, i + j + k - 1));
+
+  return (1. * (j - i)) / (3. * (3 * ord - 1)) *
+    (1. * binom_n_i * binom_n_j * binom_n_k / (1. * binom_3n2_ijk1));
+}
+
 /// Utility class that caches precomputed coefficient matrices for sector_area computation
 template <typename T>
 class MemoizedSectorAreaWeights
@@ -80,23 +193,12 @@ private:
     SectorWeights* weights =
       new SectorWeights(SZ, SZ, new T[SZ * SZ], memoryIsExternal);
 
-    T binom_2n_n = static_cast<T>(utilities::binomialCoefficient(2 * ord, ord));
     for(int i = 0; i <= ord; ++i)
     {
       (*weights)(i, i) = 0.;  // zero on the diagonal
       for(int j = i + 1; j <= ord; ++j)
       {
-        double val = 0.;
-        if(i != j)
-        {
-          T binom_ij_i = static_cast<T>(utilities::binomialCoefficient(i + j, i));
-          T binom_2nij_nj = static_cast<T>(
-            utilities::binomialCoefficient(2 * ord - i - j, ord - j));
-
-          val = ((j - i) * ord) / binom_2n_n *
-            (binom_ij_i / static_cast<T>(i + j)) *
-            (binom_2nij_nj / (2. * ord - j - i));
-        }
+        T val = sector_area_weight<T>(ord, i, j, BinomialCoefficient {});
         (*weights)(i, j) = val;  // antisymmetric
         (*weights)(j, i) = -val;
       }
@@ -172,18 +274,8 @@ public:
         (*weights_k)(i, i) = 0.;  // zero on the diagonal
         for(int j = i + 1; j <= ord; ++j)
         {
-          double val = 0.;
-          if(i != j)
-          {
-            T binom_n_i = static_cast<T>(utilities::binomialCoefficient(ord, i));
-            T binom_n_j = static_cast<T>(utilities::binomialCoefficient(ord, j));
-            T binom_n_k = static_cast<T>(utilities::binomialCoefficient(ord, k));
-            T binom_3n2_ijk1 = static_cast<T>(
-              utilities::binomialCoefficient(3 * ord - 2, i + j + k - 1));
-
-            val = (1. * (j - i)) / (3. * (3 * ord - 1)) *
-              (1. * binom_n_i * binom_n_j * binom_n_k / (1. * binom_3n2_ijk1));
-          }
+          T val =
+            sector_centroid_weight<T>(ord, i, j, k, BinomialCoefficient {});
           (*weights_k)(i, j) = val;  // antisymmetric
           (*weights_k)(j, i) = -val;
         }
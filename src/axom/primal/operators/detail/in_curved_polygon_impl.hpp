@@ -11,9 +11,9 @@
 #include "axom/primal/geometry/Point.hpp"
 #include "axom/primal/geometry/Triangle.hpp"
 #include "axom/primal/geometry/BezierCurve.hpp"
-#include "axom/primal/operators/in_polygon.hpp"
-#include "axom/primal/operators/is_convex.hpp"
 #include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/operators/detail/in_polygon_impl.hpp"
+#include "axom/primal/operators/detail/is_convex_impl.hpp"
 
 // C++ includes
 #include <cmath>
@@ -38,10 +38,10 @@ namespace detail
  * \return double The winding number
  */
 template <typename T>
-double linear_winding_number(const Point<T, 2>& q,
-                             const Point<T, 2>& c0,
-                             const Point<T, 2>& c1,
-                             double edge_tol)
+AXOM_HOST_DEVICE double linear_winding_number(const Point<T, 2>& q,
+                                              const Point<T, 2>& c0,
+                                              const Point<T, 2>& c1,
+                                              double edge_tol)
 {
   Vector<T, 2> V1(q, c0);
   Vector<T, 2> V2(q, c1);
@@ -86,11 +86,12 @@ double linear_winding_number(const Point<T, 2>& q,
  * 
  * \return double The winding number
  */
-template <typename T>
-double convex_endpoint_winding_number(const Point<T, 2>& q,
-                                      const BezierCurve<T, 2>& c,
-                                      double edge_tol,
-                                      double EPS)
+template <typename T, int MAX_ORDER>
+AXOM_HOST_DEVICE double convex_endpoint_winding_number(
+  const Point<T, 2>& q,
+  const BezierCurve<T, 2, MAX_ORDER>& c,
+  double edge_tol,
+  double EPS)
 {
   const int ord = c.getOrder();
   if(ord == 1) return 0;
@@ -98,7 +99,7 @@ double convex_endpoint_winding_number(const Point<T, 2>& q,
   double edge_tol_sq = edge_tol * edge_tol;
 
   // Verify that the shape is convex, and that the query point is at an endpoint
-  SLIC_ASSERT(is_convex(Polygon<T, 2>(c.getControlPoints()), EPS));
+  SLIC_ASSERT(is_convex_polygon<T>(c, ord + 1, EPS));
   SLIC_ASSERT((squared_distance(q, c[0]) <= edge_tol_sq) ||
               (squared_distance(q, c[ord]) <= edge_tol_sq));
 
@@ -170,14 +171,19 @@ double convex_endpoint_winding_number(const Point<T, 2>& q,
  * each half. Use the proximity of the query point to endpoints and approximate
  * linearity of the Bezier curve as base cases.
  * 
+ * The control points of the curve are used directly as its control polygon,
+ * and the halves of a BezierCurve with a fixed MAX_ORDER are split on the
+ * stack, so the recursion does not allocate memory for such curves.
+ *
  * \return double The winding number.
  */
-template <typename T>
-double adaptive_winding_number(const Point<T, 2>& q,
-                               const BezierCurve<T, 2>& c,
-                               bool isConvexControlPolygon,
-                               double edge_tol = 1e-8,
-                               double EPS = 1e-8)
+template <typename T, int MAX_ORDER>
+AXOM_HOST_DEVICE double adaptive_winding_number(
+  const Point<T, 2>& q,
+  const BezierCurve<T, 2, MAX_ORDER>& c,
+  bool isConvexControlPolygon,
+  double edge_tol = 1e-8,
+  double EPS = 1e-8)
 {
   const int ord = c.getOrder();
   if(ord <= 0) return 0.0;  // Catch degenerate cases
@@ -185,20 +191,18 @@ double adaptive_winding_number(const Point<T, 2>& q,
   // Use linearity as base case for recursion
   if(c.isLinear(EPS)) return linear_winding_number(q, c[0], c[ord], edge_tol);
 
-  Polygon<T, 2> controlPolygon(c.getControlPoints());
-
   // Check if our new curve is convex.
   //  If so, all subcurves will be convex as well
   if(!isConvexControlPolygon)
   {
-    isConvexControlPolygon = is_convex(controlPolygon, EPS);
+    isConvexControlPolygon = is_convex_polygon<T>(c, ord + 1, EPS);
   }
   else  // Formulas for winding number only work if shape is convex
   {
     // If q is outside the control polygon, for an open Bezier curve, the winding
     //  number for the shape connected at the endpoints with straight lines is zero.
     //  We then subtract the contribution of this line segment.
-    if(!in_polygon(q, controlPolygon, true, false, EPS))
+    if(polygon_winding_number(q, c, ord + 1, false, EPS) == 0)
       return 0.0 - linear_winding_number(q, c[ord], c[0], edge_tol);
 
     // If the query point is at either endpoint, use direct formula
@@ -208,7 +212,7 @@ double adaptive_winding_number(const Point<T, 2>& q,
   }
 
   // Recursively split curve until query is outside each control polygon
-  BezierCurve<T, 2> c1, c2;
+  BezierCurve<T, 2, MAX_ORDER> c1, c2;
   c.split(0.5, c1, c2);
 
   return adaptive_winding_number(q, c1, isConvexControlPolygon, edge_tol, EPS) +
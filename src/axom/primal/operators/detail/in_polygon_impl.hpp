@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PRIMAL_IN_POLYGON_IMPL_HPP_
+#define AXOM_PRIMAL_IN_POLYGON_IMPL_HPP_
+
+// Axom includes
+#include "axom/config.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/core/numerics/Determinants.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/*!
+ * \brief Computes the winding number for a point and the polygon
+ *  with the given vertices
+ *
+ * \param [in] R The query point to test
+ * \param [in] P The vertices of the polygon, with P[i] a Point<T, 2>
+ * \param [in] nverts The number of vertices of the polygon
+ * \param [in] useStrictInclusion If true, points on the boundary are
+ *  considered exterior.
+ * \param [in] EPS The tolerance level for collinearity
+ *
+ * Implements primal::winding_number() for any indexable set of vertices,
+ * such as the control points of a BezierCurve.
+ *
+ * \return The integer winding number
+ */
+template <typename T, typename PointArray>
+AXOM_SUPPRESS_HD_WARN
+AXOM_HOST_DEVICE int polygon_winding_number(const Point<T, 2>& R,
+                                            const PointArray& P,
+                                            int nverts,
+                                            bool useStrictInclusion,
+                                            double EPS)
+{
+  // If the query is a vertex, return a value interpreted
+  //  as "inside" by evenodd or nonzero protocols
+  if(axom::utilities::isNearlyEqual(P[0][0], R[0], EPS) &&
+     axom::utilities::isNearlyEqual(P[0][1], R[1], EPS))
+    return !useStrictInclusion;
+
+  int winding_num = 0;
+  for(int i = 0; i < nverts; i++)
+  {
+    int j = (i == nverts - 1) ? 0 : i + 1;
+
+    if(axom::utilities::isNearlyEqual(P[j][1], R[1], EPS))
+    {
+      if(axom::utilities::isNearlyEqual(P[j][0], R[0], EPS))
+        return !useStrictInclusion;  // On vertex
+      else if(P[i][1] == R[1] && ((P[j][0] > R[0]) == (P[i][0] < R[0])))
+        return !useStrictInclusion;  // On horizontal edge
+    }
+
+    // Check if edge crosses horizontal line
+    if((P[i][1] < R[1]) != (P[j][1] < R[1]))
+    {
+      double det;
+      if(P[i][0] >= R[0])
+      {
+        if(P[j][0] > R[0])
+          winding_num += 2 * (P[j][1] > P[i][1]) - 1;
+        else
+        {
+          // clang-format off
+          det = axom::numerics::determinant(P[i][0] - R[0], P[j][0] - R[0],
+                                            P[i][1] - R[1], P[j][1] - R[1]);
+          // clang-format on
+
+          // On edge
+          if(axom::utilities::isNearlyEqual(det, 0.0, EPS))
+            return !useStrictInclusion;
+
+          // Check if edge intersects horitonal ray to the right of R
+          if((det > 0) == (P[j][1] > P[i][1]))
+            winding_num += 2 * (P[j][1] > P[i][1]) - 1;
+        }
+      }
+      else
+      {
+        if(P[j][0] > R[0])
+        {
+          // clang-format off
+          det = axom::numerics::determinant(P[i][0] - R[0], P[j][0] - R[0],
+                                            P[i][1] - R[1], P[j][1] - R[1]);
+          // clang-format on
+
+          // On edge
+          if(axom::utilities::isNearlyEqual(det, 0.0, EPS))
+            return !useStrictInclusion;
+
+          // Check if edge intersects horitonal ray to the right of R
+          if((det > 0) == (P[j][1] > P[i][1]))
+            winding_num += 2 * (P[j][1] > P[i][1]) - 1;
+        }
+      }
+    }
+  }
+
+  return winding_num;
+}
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_IN_POLYGON_IMPL_HPP_
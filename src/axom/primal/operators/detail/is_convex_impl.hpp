@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PRIMAL_IS_CONVEX_IMPL_HPP_
+#define AXOM_PRIMAL_IS_CONVEX_IMPL_HPP_
+
+#include "axom/primal/geometry/Segment.hpp"
+#include "axom/primal/operators/orientation.hpp"
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/*!
+ * \brief Determines if the polygon with the given ordered vertices is convex
+ *
+ * \param [in] poly The vertices of the polygon, with poly[i] a Point<T, 2>
+ * \param [in] nverts The number of vertices of the polygon
+ *
+ * Implements primal::is_convex() for any indexable set of vertices,
+ * such as the control points of a BezierCurve.
+ *
+ * \return A boolean value indicating convexity
+ */
+template <typename T, typename PointArray>
+AXOM_SUPPRESS_HD_WARN
+AXOM_HOST_DEVICE bool is_convex_polygon(const PointArray& poly,
+                                        int nverts,
+                                        double EPS)
+{
+  int n = nverts - 1;
+  if(n + 1 < 3) return true;  // Triangles and lines are convex
+
+  for(int i = 1; i < n; i++)
+  {
+    // For each non-endpoint, check if that point and one of the endpoints
+    //  are on the same side as the segment connecting the adjacent nodes
+    Segment<T, 2> seg(poly[i - 1], poly[i + 1]);
+    int res1 = orientation(poly[i], seg, EPS);
+
+    // Edge case
+    if(res1 == primal::ON_BOUNDARY) continue;
+
+    // Ensure other point to check against isn't adjacent
+    if(res1 == orientation(poly[(i < n / 2) ? n : 0], seg, EPS)) return false;
+  }
+
+  return true;
+}
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_IS_CONVEX_IMPL_HPP_
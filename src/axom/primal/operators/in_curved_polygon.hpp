@@ -98,14 +98,17 @@ double winding_number(const Point<T, 2>& q,
  *
  * Computes the winding number using a recursive, bisection algorithm,
  * using nearly-linear Bezier curves as a base case.
+ *
+ * \note For a BezierCurve with a fixed MAX_ORDER, this function does not
+ *  allocate memory and may be called in device kernels.
  * 
  * \return float the generalized winding number.
  */
-template <typename T>
-double winding_number(const Point<T, 2>& q,
-                      const BezierCurve<T, 2>& c,
-                      double edge_tol = 1e-8,
-                      double EPS = 1e-8)
+template <typename T, int MAX_ORDER>
+AXOM_HOST_DEVICE double winding_number(const Point<T, 2>& q,
+                                       const BezierCurve<T, 2, MAX_ORDER>& c,
+                                       double edge_tol = 1e-8,
+                                       double EPS = 1e-8)
 {
   return detail::adaptive_winding_number(q, c, false, edge_tol, EPS);
 }
@@ -21,6 +21,8 @@
 #include "axom/primal/geometry/Point.hpp"
 #include "axom/primal/geometry/Polygon.hpp"
 
+#include "axom/primal/operators/detail/in_polygon_impl.hpp"
+
 // C++ includes
 #include <cmath>
 
@@ -51,73 +53,11 @@ int winding_number(const Point<T, 2>& R,
                    bool useStrictInclusion = false,
                    double EPS = 1e-8)
 {
-  const int nverts = P.numVertices();
-
-  // If the query is a vertex, return a value interpreted
-  //  as "inside" by evenodd or nonzero protocols
-  if(axom::utilities::isNearlyEqual(P[0][0], R[0], EPS) &&
-     axom::utilities::isNearlyEqual(P[0][1], R[1], EPS))
-    return !useStrictInclusion;
-
-  int winding_num = 0;
-  for(int i = 0; i < nverts; i++)
-  {
-    int j = (i == nverts - 1) ? 0 : i + 1;
-
-    if(axom::utilities::isNearlyEqual(P[j][1], R[1], EPS))
-    {
-      if(axom::utilities::isNearlyEqual(P[j][0], R[0], EPS))
-        return !useStrictInclusion;  // On vertex
-      else if(P[i][1] == R[1] && ((P[j][0] > R[0]) == (P[i][0] < R[0])))
-        return !useStrictInclusion;  // On horizontal edge
-    }
-
-    // Check if edge crosses horizontal line
-    if((P[i][1] < R[1]) != (P[j][1] < R[1]))
-    {
-      double det;
-      if(P[i][0] >= R[0])
-      {
-        if(P[j][0] > R[0])
-          winding_num += 2 * (P[j][1] > P[i][1]) - 1;
-        else
-        {
-          // clang-format off
-          det = axom::numerics::determinant(P[i][0] - R[0], P[j][0] - R[0],
-                                            P[i][1] - R[1], P[j][1] - R[1]);
-          // clang-format on
-
-          // On edge
-          if(axom::utilities::isNearlyEqual(det, 0.0, EPS))
-            return !useStrictInclusion;
-
-          // Check if edge intersects horitonal ray to the right of R
-          if((det > 0) == (P[j][1] > P[i][1]))
-            winding_num += 2 * (P[j][1] > P[i][1]) - 1;
-        }
-      }
-      else
-      {
-        if(P[j][0] > R[0])
-        {
-          // clang-format off
-          det = axom::numerics::determinant(P[i][0] - R[0], P[j][0] - R[0],
-                                            P[i][1] - R[1], P[j][1] - R[1]);
-          // clang-format on
-
-          // On edge
-          if(axom::utilities::isNearlyEqual(det, 0.0, EPS))
-            return !useStrictInclusion;
-
-          // Check if edge intersects horitonal ray to the right of R
-          if((det > 0) == (P[j][1] > P[i][1]))
-            winding_num += 2 * (P[j][1] > P[i][1]) - 1;
-        }
-      }
-    }
-  }
-
-  return winding_num;
+  return detail::polygon_winding_number(R,
+                                        P,
+                                        P.numVertices(),
+                                        useStrictInclusion,
+                                        EPS);
 }
 
 /*!
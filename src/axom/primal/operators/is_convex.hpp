@@ -10,6 +10,8 @@
 #include "axom/primal/geometry/Polygon.hpp"
 #include "axom/primal/operators/orientation.hpp"
 
+#include "axom/primal/operators/detail/is_convex_impl.hpp"
+
 namespace axom
 {
 namespace primal
@@ -34,24 +36,7 @@ namespace primal
 template <typename T>
 bool is_convex(const Polygon<T, 2>& poly, double EPS = 1e-8)
 {
-  int n = poly.numVertices() - 1;
-  if(n + 1 < 3) return true;  // Triangles and lines are convex
-
-  for(int i = 1; i < n; i++)
-  {
-    // For each non-endpoint, check if that point and one of the endpoints
-    //  are on the same side as the segment connecting the adjacent nodes
-    Segment<T, 2> seg(poly[i - 1], poly[i + 1]);
-    int res1 = orientation(poly[i], seg, EPS);
-
-    // Edge case
-    if(res1 == primal::ON_BOUNDARY) continue;
-
-    // Ensure other point to check against isn't adjacent
-    if(res1 == orientation(poly[(i < n / 2) ? n : 0], seg, EPS)) return false;
-  }
-
-  return true;
+  return detail::is_convex_polygon<T>(poly, poly.numVertices(), EPS);
 }
 
 }  // namespace primal
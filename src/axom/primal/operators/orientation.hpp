@@ -89,9 +89,9 @@ inline int orientation(const Point<T, 3>& p,
  * \sa OrientationResult
  */
 template <typename T>
-inline int orientation(const Point<T, 2>& p,
-                       const Segment<T, 2>& seg,
-                       double EPS = 1e-9)
+AXOM_HOST_DEVICE inline int orientation(const Point<T, 2>& p,
+                                        const Segment<T, 2>& seg,
+                                        double EPS = 1e-9)
 {
   const Vector<T, 2> A(p, seg[0]);
   const Vector<T, 2> B(p, seg[1]);
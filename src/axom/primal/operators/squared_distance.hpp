@@ -142,8 +142,8 @@ AXOM_HOST_DEVICE inline double squared_distance(const BoundingBox<T, NDIMS>& A,
  * \return the minimum squared-distance from P to the segment S.
  */
 template <typename T, int NDIMS>
-inline double squared_distance(const Point<T, NDIMS>& P,
-                               const Segment<T, NDIMS>& S)
+AXOM_HOST_DEVICE inline double squared_distance(const Point<T, NDIMS>& P,
+                                                const Segment<T, NDIMS>& S)
 {
   Vector<T, NDIMS> ab(S.source(), S.target());
   Vector<T, NDIMS> ac(S.source(), P);
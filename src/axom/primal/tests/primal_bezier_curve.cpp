@@ -492,6 +492,90 @@ TEST(primal_beziercurve, reverseOrientation)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(primal_beziercurve, fixed_order)
+{
+  SLIC_INFO("Testing Bezier curves with a fixed maximum order");
+
+  const int DIM = 3;
+  const int MAX_ORDER = 4;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using BezierCurveType = primal::BezierCurve<CoordType, DIM>;
+  using FixedBezierCurveType = primal::BezierCurve<CoordType, DIM, MAX_ORDER>;
+
+  EXPECT_EQ(MAX_ORDER, FixedBezierCurveType().getOrder());
+
+  PointType data[MAX_ORDER + 1] = {PointType {0.6, 1.2, 1.0},
+                                   PointType {1.3, 1.6, 1.8},
+                                   PointType {2.9, 2.4, 2.3},
+                                   PointType {3.2, 3.5, 3.0},
+                                   PointType {3.9, 3.1, 2.2}};
+  CoordType weights[MAX_ORDER + 1] = {1.0, 2.0, 0.5, 1.5, 1.0};
+
+  // Curves of any order up to MAX_ORDER match the dynamic curves
+  for(int order = 0; order <= MAX_ORDER; ++order)
+  {
+    for(bool rational : {false, true})
+    {
+      BezierCurveType curve =
+        rational ? BezierCurveType(data, weights, order)
+                 : BezierCurveType(data, order);
+      FixedBezierCurveType fixedCurve =
+        rational ? FixedBezierCurveType(data, weights, order)
+                 : FixedBezierCurveType(data, order);
+
+      EXPECT_EQ(curve.getOrder(), fixedCurve.getOrder());
+      EXPECT_EQ(curve.isRational(), fixedCurve.isRational());
+      EXPECT_EQ(curve.isLinear(), fixedCurve.isLinear());
+
+      for(double t : {0., 0.3, 0.5, 1.})
+      {
+        auto pt = curve.evaluate(t);
+        auto fixedPt = fixedCurve.evaluate(t);
+        for(int i = 0; i < DIM; ++i)
+        {
+          EXPECT_DOUBLE_EQ(pt[i], fixedPt[i]);
+        }
+
+        // Tangents are defined for curves of order one or more
+        if(order > 0)
+        {
+          auto tangent = curve.dt(t);
+          auto fixedTangent = fixedCurve.dt(t);
+          for(int i = 0; i < DIM; ++i)
+          {
+            EXPECT_DOUBLE_EQ(tangent[i], fixedTangent[i]);
+          }
+        }
+      }
+
+      BezierCurveType c1, c2;
+      FixedBezierCurveType fixedC1, fixedC2;
+      curve.split(0.3, c1, c2);
+      fixedCurve.split(0.3, fixedC1, fixedC2);
+      ASSERT_EQ(c1.getOrder(), fixedC1.getOrder());
+      ASSERT_EQ(c2.getOrder(), fixedC2.getOrder());
+      for(int p = 0; p <= order; ++p)
+      {
+        EXPECT_EQ(c1[p], fixedC1[p]);
+        EXPECT_EQ(c2[p], fixedC2[p]);
+        if(rational)
+        {
+          EXPECT_DOUBLE_EQ(c1.getWeight(p), fixedC1.getWeight(p));
+          EXPECT_DOUBLE_EQ(c2.getWeight(p), fixedC2.getWeight(p));
+        }
+      }
+
+      FixedBezierCurveType reversed = fixedCurve;
+      reversed.reverseOrientation();
+      EXPECT_NE(order > 0, reversed == fixedCurve);
+      reversed.reverseOrientation();
+      EXPECT_EQ(fixedCurve, reversed);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 
 int main(int argc, char* argv[])
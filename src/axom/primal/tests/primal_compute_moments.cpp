@@ -235,6 +235,58 @@ TEST(primal_compute_moments, sector_weights)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(primal_compute_moments, fixed_order_moments)
+{
+  SLIC_INFO("Testing moments of Bezier curves with a fixed maximum order");
+
+  const int DIM = 2;
+  const int MAX_ORDER = 5;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using BezierCurveType = primal::BezierCurve<CoordType, DIM>;
+  using FixedBezierCurveType = primal::BezierCurve<CoordType, DIM, MAX_ORDER>;
+  using CurvedPolygonType = primal::CurvedPolygon<CoordType, DIM>;
+
+  PointType data[MAX_ORDER + 1] = {PointType {0.6, 1.2},
+                                   PointType {1.3, 1.6},
+                                   PointType {2.9, 2.4},
+                                   PointType {3.2, 3.5},
+                                   PointType {2.1, 4.0},
+                                   PointType {1.5, 3.3}};
+
+  // The sector moments match those of dynamic curves for any order
+  for(int order = 0; order <= MAX_ORDER; ++order)
+  {
+    BezierCurveType curve(data, order);
+    FixedBezierCurveType fixedCurve(data, order);
+
+    EXPECT_NEAR(primal::sector_area(curve),
+                primal::sector_area(fixedCurve),
+                EPS);
+
+    PointType centroid = primal::sector_centroid(curve);
+    PointType fixedCentroid = primal::sector_centroid(fixedCurve);
+    for(int i = 0; i < DIM; ++i)
+    {
+      EXPECT_NEAR(centroid[i], fixedCentroid[i], 10 * EPS);
+    }
+  }
+
+  // The area of a curved polygon is the sum of the sector areas of its edges
+  PointType closing[2] = {data[MAX_ORDER], data[0]};
+  BezierCurveType edges[2] = {BezierCurveType(data, MAX_ORDER),
+                              BezierCurveType(closing, 1)};
+  CurvedPolygonType poly(edges, 2);
+  FixedBezierCurveType fixedEdges[2] = {FixedBezierCurveType(data, MAX_ORDER),
+                                        FixedBezierCurveType(closing, 1)};
+
+  EXPECT_NEAR(primal::area(poly),
+              primal::sector_area(fixedEdges[0]) +
+                primal::sector_area(fixedEdges[1]),
+              EPS);
+}
+
 //------------------------------------------------------------------------------
 
 int main(int argc, char* argv[])
@@ -439,6 +439,93 @@ TEST(primal_winding_number, degenerate_cases)
     abs_tol);
 }
 
+template <typename ExecPolicy>
+void check_fixed_order_winding_number()
+{
+  // Test that curves with a fixed maximum order give the same winding numbers
+  //  as dynamic curves when evaluated in a kernel
+  using Point2D = primal::Point<double, 2>;
+  using Bezier = primal::BezierCurve<double, 2>;
+  using FixedBezier = primal::BezierCurve<double, 2, 3>;
+  using CPolygon = primal::CurvedPolygon<double, 2>;
+
+  double abs_tol = 1e-8;
+  double edge_tol = 1e-8;
+  double EPS = primal::PRIMAL_TINY;
+
+  // Closed shape with a cubic, a quadratic and a linear edge
+  Point2D top_nodes[] = {Point2D {0.0, 0.0},
+                         Point2D {0.0, 1.0},
+                         Point2D {-1.0, 1.0},
+                         Point2D {-1.0, 0.0}};
+  Point2D bot_nodes[] = {Point2D {-1.0, 0.0},
+                         Point2D {-1.0, -1.0},
+                         Point2D {0.0, -1.0}};
+  Point2D side_nodes[] = {Point2D {0.0, -1.0}, Point2D {0.0, 0.0}};
+  Bezier shape_edges[] = {Bezier(top_nodes, 3),
+                          Bezier(bot_nodes, 2),
+                          Bezier(side_nodes, 1)};
+  CPolygon shape(shape_edges, 3);
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecPolicy>::allocatorID());
+
+  constexpr int NUM_EDGES = 3;
+  constexpr int RES = 41;
+  axom::Array<FixedBezier> edges(NUM_EDGES);
+  edges[0] = FixedBezier(top_nodes, 3);
+  edges[1] = FixedBezier(bot_nodes, 2);
+  edges[2] = FixedBezier(side_nodes, 1);
+
+  axom::Array<Point2D> queries(RES * RES);
+  for(int j = 0; j < RES; ++j)
+  {
+    for(int i = 0; i < RES; ++i)
+    {
+      queries[j * RES + i] =
+        Point2D {-1.5 + 2. * i / (RES - 1), -1.5 + 2. * j / (RES - 1)};
+    }
+  }
+
+  axom::Array<double> winding(RES * RES);
+  const auto edges_v = edges.view();
+  const auto queries_v = queries.view();
+  const auto winding_v = winding.view();
+  axom::for_all<ExecPolicy>(
+    RES * RES,
+    AXOM_LAMBDA(axom::IndexType idx) {
+      double wn = 0.;
+      for(int e = 0; e < NUM_EDGES; ++e)
+      {
+        wn += winding_number(queries_v[idx], edges_v[e], edge_tol, EPS);
+      }
+      winding_v[idx] = wn;
+    });
+
+  for(int idx = 0; idx < RES * RES; ++idx)
+  {
+    EXPECT_NEAR(winding[idx],
+                winding_number(queries[idx], shape, edge_tol, EPS),
+                abs_tol);
+    EXPECT_EQ(std::lround(winding[idx]) != 0,
+              in_curved_polygon(queries[idx], shape, true, edge_tol, EPS));
+  }
+
+  axom::setDefaultAllocator(current_allocator);
+}
+
+TEST(primal_winding_number, fixed_order_sequential)
+{
+  check_fixed_order_winding_number<axom::SEQ_EXEC>();
+}
+
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+TEST(primal_winding_number, fixed_order_omp)
+{
+  check_fixed_order_winding_number<axom::OMP_EXEC>();
+}
+#endif
+
 int main(int argc, char** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -90,7 +90,10 @@ void all_nearest_neighbors(const double* x,
         {
           double sqdist =
             detail::squared_distance(x[i], y[i], z[i], x[j], y[j], z[j]);
-          if(sqdist < sqdistance[i] && sqdist < sqlimit)
+          // Resolve ties to the lowest index, independent of the bin order
+          bool isCloser = sqdist < sqdistance[i] ||
+            (sqdist == sqdistance[i] && j < neighbor[i]);
+          if(isCloser && sqdist < sqlimit)
           {
             sqdistance[i] = sqdist;
             neighbor[i] = j;
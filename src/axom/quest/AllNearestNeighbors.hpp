@@ -11,6 +11,11 @@
 #ifndef AXOM_QUEST_ALL_NEAREST_NEIGHBORS_HPP_
 #define AXOM_QUEST_ALL_NEAREST_NEIGHBORS_HPP_
 
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/spin/UniformGrid.hpp"
+#include "axom/quest/detail/AllNearestNeighbors_detail.hpp"
+
 namespace axom
 {
 namespace quest
@@ -42,7 +47,8 @@ enum SearchStatus
  * index. Then for each point p, it gets the UniformGrid bins that overlap
  * the box (p - (limit, limit, limit), p + (limit, limit, limit).  The method
  * compares p to each point in this list of bins and returns the index of the
- * closest point.
+ * closest point. Ties between neighbors at equal distance are resolved to the
+ * lowest index.
  *
  * We expect the use of the UniformGrid  will result in a substantial time
  * savings over a brute-force all-to-all algorithm, but the query's run time
@@ -57,6 +63,116 @@ void all_nearest_neighbors(const double* x,
                            int* neighbor,
                            double* sqdistance);
 
+/*!
+ * \brief Given a list of point locations and regions, for each point, find
+ *   the closest point in a different region within a given search radius,
+ *   in parallel in the given execution space.
+ *
+ * \tparam ExecSpace the execution space of the queries
+ *
+ * \param [in] x X-coordinates of input points
+ * \param [in] y Y-coordinates of input points
+ * \param [in] z Z-coordinates of input points
+ * \param [in] region Region of each point
+ * \param [in] n Number of points
+ * \param [in] limit Max distance for all-nearest-neighbors query
+ * \param [out] neighbor Index of nearest neighbor not in the same class
+ *    (or NEIGHBOR_NOT_FOUND)
+ * \param [out] sqdistance Squared distance to nearest neighbor
+ * \pre x, y, z, and region have n entries
+ * \pre neighbor and sqdistance are allocated with room for n entries
+ * \pre all arrays are accessible from ExecSpace
+ *
+ * This method inserts copies of the points into a UniformGrid in ExecSpace,
+ * whose bins are about limit wide, and then queries the points of each bin in
+ * parallel, visiting the points of the bins that overlap the box of
+ * half-width limit around each query without allocating memory. Ties between
+ * neighbors at equal distance are resolved to the lowest index, so that the
+ * results match a brute-force search. Points without a neighbor get a squared
+ * distance of DBL_MAX.
+ */
+template <typename ExecSpace>
+void all_nearest_neighbors(const double* x,
+                           const double* y,
+                           const double* z,
+                           const int* region,
+                           IndexType n,
+                           double limit,
+                           IndexType* neighbor,
+                           double* sqdistance)
+{
+  AXOM_PERF_MARK_FUNCTION("all_nearest_neighbors");
+
+  using CandidateType = detail::CandidatePoint;
+  using GridStorage = spin::policy::FlatGridStorage<CandidateType>;
+  using GridType = spin::UniformGrid<CandidateType, 3, ExecSpace, GridStorage>;
+  using BoxType = typename GridType::BoxType;
+  using PointType = typename GridType::PointType;
+
+  if(n <= 0)
+  {
+    return;
+  }
+
+  const int allocatorID = axom::execution_space<ExecSpace>::allocatorID();
+
+  // 1. Build an index over the points, with bins about limit wide. The bins
+  // hold copies of the points, so that scanning a bin reads contiguous memory
+  const auto bounds = detail::points_bounds<ExecSpace>(x, y, z, n);
+  const auto resolution = detail::grid_resolution(bounds, limit, n);
+  GridType grid(bounds, resolution.data(), allocatorID);
+  {
+    axom::Array<BoxType> boxes(n, n, allocatorID);
+    axom::Array<CandidateType> points(n, n, allocatorID);
+    const auto boxes_v = boxes.view();
+    const auto points_v = points.view();
+    for_all<ExecSpace>(
+      n,
+      AXOM_LAMBDA(IndexType i) {
+        boxes_v[i] = BoxType {PointType {x[i], y[i], z[i]}};
+        points_v[i] = CandidateType {x[i], y[i], z[i], i, region[i]};
+      });
+    grid.initialize(boxes.view(), points.view());
+  }
+  const auto gridQuery = grid.getQueryObject();
+
+  // 2. For each point, compare with the points of the overlapped bins. The
+  // points are queried bin by bin, so that nearby queries share candidates
+  const double sqlimit = limit * limit;
+  for_all<ExecSpace>(
+    gridQuery.getNumBins(),
+    AXOM_LAMBDA(IndexType ibin) {
+      const auto queries = gridQuery.getBinContents(ibin);
+      for(IndexType iquery = 0; iquery < queries.size(); ++iquery)
+      {
+        const CandidateType& q = queries[iquery];
+        const BoxType queryBox(
+          PointType {q.x - limit, q.y - limit, q.z - limit},
+          PointType {q.x + limit, q.y + limit, q.z + limit});
+
+        double minsqdist = axom::numerics::floating_point_limits<double>::max();
+        IndexType closest = NEIGHBOR_NOT_FOUND;
+        gridQuery.visitCandidates(queryBox, [&](const CandidateType& c) {
+          if(c.region != q.region)
+          {
+            const double sqdist =
+              detail::squared_distance(q.x, q.y, q.z, c.x, c.y, c.z);
+            const bool isCloser = sqdist < minsqdist ||
+              (sqdist == minsqdist && c.index < closest);
+            if(sqdist < sqlimit && isCloser)
+            {
+              minsqdist = sqdist;
+              closest = c.index;
+            }
+          }
+        });
+
+        neighbor[q.index] = closest;
+        sqdistance[q.index] = minsqdist;
+      }
+    });
+}
+
 /// @}
 
 }  // end namespace quest
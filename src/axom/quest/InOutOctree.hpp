@@ -20,13 +20,17 @@
 #include "axom/spin.hpp"
 
 #include "detail/inout/BlockData.hpp"
+#include "detail/inout/GrayBlockContainment.hpp"
 #include "detail/inout/MeshWrapper.hpp"
 #include "detail/inout/InOutOctreeValidator.hpp"
 #include "detail/inout/InOutOctreeStats.hpp"
+#include "detail/inout/InOutOctreeSerializer.hpp"
+#include "detail/inout/FlatInOutOctree.hpp"
 
 #include "axom/fmt.hpp"
 
 #include <vector>
+#include <algorithm>
 #include <iterator>
 #include <limits>
 #include <sstream>
@@ -91,6 +95,9 @@ class InOutOctree : public spin::SpatialOctree<DIM, InOutBlockData>
 private:
   friend class detail::InOutOctreeStats<DIM>;
   friend class detail::InOutOctreeValidator<DIM>;
+  friend class detail::InOutOctreeSerializer<DIM>;
+  template <int TDIM, typename ExecSpace>
+  friend class FlatInOutOctree;
   friend class detail::InOutOctreeMeshDumper<DIM>;
   friend class detail::InOutOctreeMeshDumperBase<DIM, detail::InOutOctreeMeshDumper<DIM>>;
 
@@ -124,6 +131,7 @@ public:
   using VertexIndex = axom::IndexType;
   using CellIndex = axom::IndexType;
   using IndexRegistry = slam::FieldRegistry<slam::Set<VertexIndex>, VertexIndex>;
+  using IndexBuffer = typename IndexRegistry::BufferType;
 
   using SpaceCell = typename MeshWrapper<DIM>::SpaceCell;
 
@@ -195,6 +203,34 @@ public:
    */
   void generateIndex();
 
+  /**
+   * \brief Saves the generated spatial index to a binary file
+   *
+   * \param [in] fileName The name of the file to write
+   * \return True if the file was written, false otherwise
+   * \pre The index was generated or loaded
+   * \sa loadIndex()
+   */
+  bool saveIndex(const std::string& fileName) const;
+
+  /**
+   * \brief Loads a spatial index saved by saveIndex(), as an alternative
+   * to generateIndex()
+   *
+   * \param [in] fileName The name of the file to read
+   * \return True if the index was loaded, false otherwise
+   *
+   * The file is only loaded if it was saved from an InOutOctree with the
+   * same bounding box and vertex welding threshold over a surface mesh with
+   * the same hash as this instance's mesh. Otherwise, a warning is logged,
+   * the octree is left unchanged and the caller can call generateIndex().
+   *
+   * \note As with generateIndex(), the surface mesh is replaced by the
+   * welded mesh from the saved index.
+   * \pre Neither generateIndex() nor loadIndex() has been called
+   */
+  bool loadIndex(const std::string& fileName);
+
   /**
    * \brief The point containment query.
    *
@@ -204,6 +240,41 @@ public:
    */
   bool within(const SpacePt& pt) const;
 
+  /**
+   * \brief Timing and leaf-visit statistics for a batch of point containment
+   * queries
+   */
+  struct QueryStatistics
+  {
+    axom::IndexType numQueries {0};
+    axom::IndexType numOutside {0};  ///< Outside the octree bounding box
+    axom::IndexType numBlack {0};    ///< Answered by an inside (black) leaf
+    axom::IndexType numWhite {0};    ///< Answered by an outside (white) leaf
+    axom::IndexType numGray {0};     ///< Tested against the surface in a leaf
+    double sortTime {0.};            ///< Seconds spent sorting the queries
+    double queryTime {0.};           ///< Seconds spent evaluating the queries
+  };
+
+  /**
+   * \brief The batched point containment query.
+   *
+   * \param [in] pts The points at which we are checking for containment
+   * \param [out] results Whether each point is within (or on) the surface
+   * \return Timing and leaf-visit statistics for the batch of queries
+   *
+   * The queries are sorted by the Morton code of their points, so that
+   * nearby points, which visit the same blocks of the octree, are evaluated
+   * together. The sorted queries are then evaluated in parallel.
+   *
+   * \tparam ExecSpace A host execution space, e.g. SEQ_EXEC or OMP_EXEC
+   *
+   * \pre results.size() >= pts.size()
+   * \note Points outside the octree bounding box are considered outside
+   */
+  template <typename ExecSpace = axom::SEQ_EXEC>
+  QueryStatistics within(axom::ArrayView<const SpacePt> pts,
+                         axom::ArrayView<bool> results) const;
+
   /**
    * \brief Sets the threshold for welding vertices during octree construction
    *
@@ -234,6 +305,17 @@ public:
   }
 
 private:
+  /**
+   * \brief Cached data for the children of a block whose cells are being
+   * distributed during insertMeshCells()
+   */
+  struct ChildBlockCache
+  {
+    BlockIndex childBlk[BlockIndex::NUM_CHILDREN];
+    GeometricBoundingBox childBB[BlockIndex::NUM_CHILDREN];
+    DynamicGrayBlockData childData[BlockIndex::NUM_CHILDREN];
+  };
+
   /**
    * \brief Helper function to insert a vertex into the octree
    *
@@ -245,6 +327,10 @@ private:
 
   /**
    * \brief Insert all mesh cells into the octree, generating a PM octree
+   *
+   * \note When Axom is configured with OpenMP, the intersection tests at
+   * each level are performed in parallel. The resulting octree is identical
+   * to the one from a serial insertion.
    */
   void insertMeshCells();
 
@@ -265,6 +351,21 @@ private:
    */
   void updateSurfaceMeshVertices();
 
+  /**
+   * \brief Creates the relations from the gray leaves at level \a lev to
+   * the mesh vertices and elements
+   *
+   * \param lev The level of the octree
+   * \param gvRelData The index of the vertex of each gray leaf
+   * \param geIndRelData The indices of the elements of the gray leaves
+   * \param geSizeRelData The offsets of each gray leaf into \a geIndRelData
+   * \note The buffers must outlive the relations, e.g. in m_indexRegistry
+   */
+  void bindGrayLeafRelations(int lev,
+                             IndexBuffer& gvRelData,
+                             IndexBuffer& geIndRelData,
+                             IndexBuffer& geSizeRelData);
+
 private:
   /**
    * \brief Checks if all indexed cells in the block share a common vertex
@@ -326,34 +427,30 @@ private:
   }
 
   /**
-   * \brief Determines whether the specified 3D point is within the gray leaf
+   * \brief Determines whether the specified point is within the leaf block
    *
    * \param queryPt The point we are querying
-   * \param leafBlk The block of the gray leaf
-   * \param data The data associated with the leaf block
-   * \return True, if the point is inside the local surface associated with this
-   * block, false otherwise
+   * \param leafBlk The leaf block containing \a queryPt
+   * \param leafData The data associated with the leaf block
+   * \return True, if the point is inside the surface, false otherwise
    */
-  template <int TDIM>
-  typename std::enable_if<TDIM == 3, bool>::type withinGrayBlock(
-    const SpacePt& queryPt,
-    const BlockIndex& leafBlk,
-    const InOutBlockData& data) const;
+  bool withinLeafBlock(const SpacePt& queryPt,
+                       const BlockIndex& leafBlk,
+                       const InOutBlockData& leafData) const;
 
   /**
-   * \brief Determines whether the specified 2D point is within the gray leaf
+   * \brief Determines whether the specified point is within the gray leaf
    *
    * \param queryPt The point we are querying
    * \param leafBlk The block of the gray leaf
    * \param data The data associated with the leaf block
    * \return True, if the point is inside the local surface associated with this
    * block, false otherwise
+   * \sa detail::withinGrayBlock()
    */
-  template <int TDIM = DIM>
-  typename std::enable_if<TDIM == 2, bool>::type withinGrayBlock(
-    const SpacePt& queryPt,
-    const BlockIndex& leafBlk,
-    const InOutBlockData& data) const;
+  bool withinGrayBlock(const SpacePt& queryPt,
+                       const BlockIndex& leafBlk,
+                       const InOutBlockData& data) const;
 
   /**
    * \brief Returns the index of the mesh vertex associated with the given leaf block
@@ -615,7 +712,12 @@ void InOutOctree<DIM>::insertMeshCells()
   }
 
   // Iterate through octree levels
-  // and insert cells into the blocks that they intersect
+  // and insert cells into the blocks that they intersect.
+  // Each level is processed in three passes: a parallel pass that decides
+  // which blocks are finalized, a serial pass that refines the octree and
+  // a parallel pass over the cells of the refined blocks that tests them
+  // against the children blocks. The results are then merged serially
+  // in the same order as a block-by-block insertion.
   for(int lev = 0; lev < this->m_levels.size(); ++lev)
   {
     Timer levelTimer(true);
@@ -625,23 +727,168 @@ void InOutOctree<DIM>::insertMeshCells()
     auto& geSizeRelData = m_indexRegistry.addNamelessBuffer();
     geSizeRelData.push_back(0);
 
-    int nextLevelDataBlockCounter = 0;
-
+    // Gather the blocks with data at this level, in traversal order
+    std::vector<GridPt> levelBlocks;
+    std::vector<InOutBlockData*> levelBlockData;
+    std::vector<int> levelDataIndex;
     auto& levelLeafMap = this->getOctreeLevel(lev);
     auto itEnd = levelLeafMap.end();
     for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
     {
-      InOutBlockData& blkData = *it;
+      if(!it->hasData()) continue;
+
+      levelBlocks.push_back(it.pt());
+      levelBlockData.push_back(&(*it));
+      levelDataIndex.push_back(it->dataIndex());
+    }
+    const int numLevelBlocks = static_cast<int>(levelBlocks.size());
+
+    // Leaf blocks whose cells all share a common vertex are 'finalized'.
+    // This only reads the vertex-to-block map and updates the block's own
+    // dynamic data, so the blocks can be checked independently.
+    std::vector<unsigned char> isFinalized(numLevelBlocks);
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for(int b = 0; b < numLevelBlocks; ++b)
+    {
+      const BlockIndex blk(levelBlocks[b], lev);
+      DynamicGrayBlockData& dynamicLeafData =
+        currentLevelData[levelDataIndex[b]];
 
-      if(!blkData.hasData()) continue;
+      isFinalized[b] = dynamicLeafData.isLeaf() &&
+        allCellsIncidentInCommonVertex(blk, dynamicLeafData);
+    }
+
+    // Refine the remaining leaf blocks; this modifies the octree
+    std::vector<int> refinedBlocks;
+    for(int b = 0; b < numLevelBlocks; ++b)
+    {
+      if(isFinalized[b]) continue;
 
-      BlockIndex blk(it.pt(), lev);
+      const BlockIndex blk(levelBlocks[b], lev);
       DynamicGrayBlockData& dynamicLeafData =
-        currentLevelData[blkData.dataIndex()];
+        currentLevelData[levelDataIndex[b]];
+
+      if(dynamicLeafData.isLeaf())
+      {
+        const VertexIndex vIdx = dynamicLeafData.vertexIndex();
+
+        this->refineLeaf(blk);
+        dynamicLeafData.setLeafFlag(false);
+
+        // Reinsert the vertex into the tree, if vIdx was indexed by blk
+        if(blockIndexesVertex(vIdx, blk)) insertVertex(vIdx, blk.childLevel());
+      }
+
+      refinedBlocks.push_back(b);
+    }
+    const int numRefinedBlocks = static_cast<int>(refinedBlocks.size());
+
+    /// Setup caches for data associated with children of the refined blocks
+    std::vector<ChildBlockCache> childCaches(numRefinedBlocks);
+    std::vector<axom::IndexType> cellOffsets(numRefinedBlocks + 1, 0);
+    for(int k = 0; k < numRefinedBlocks; ++k)
+    {
+      const int numCells =
+        currentLevelData[levelDataIndex[refinedBlocks[k]]].numCells();
+      cellOffsets[k + 1] = cellOffsets[k] + numCells;
+    }
+
+    // The children were added above, so the threads only need const access
+    // to the next level; its non-const accessors may insert into a hash map
+    const InOutOctree& constOctree = *this;
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+    for(int k = 0; k < numRefinedBlocks; ++k)
+    {
+      const BlockIndex blk(levelBlocks[refinedBlocks[k]], lev);
+      ChildBlockCache& cache = childCaches[k];
+
+      const LeavesLevelMap& childLevelMap = constOctree.getOctreeLevel(lev + 1);
+      const typename LeavesLevelMap::BroodData& broodData =
+        childLevelMap.getBroodData(blk.pt());
+
+      for(int j = 0; j < BlockIndex::NUM_CHILDREN; ++j)
+      {
+        cache.childBlk[j] = blk.child(j);
+        cache.childBB[j] = this->blockBoundingBox(cache.childBlk[j]);
 
-      bool isInternal = !dynamicLeafData.isLeaf();
-      bool isLeafThatMustRefine =
-        !isInternal && !allCellsIncidentInCommonVertex(blk, dynamicLeafData);
+        // expand bounding box slightly to deal with grazing cells
+        cache.childBB[j].scale(m_boundingBoxScaleFactor);
+
+        const InOutBlockData& childBlockData = broodData[j];
+        if(!childBlockData.hasData())
+        {
+          cache.childData[j] = DynamicGrayBlockData();
+          cache.childData[j].setLeafFlag(childBlockData.isLeaf());
+        }
+        else
+        {
+          cache.childData[j] = DynamicGrayBlockData(childBlockData.dataIndex(),
+                                                    childBlockData.isLeaf());
+        }
+      }
+    }
+
+    // Find the children blocks intersected by each cell of the refined blocks.
+    // The cells of all refined blocks are processed together to balance the
+    // work, e.g. when a single block at a coarse level holds most cells.
+    const axom::IndexType totalCells = cellOffsets[numRefinedBlocks];
+    std::vector<unsigned char> childMasks(totalCells, 0);
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for(axom::IndexType idx = 0; idx < totalCells; ++idx)
+    {
+      const int k = static_cast<int>(
+        std::upper_bound(cellOffsets.begin(), cellOffsets.end(), idx) -
+        cellOffsets.begin() - 1);
+      const ChildBlockCache& cache = childCaches[k];
+      const DynamicGrayBlockData& dynamicLeafData =
+        currentLevelData[levelDataIndex[refinedBlocks[k]]];
+
+      CellIndex tIdx = dynamicLeafData.cells()[idx - cellOffsets[k]];
+      SpaceCell spaceTri = m_meshWrapper.cellPositions(tIdx);
+      GeometricBoundingBox tBB = m_meshWrapper.cellBoundingBox(tIdx);
+
+      unsigned char mask = 0;
+      for(int j = 0; j < BlockIndex::numChildren(); ++j)
+      {
+        bool shouldAddCell =
+          blockIndexesElementVertex(tIdx, cache.childBlk[j]) ||
+          (cache.childData[j].isLeaf() ? intersect(spaceTri, cache.childBB[j])
+                                       : intersect(tBB, cache.childBB[j]));
+
+        QUEST_OCTREE_DEBUG_LOG_IF(
+          DEBUG_BLOCK_1 == cache.childBlk[j] ||
+            DEBUG_BLOCK_2 == cache.childBlk[j],
+          //&& tIdx == DEBUG_TRI_IDX
+          fmt::format("Attempting to insert cell {} @ {} w/ BB {}"
+                      "\n\t into block {} w/ BB {} and data {} "
+                      "\n\tShould add? {}",
+                      tIdx,
+                      spaceTri,
+                      tBB,
+                      cache.childBlk[j],
+                      cache.childBB[j],
+                      cache.childData[j],
+                      (shouldAddCell ? " yes" : "no")));
+
+        if(shouldAddCell) mask |= static_cast<unsigned char>(1 << j);
+      }
+      childMasks[idx] = mask;
+    }
+
+    // Merge the results in traversal order
+    int nextLevelDataBlockCounter = 0;
+    for(int b = 0, k = 0; b < numLevelBlocks; ++b)
+    {
+      const BlockIndex blk(levelBlocks[b], lev);
+      InOutBlockData& blkData = *levelBlockData[b];
+      DynamicGrayBlockData& dynamicLeafData =
+        currentLevelData[levelDataIndex[b]];
 
       QUEST_OCTREE_DEBUG_LOG_IF(
         DEBUG_BLOCK_1 == blk || DEBUG_BLOCK_2 == blk,
@@ -652,11 +899,10 @@ void InOutOctree<DIM>::insertMeshCells()
                     blk,
                     dynamicLeafData,
                     blkData,
-                    (!isInternal && !isLeafThatMustRefine ? " yes" : "no")));
+                    (isFinalized[b] ? " yes" : "no")));
 
-      // Leaf blocks that don't refine are 'finalized'
-      // -- add  them to the current level's relations
-      if(!isInternal && !isLeafThatMustRefine)
+      // Finalized leaf blocks are added to the current level's relations
+      if(isFinalized[b])
       {
         if(dynamicLeafData.hasCells())
         {
@@ -681,157 +927,73 @@ void InOutOctree<DIM>::insertMeshCells()
                         dynamicLeafData,
                         blkData));
         }
+        continue;
       }
-      else
-      {
-        /// Otherwise, we must distribute the block data among the children
 
-        // Refine the leaf if necessary
-        if(isLeafThatMustRefine)
-        {
-          const VertexIndex vIdx = dynamicLeafData.vertexIndex();
+      /// Otherwise, we must distribute the block data among the children
 
-          this->refineLeaf(blk);
-          dynamicLeafData.setLeafFlag(false);
+      // Need to mark the block as internal since we were using its data
+      // as an index into the DynamicGrayBlockData array
+      blkData.setInternal();
 
-          // Reinsert the vertex into the tree, if vIdx was indexed by blk
-          if(blockIndexesVertex(vIdx, blk))
-            insertVertex(vIdx, blk.childLevel());
-        }
-        else if(isInternal)
-        {
-          // Need to mark the leaf as internal since we were using its data
-          // as an index into the DynamicGrayBlockData array
-          blkData.setInternal();
-        }
+      SLIC_ASSERT_MSG(
+        this->isInternal(blk),
+        fmt::format("Block {} was refined, so it should be marked as internal.",
+                    fmt::streamed(blk)));
 
-        SLIC_ASSERT_MSG(
-          this->isInternal(blk),
-          fmt::format(
-            "Block {} was refined, so it should be marked as internal.",
-            fmt::streamed(blk)));
+      // Add all cells to intersecting children blocks
+      const ChildBlockCache& cache = childCaches[k];
+      const axom::IndexType cellBegin = cellOffsets[k];
+      ++k;
 
-        /// Setup caches for data associated with children
-        BlockIndex childBlk[BlockIndex::NUM_CHILDREN];
-        GeometricBoundingBox childBB[BlockIndex::NUM_CHILDREN];
-        DynamicGrayBlockData childData[BlockIndex::NUM_CHILDREN];
-        DynamicGrayBlockData* childDataPtr[BlockIndex::NUM_CHILDREN];
+      int childDataIndex[BlockIndex::NUM_CHILDREN];
+      for(int j = 0; j < BlockIndex::NUM_CHILDREN; ++j)
+      {
+        childDataIndex[j] = -1;
+      }
 
-        const typename LeavesLevelMap::BroodData& broodData =
-          this->getOctreeLevel(lev + 1).getBroodData(blk.pt());
+      const DynamicGrayBlockData::CellList& parentCells =
+        dynamicLeafData.cells();
+      int numCells = static_cast<int>(parentCells.size());
+      for(int i = 0; i < numCells; ++i)
+      {
+        CellIndex tIdx = parentCells[i];
+        const unsigned char mask = childMasks[cellBegin + i];
 
-        for(int j = 0; j < BlockIndex::NUM_CHILDREN; ++j)
+        for(int j = 0; j < BlockIndex::numChildren(); ++j)
         {
-          childBlk[j] = blk.child(j);
-          childBB[j] = this->blockBoundingBox(childBlk[j]);
-
-          // expand bounding box slightly to deal with grazing cells
-          childBB[j].scale(m_boundingBoxScaleFactor);
+          if(!(mask & (1 << j))) continue;
 
-          const InOutBlockData& childBlockData = broodData[j];
-          if(!childBlockData.hasData())
+          // Place the DynamicGrayBlockData in the array before adding its data
+          if(childDataIndex[j] < 0)
           {
-            childData[j] = DynamicGrayBlockData();
-            childData[j].setLeafFlag(childBlockData.isLeaf());
-          }
-          else
-          {
-            childData[j] = DynamicGrayBlockData(childBlockData.dataIndex(),
-                                                childBlockData.isLeaf());
-          }
-
-          childDataPtr[j] = &childData[j];
-        }
+            // Copy the DynamicGrayBlockData into the array
+            nextLevelData.push_back(cache.childData[j]);
+            childDataIndex[j] = nextLevelDataBlockCounter;
 
-        // Check that the vector has enough capacity for all children
-        // This ensures that our child data pointers will not be invalidated
-        if(nextLevelData.capacity() <
-           (nextLevelData.size() + BlockIndex::NUM_CHILDREN))
-          nextLevelData.reserve(nextLevelData.size() * 4);
+            // Set the data in the octree to this index and update the index
+            (*this)[cache.childBlk[j]].setData(nextLevelDataBlockCounter++);
+          }
 
-        // Add all cells to intersecting children blocks
-        DynamicGrayBlockData::CellList& parentCells = dynamicLeafData.cells();
-        int numCells = static_cast<int>(parentCells.size());
-        for(int i = 0; i < numCells; ++i)
-        {
-          CellIndex tIdx = parentCells[i];
-          SpaceCell spaceTri = m_meshWrapper.cellPositions(tIdx);
-          GeometricBoundingBox tBB = m_meshWrapper.cellBoundingBox(tIdx);
+          nextLevelData[childDataIndex[j]].addCell(tIdx);
 
-          for(int j = 0; j < BlockIndex::numChildren(); ++j)
-          {
-            bool shouldAddCell = blockIndexesElementVertex(tIdx, childBlk[j]) ||
-              (childDataPtr[j]->isLeaf() ? intersect(spaceTri, childBB[j])
-                                         : intersect(tBB, childBB[j]));
-
-            QUEST_OCTREE_DEBUG_LOG_IF(
-              DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
-              //&& tIdx == DEBUG_TRI_IDX
-              fmt::format("Attempting to insert cell {} @ {} w/ BB {}"
-                          "\n\t into block {} w/ BB {} and data {} "
-                          "\n\tShould add? {}",
-                          tIdx,
-                          spaceTri,
-                          tBB,
-                          childBlk[j],
-                          childBB[j],
-                          *childDataPtr[j],
-                          (shouldAddCell ? " yes" : "no")));
-
-            if(shouldAddCell)
-            {
-              // Place the DynamicGrayBlockData in the array before adding its data
-              if(!childDataPtr[j]->hasCells())
-              {
-                // Copy the DynamicGrayBlockData into the array
-                nextLevelData.push_back(childData[j]);
-
-                // Update the child data pointer
-                childDataPtr[j] = &nextLevelData[nextLevelDataBlockCounter];
-
-                // Set the data in the octree to this index and update the index
-                (*this)[childBlk[j]].setData(nextLevelDataBlockCounter++);
-              }
-
-              childDataPtr[j]->addCell(tIdx);
-
-              QUEST_OCTREE_DEBUG_LOG_IF(
-                DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
-                //&& tIdx == DEBUG_TRI_IDX
-                fmt::format(
-                  "Added cell {} @ {} with verts [{}]"
-                  "\n\tinto block {} with data {}.",
-                  tIdx,
-                  spaceTri,
-                  fmt::join(m_meshWrapper.cellVertexIndices(tIdx), ", "),
-                  childBlk[j],
-                  *(childDataPtr[j])));
-            }
-          }
+          QUEST_OCTREE_DEBUG_LOG_IF(
+            DEBUG_BLOCK_1 == cache.childBlk[j] ||
+              DEBUG_BLOCK_2 == cache.childBlk[j],
+            //&& tIdx == DEBUG_TRI_IDX
+            fmt::format("Added cell {} with verts [{}]"
+                        "\n\tinto block {} with data {}.",
+                        tIdx,
+                        fmt::join(m_meshWrapper.cellVertexIndices(tIdx), ", "),
+                        cache.childBlk[j],
+                        nextLevelData[childDataIndex[j]]));
         }
       }
     }
 
     if(!levelLeafMap.empty())
     {
-      // Create the relations from gray leaves to mesh vertices and elements
-      m_grayLeafsMap[lev] = GrayLeafSet(static_cast<int>(gvRelData.size()));
-
-      m_grayLeafToVertexRelationLevelMap[lev] =
-        GrayLeafVertexRelation(&m_grayLeafsMap[lev], &m_meshWrapper.vertexSet());
-      m_grayLeafToVertexRelationLevelMap[lev].bindIndices(
-        static_cast<int>(gvRelData.size()),
-        &gvRelData);
-
-      m_grayLeafToElementRelationLevelMap[lev] =
-        GrayLeafElementRelation(&m_grayLeafsMap[lev],
-                                &m_meshWrapper.elementSet());
-      m_grayLeafToElementRelationLevelMap[lev].bindBeginOffsets(
-        m_grayLeafsMap[lev].size(),
-        &geSizeRelData);
-      m_grayLeafToElementRelationLevelMap[lev].bindIndices(
-        static_cast<int>(geIndRelData.size()),
-        &geIndRelData);
+      bindGrayLeafRelations(lev, gvRelData, geIndRelData, geSizeRelData);
     }
 
     currentLevelData.clear();
@@ -843,6 +1005,31 @@ void InOutOctree<DIM>::insertMeshCells()
   }
 }
 
+template <int DIM>
+void InOutOctree<DIM>::bindGrayLeafRelations(int lev,
+                                             IndexBuffer& gvRelData,
+                                             IndexBuffer& geIndRelData,
+                                             IndexBuffer& geSizeRelData)
+{
+  // Create the relations from gray leaves to mesh vertices and elements
+  m_grayLeafsMap[lev] = GrayLeafSet(static_cast<int>(gvRelData.size()));
+
+  m_grayLeafToVertexRelationLevelMap[lev] =
+    GrayLeafVertexRelation(&m_grayLeafsMap[lev], &m_meshWrapper.vertexSet());
+  m_grayLeafToVertexRelationLevelMap[lev].bindIndices(
+    static_cast<int>(gvRelData.size()),
+    &gvRelData);
+
+  m_grayLeafToElementRelationLevelMap[lev] =
+    GrayLeafElementRelation(&m_grayLeafsMap[lev], &m_meshWrapper.elementSet());
+  m_grayLeafToElementRelationLevelMap[lev].bindBeginOffsets(
+    m_grayLeafsMap[lev].size(),
+    &geSizeRelData);
+  m_grayLeafToElementRelationLevelMap[lev].bindIndices(
+    static_cast<int>(geIndRelData.size()),
+    &geIndRelData);
+}
+
 template <int DIM>
 void InOutOctree<DIM>::colorOctreeLeaves()
 {
@@ -960,7 +1147,7 @@ bool InOutOctree<DIM>::colorLeafAndNeighbors(const BlockIndex& leafBlk,
           SpacePt faceCenter =
             SpacePt::midpoint(this->blockBoundingBox(leafBlk).getCentroid(),
                               this->blockBoundingBox(neighborBlk).getCentroid());
-          if(withinGrayBlock<DIM>(faceCenter, neighborBlk, neighborData))
+          if(withinGrayBlock(faceCenter, neighborBlk, neighborData))
             leafData.setBlack();
           else
             leafData.setWhite();
@@ -1024,7 +1211,7 @@ bool InOutOctree<DIM>::colorLeafAndNeighbors(const BlockIndex& leafBlk,
               this->blockBoundingBox(leafBlk).getCentroid(),
               this->blockBoundingBox(leafBlk.faceNeighbor(i)).getCentroid());
 
-            if(withinGrayBlock<DIM>(faceCenter, leafBlk, leafData))
+            if(withinGrayBlock(faceCenter, leafBlk, leafData))
               neighborData.setBlack();
             else
               neighborData.setWhite();
@@ -1077,256 +1264,32 @@ typename InOutOctree<DIM>::CellIndexSet InOutOctree<DIM>::leafCells(
 }
 
 template <int DIM>
-template <int TDIM>
-typename std::enable_if<TDIM == 3, bool>::type InOutOctree<DIM>::withinGrayBlock(
-  const SpacePt& queryPt,
-  const BlockIndex& leafBlk,
-  const InOutBlockData& leafData) const
-{
-  /// Finds a ray from queryPt to a point of a triangle within leafBlk.
-  /// Then find the first triangle along this ray. The orientation of the ray
-  /// against this triangle's normal indicates queryPt's containment.
-  /// It is inside when the dot product is positive.
-
-  SLIC_ASSERT(leafData.color() == InOutBlockData::Gray);
-  SLIC_ASSERT(leafData.hasData());
-
-  GeometricBoundingBox blockBB = this->blockBoundingBox(leafBlk);
-
-  SpacePt triPt;
-
-  CellIndexSet triSet = leafCells(leafBlk, leafData);
-  const int numTris = triSet.size();
-  for(int i = 0; i < numTris; ++i)
-  {
-    /// Get the triangle
-    CellIndex idx = triSet[i];
-    SpaceCell tri = m_meshWrapper.cellPositions(idx);
-
-    /// Find a point from this triangle within the bounding box of the mesh
-    primal::Polygon<double, DIM> poly = primal::clip(tri, blockBB);
-    if(poly.numVertices() == 0)
-    {
-      // Account for cases where the triangle only grazes the bounding box.
-      // Here, intersect(tri,blockBB) is true, but the clipping algorithm
-      // produces an empty polygon.  To resolve this, clip against a
-      // slightly expanded bounding box
-      GeometricBoundingBox expandedBB = blockBB;
-      expandedBB.scale(10 * m_boundingBoxScaleFactor);
-
-      poly = primal::clip(tri, expandedBB);
-
-      // If that still doesn't work, move on to the next triangle
-      if(poly.numVertices() == 0)
-      {
-        continue;
-      }
-    }
-
-    triPt = poly.vertexMean();
-
-    /// Use a ray from the query point to the triangle point to find an
-    /// intersection. Note: We have to check all triangles to ensure that
-    /// there is not a closer triangle than tri along this direction.
-    CellIndex tIdx = MeshWrapper<DIM>::NO_CELL;
-    double minRayParam = std::numeric_limits<double>::infinity();
-    SpaceRay ray(queryPt, SpaceVector(queryPt, triPt));
-
-    QUEST_OCTREE_DEBUG_LOG_IF(
-      DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-      fmt::format("Checking if pt {} is within block {} with data {}, "
-                  "ray is {}, triangle point is {} on triangle with index {}.",
-                  queryPt,
-                  leafBlk,
-                  leafData,
-                  ray,
-                  triPt,
-                  idx));
-
-    double rayParam = 0;
-    if(primal::intersect(tri, ray, rayParam))
-    {
-      minRayParam = rayParam;
-      tIdx = idx;
-
-      QUEST_OCTREE_DEBUG_LOG_IF(
-        DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-        fmt::format("... intersection for triangle w/ index {} at ray "
-                    "parameter {} at point {}",
-                    tIdx,
-                    minRayParam,
-                    ray.at(minRayParam)));
-    }
-
-    for(int j = 0; j < numTris; ++j)
-    {
-      CellIndex localIdx = triSet[j];
-      if(localIdx == idx) continue;
-
-      if(primal::intersect(m_meshWrapper.cellPositions(localIdx), ray, rayParam))
-      {
-        if(rayParam < minRayParam)
-        {
-          minRayParam = rayParam;
-          tIdx = localIdx;
-
-          QUEST_OCTREE_DEBUG_LOG_IF(
-            DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-            fmt::format("... intersection for triangle w/ index {} at ray "
-                        "parameter {} at point {}",
-                        tIdx,
-                        minRayParam,
-                        ray.at(minRayParam)));
-        }
-      }
-    }
-
-    if(tIdx == MeshWrapper<DIM>::NO_CELL)
-    {
-      continue;
-    }
-
-    // Inside when the dot product of the normal with this triangle is positive
-    SpaceVector normal =
-      (tIdx == idx) ? tri.normal() : m_meshWrapper.cellPositions(tIdx).normal();
-
-    return normal.dot(ray.direction()) > 0.;
-  }
-
-  SLIC_DEBUG("Could not determine inside/outside for point "
-             << queryPt << " on block " << leafBlk);
-
-  return false;  // query points on boundary might get here -- revisit this.
-}
-
-template <int DIM>
-template <int TDIM>
-typename std::enable_if<TDIM == 2, bool>::type InOutOctree<DIM>::withinGrayBlock(
-  const SpacePt& queryPt,
-  const BlockIndex& leafBlk,
-  const InOutBlockData& leafData) const
+bool InOutOctree<DIM>::withinGrayBlock(const SpacePt& queryPt,
+                                       const BlockIndex& leafBlk,
+                                       const InOutBlockData& leafData) const
 {
-  /// Finds a ray from queryPt to a point of a segment within leafBlk.
-  /// Then finds the first segment along this ray. The orientation of the ray
-  /// against this segment's normal indicates queryPt's containment.
-  /// It is inside when the dot product is positive.
-
   SLIC_ASSERT(leafData.color() == InOutBlockData::Gray);
   SLIC_ASSERT(leafData.hasData());
 
-  GeometricBoundingBox blockBB = this->blockBoundingBox(leafBlk);
-  GeometricBoundingBox expandedBB = blockBB;
-  expandedBB.scale(m_boundingBoxScaleFactor);
+  const bool isWithin = detail::withinGrayBlock(
+    queryPt,
+    this->blockBoundingBox(leafBlk),
+    m_boundingBoxScaleFactor,
+    leafCells(leafBlk, leafData),
+    [this](CellIndex idx) { return m_meshWrapper.cellPositions(idx); },
+    [this](CellIndex idx, int i) {
+      return m_meshWrapper.cellVertexIndices(idx)[i];
+    });
 
-  SpacePt segmentPt;
-
-  CellIndexSet segmentSet = leafCells(leafBlk, leafData);
-  const int numSegments = segmentSet.size();
-  for(int i = 0; i < numSegments; ++i)
-  {
-    /// Get the segment
-    CellIndex idx = segmentSet[i];
-    SpaceCell seg = m_meshWrapper.cellPositions(idx);
-
-    /// Find a point from this segment within the expanded bounding box of the mesh
-    // We'll use the midpoint of the segment after clipping it against the bounding box
-    double pMin, pMax;
-    const bool intersects = primal::intersect(seg, expandedBB, pMin, pMax);
-    if(!intersects)
-    {
-      continue;
-    }
-    segmentPt = seg.at(0.5 * (pMin + pMax));
-
-    // Using a ray from query pt to point on this segment
-    // Find closest intersection to surface within cell inside this bounding box
-    CellIndex tIdx = MeshWrapper<DIM>::NO_CELL;
-    double minRayParam = std::numeric_limits<double>::infinity();
-    double minSegParam = std::numeric_limits<double>::infinity();
-    SpaceRay ray(queryPt, SpaceVector(queryPt, segmentPt));
-
-    QUEST_OCTREE_DEBUG_LOG_IF(
-      DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-      fmt::format("Checking if pt {} is within block {} with data {}, "
-                  "ray is {}, segment point is {} on segment with index {}.",
-                  queryPt,
-                  leafBlk,
-                  leafData,
-                  ray,
-                  segmentPt,
-                  idx));
-
-    double rayParam = 0;
-    double segParam = 0;
-    if(primal::intersect(ray, seg, rayParam, segParam))
-    {
-      minRayParam = rayParam;
-      minSegParam = segParam;
-      tIdx = idx;
-
-      QUEST_OCTREE_DEBUG_LOG_IF(
-        DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-        fmt::format("... intersection for segment w/ index {} "
-                    "at ray parameter {} and segment parameter {} "
-                    "is at point {}",
-                    tIdx,
-                    minRayParam,
-                    minSegParam,
-                    ray.at(minRayParam)));
-    }
-
-    for(int j = 0; j < numSegments; ++j)
-    {
-      CellIndex localIdx = segmentSet[j];
-      if(localIdx == idx) continue;
-
-      if(primal::intersect(ray,
-                           m_meshWrapper.cellPositions(localIdx),
-                           rayParam,
-                           segParam))
-      {
-        if(rayParam < minRayParam)
-        {
-          minRayParam = rayParam;
-          minSegParam = segParam;
-          tIdx = localIdx;
-
-          QUEST_OCTREE_DEBUG_LOG_IF(
-            DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-            fmt::format("... intersection for segment w/ index {} "
-                        "at ray parameter {} and segment parameter {} "
-                        "is at point {}",
-                        tIdx,
-                        minRayParam,
-                        minSegParam,
-                        ray.at(minRayParam)));
-        }
-      }
-    }
-    if(tIdx == MeshWrapper<DIM>::NO_CELL)
-    {
-      continue;
-    }
-
-    // Get the surface normal at the intersection point
-    // If the latter is a vertex, the normal is the average of its two incident segments
-    SpaceVector normal =
-      m_meshWrapper.surfaceNormal(tIdx, minSegParam, segmentSet);
-
-    QUEST_OCTREE_DEBUG_LOG_IF(DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-                              fmt::format("... normal {}, ray {}, dot {}",
-                                          normal,
-                                          ray,
-                                          normal.dot(ray.direction())));
-
-    // Query point is inside when the dot product of the normal with ray is positive
-    return normal.dot(ray.direction()) > 0.;
-  }
-
-  SLIC_DEBUG("Could not determine inside/outside for point "
-             << queryPt << " on block " << leafBlk);
-
-  return false;  // query points on boundary might get here -- revisit this.
+  QUEST_OCTREE_DEBUG_LOG_IF(
+    DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
+    fmt::format("Point {} is {} block {} with data {}",
+                queryPt,
+                isWithin ? "within" : "not within",
+                leafBlk,
+                leafData));
+
+  return isWithin;
 }
 
 template <int DIM>
@@ -1438,33 +1401,189 @@ bool InOutOctree<DIM>::allCellsIncidentInCommonVertex(
   return shareCommonVert;
 }
 
+template <int DIM>
+bool InOutOctree<DIM>::saveIndex(const std::string& fileName) const
+{
+  if(m_generationState != INOUTOCTREE_LEAVES_COLORED)
+  {
+    SLIC_WARNING("Can only save the index of an initialized InOutOctree");
+    return false;
+  }
+
+  return detail::InOutOctreeSerializer<DIM>::write(*this, fileName);
+}
+
+template <int DIM>
+bool InOutOctree<DIM>::loadIndex(const std::string& fileName)
+{
+  if(m_generationState != INOUTOCTREE_UNINITIALIZED)
+  {
+    SLIC_WARNING("Can only load the index of an uninitialized InOutOctree");
+    return false;
+  }
+
+  using Timer = axom::utilities::Timer;
+  Timer timer(true);
+
+  if(!detail::InOutOctreeSerializer<DIM>::read(*this, fileName))
+  {
+    return false;
+  }
+  m_generationState = INOUTOCTREE_LEAVES_COLORED;
+  checkValid();
+
+  // Replace the surface mesh with the welded mesh, as in generateIndex()
+  m_meshWrapper.regenerateSurfaceMesh();
+  timer.stop();
+
+  SLIC_INFO(fmt::format("  Loaded InOutOctree from '{}' in {} seconds.",
+                        fileName,
+                        timer.elapsed()));
+  return true;
+}
+
 template <int DIM>
 bool InOutOctree<DIM>::within(const SpacePt& pt) const
 {
   if(this->boundingBox().contains(pt))
   {
     const BlockIndex block = this->findLeafBlock(pt);
-    const InOutBlockData& data = (*this)[block];
+    return withinLeafBlock(pt, block, (*this)[block]);
+  }
+
+  return false;
+}
+
+template <int DIM>
+template <typename ExecSpace>
+typename InOutOctree<DIM>::QueryStatistics InOutOctree<DIM>::within(
+  axom::ArrayView<const SpacePt> pts,
+  axom::ArrayView<bool> results) const
+{
+  AXOM_STATIC_ASSERT_MSG(!axom::execution_space<ExecSpace>::onDevice(),
+                         "InOutOctree queries require a host execution space");
+  SLIC_ASSERT(results.size() >= pts.size());
 
-    switch(data.color())
+  using Timer = axom::utilities::Timer;
+  using MortonType = axom::uint64;
+
+  // Leaf color codes for the statistics, with an extra code for the points
+  // outside the bounding box
+  using ColorCode = axom::int8;
+  constexpr ColorCode OUTSIDE_BOUNDING_BOX = InOutBlockData::Undetermined - 1;
+
+  const axom::IndexType numPts = pts.size();
+  QueryStatistics stats;
+  stats.numQueries = numPts;
+
+  // STEP 1: Sort the queries by the Morton code of their grid cell at a
+  // level fine enough to separate most leaves; points outside the bounding
+  // box go last
+  Timer timer(true);
+  const int sortLevel =
+    axom::utilities::min(this->maxLeafLevel() - 1, DIM == 3 ? 21 : 31);
+  const GeometricBoundingBox bbox = this->boundingBox();
+
+  axom::Array<MortonType> mcodes(numPts, numPts);
+  axom::Array<axom::IndexType> order(numPts, numPts);
+  const auto mcodes_v = mcodes.view();
+  const auto order_v = order.view();
+
+  axom::for_all<ExecSpace>(numPts, [=](axom::IndexType i) {
+    mcodes_v[i] = bbox.contains(pts[i])
+      ? spin::convertPointToMorton<MortonType>(
+          this->findGridCellAtLevel(pts[i], sortLevel))
+      : std::numeric_limits<MortonType>::max();
+    order_v[i] = i;
+  });
+
+  auto mortonLess = [=](axom::IndexType a, axom::IndexType b) -> bool {
+    return mcodes_v[a] != mcodes_v[b] ? mcodes_v[a] < mcodes_v[b] : a < b;
+  };
+
+#ifdef AXOM_USE_RAJA
+  using exec_pol = typename axom::execution_space<ExecSpace>::loop_policy;
+  RAJA::sort<exec_pol>(RAJA::make_span(order.data(), numPts), mortonLess);
+#else
+  std::sort(order.begin(), order.end(), mortonLess);
+#endif
+  timer.stop();
+  stats.sortTime = timer.elapsed();
+
+  // STEP 2: Evaluate the sorted queries, recording the leaf colors
+  timer.start();
+  axom::Array<ColorCode> colors(numPts, numPts);
+  const auto colors_v = colors.view();
+
+  axom::for_all<ExecSpace>(numPts, [=](axom::IndexType k) {
+    const axom::IndexType i = order_v[k];
+    const SpacePt& pt = pts[i];
+
+    if(bbox.contains(pt))
+    {
+      const BlockIndex block = this->findLeafBlock(pt);
+      const InOutBlockData& data = (*this)[block];
+
+      colors_v[i] = static_cast<ColorCode>(data.color());
+      results[i] = withinLeafBlock(pt, block, data);
+    }
+    else
     {
+      colors_v[i] = OUTSIDE_BOUNDING_BOX;
+      results[i] = false;
+    }
+  });
+  timer.stop();
+  stats.queryTime = timer.elapsed();
+
+  // STEP 3: Tally the leaf colors
+  for(axom::IndexType i = 0; i < numPts; ++i)
+  {
+    switch(colors[i])
+    {
+    case OUTSIDE_BOUNDING_BOX:
+      ++stats.numOutside;
+      break;
     case InOutBlockData::Black:
-      return true;
+      ++stats.numBlack;
+      break;
     case InOutBlockData::White:
-      return false;
+      ++stats.numWhite;
+      break;
     case InOutBlockData::Gray:
-      return withinGrayBlock<DIM>(pt, block, data);
-    case InOutBlockData::Undetermined:
-      SLIC_ASSERT_MSG(
-        false,
-        fmt::format("Error -- All leaf blocks must have a color. The color of "
-                    "leafBlock {} was 'Undetermined' when querying point {}",
-                    fmt::streamed(block),
-                    pt));
+      ++stats.numGray;
+      break;
+    default:
       break;
     }
   }
 
+  return stats;
+}
+
+template <int DIM>
+bool InOutOctree<DIM>::withinLeafBlock(const SpacePt& queryPt,
+                                       const BlockIndex& leafBlk,
+                                       const InOutBlockData& leafData) const
+{
+  switch(leafData.color())
+  {
+  case InOutBlockData::Black:
+    return true;
+  case InOutBlockData::White:
+    return false;
+  case InOutBlockData::Gray:
+    return withinGrayBlock(queryPt, leafBlk, leafData);
+  case InOutBlockData::Undetermined:
+    SLIC_ASSERT_MSG(
+      false,
+      fmt::format("Error -- All leaf blocks must have a color. The color of "
+                  "leafBlock {} was 'Undetermined' when querying point {}",
+                  fmt::streamed(leafBlk),
+                  queryPt));
+    break;
+  }
+
   return false;
 }
 
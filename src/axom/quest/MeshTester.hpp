@@ -281,6 +281,88 @@ WatertightStatus isSurfaceMeshWatertight(
 void weldTriMeshVertices(mint::UnstructuredMesh<mint::SINGLE_SHAPE>** surface_mesh,
                          double eps);
 
+/*!
+ * \brief Mesh repair function to weld vertices that are closer than \a eps,
+ *  in parallel in the given execution space.
+ *
+ * \param [in,out] surface_mesh A pointer to a pointer to a triangle mesh
+ * \param [in] eps Distance threshold for welding vertices (using the max norm)
+ * \param [out] vertexMap The index of the welded vertex for each vertex of
+ *  the input mesh, allocated on the host
+ *
+ * \pre \a eps must be greater than zero
+ * \pre \a surface_mesh is a pointer to a pointer to a non-null triangle mesh.
+ * \post The triangles of \a surface_mesh are reindexed using the welded
+ * vertices and degenerate triangles are removed.
+ *
+ * This function produces the same welded mesh as the serial
+ * weldTriMeshVertices() above. Rather than inserting the quantized vertices
+ * into a hash map one at a time, the vertices are sorted by the Morton codes
+ * of their lattice cells, and the welded vertices and triangles are
+ * extracted with parallel prefix sums.
+ *
+ * \note This function is destructive.  It modifies the input triangle
+ * mesh in place.
+ * \note The mesh data must be accessible from the execution space.
+ */
+template <typename ExecSpace>
+void weldTriMeshVertices(mint::UnstructuredMesh<mint::SINGLE_SHAPE>** surface_mesh,
+                         double eps,
+                         axom::Array<IndexType>& vertexMap)
+{
+  AXOM_PERF_MARK_FUNCTION("weldTriMeshVertices");
+
+  SLIC_ASSERT_MSG(eps > 0.,
+                  "Epsilon must be greater than 0. Passed in value was " << eps);
+  SLIC_ASSERT_MSG(
+    surface_mesh != nullptr && *surface_mesh != nullptr,
+    "surface_mesh must be a valid pointer to a pointer to a triangle mesh");
+
+  detail::UMesh* oldMesh = *surface_mesh;
+  const IndexType numVerts = oldMesh->getNumberOfNodes();
+
+  const detail::SpatialBoundingBox meshBB =
+    detail::computeMeshBounds<ExecSpace>(oldMesh).expand(eps);
+
+  // Run the algorithm twice -- on the original grid and a translated grid
+  // and compose the vertex maps of the two passes
+  const int allocID = axom::execution_space<ExecSpace>::allocatorID();
+  axom::Array<IndexType> composedMap(numVerts, numVerts, allocID);
+  const auto composed_v = composedMap.view();
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType i) { composed_v[i] = i; });
+
+  const double offsets[2] = {0., eps / 2.};
+  for(double offset : offsets)
+  {
+    detail::Point3 origin(meshBB.getMin().array() -
+                          detail::Point3(offset).array());
+
+    axom::Array<IndexType> remap;
+    detail::UMesh* newMesh =
+      detail::weldTriMeshVerticesOnLattice<ExecSpace>(oldMesh,
+                                                      origin,
+                                                      eps,
+                                                      remap);
+
+    const auto remap_v = remap.view();
+    for_all<ExecSpace>(
+      numVerts,
+      AXOM_LAMBDA(IndexType i) { composed_v[i] = remap_v[composed_v[i]]; });
+
+    // Delete old mesh and swap pointers
+    delete oldMesh;
+    oldMesh = newMesh;
+  }
+
+  // Update the original mesh pointer to the new mesh
+  *surface_mesh = oldMesh;
+
+  const int hostAllocID = axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  vertexMap = axom::Array<IndexType>(composedMap, hostAllocID);
+}
+
 /// @}
 
 }  // namespace quest
@@ -14,6 +14,8 @@
 
 // primal includes
 #include "axom/spin/BVH.hpp"
+#include "axom/spin/MortonIndex.hpp"
+#include "axom/spin/RectangularLattice.hpp"
 #include "axom/primal/geometry/BoundingBox.hpp"
 #include "axom/primal/geometry/Point.hpp"
 #include "axom/primal/geometry/Triangle.hpp"
@@ -27,9 +29,15 @@
 #include "axom/mint/mesh/FieldVariable.hpp"
 #include "axom/mint/mesh/UnstructuredMesh.hpp"
 #include "axom/mint/mesh/Mesh.hpp"
+#include "axom/mint/mesh/RectilinearMesh.hpp"
+#include "axom/mint/mesh/StructuredMesh.hpp"
+#include "axom/mint/mesh/UniformMesh.hpp"
 
 // C/C++ includes
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 namespace axom
 {
@@ -142,8 +150,133 @@ AXOM_HOST_DEVICE inline bool isClosestPointTypeShared(ClosestPointLocType cpt)
   return cpt == ClosestPointLocType::edge || cpt == ClosestPointLocType::vertex;
 }
 
+/*!
+ * \brief Returns the index of the first of the n sorted values that is not
+ *  less than the given value, or n if there is none.
+ */
+AXOM_HOST_DEVICE inline IndexType lowerBoundIndex(const double* values,
+                                                  IndexType n,
+                                                  double value)
+{
+  IndexType lo = 0;
+  while(n > 0)
+  {
+    const IndexType half = n / 2;
+    if(values[lo + half] < value)
+    {
+      lo += half + 1;
+      n -= half + 1;
+    }
+    else
+    {
+      n = half;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief Indexable over a subset of the nodes of a uniform or rectilinear
+ *  mesh, for use as the query points of SignedDistance::computeDistances().
+ */
+template <int NDIMS>
+struct StructuredMeshNodes
+{
+  using PointType = primal::Point<double, NDIMS>;
+
+  /// Linear indices of the nodes
+  const IndexType* nodes;
+  /// Node coordinates along each axis, one axis after the other
+  const double* coords;
+  /// Offset of the coordinates of each axis in coords
+  IndexType offsets[NDIMS];
+  /// Number of nodes along each axis
+  IndexType resolution[NDIMS];
+
+  AXOM_HOST_DEVICE PointType operator[](IndexType idx) const
+  {
+    IndexType node = nodes[idx];
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coords[offsets[d] + node % resolution[d]];
+      node /= resolution[d];
+    }
+    return pt;
+  }
+};
+
+/*!
+ * \brief Far-field data of the surface cells in a bin of the BVH, which
+ *  approximates their contribution to generalized winding numbers.
+ */
+template <int NDIMS>
+struct WindingNode
+{
+  /// Area-weighted centroid of the cells
+  primal::Point<double, NDIMS> center {};
+  /// Sum of the area-weighted normals of the cells, i.e., their dipole
+  primal::Vector<double, NDIMS> areaNormal {};
+  /// Radius of a ball around the center that holds the cells
+  double radius {0.0};
+};
+
+/// Returns the normal of the given triangle, scaled by its area
+AXOM_HOST_DEVICE inline primal::Vector<double, 3> getAreaNormal(
+  const primal::Triangle<double, 3>& tri)
+{
+  return 0.5 * tri.normal();
+}
+
+/// Winding numbers are only supported in 3D
+AXOM_HOST_DEVICE inline primal::Vector<double, 2> getAreaNormal(
+  const primal::Triangle<double, 2>&)
+{
+  return primal::Vector<double, 2> {};
+}
+
+/*!
+ * \brief Returns the signed solid angle of the given triangle at a point,
+ *  which is positive when the point is behind the triangle.
+ *
+ *  Uses the formula of Van Oosterom and Strackee.
+ */
+AXOM_HOST_DEVICE inline double getSolidAngle(
+  const primal::Point<double, 3>& qpt,
+  const primal::Triangle<double, 3>& tri)
+{
+  using VectorType = primal::Vector<double, 3>;
+  const VectorType a(qpt, tri[0]);
+  const VectorType b(qpt, tri[1]);
+  const VectorType c(qpt, tri[2]);
+  const double la = a.norm();
+  const double lb = b.norm();
+  const double lc = c.norm();
+
+  const double numer = VectorType::scalar_triple_product(a, b, c);
+  const double denom =
+    la * lb * lc + a.dot(b) * lc + a.dot(c) * lb + b.dot(c) * la;
+  return 2.0 * atan2(numer, denom);
+}
+
+/// Winding numbers are only supported in 3D
+AXOM_HOST_DEVICE inline double getSolidAngle(const primal::Point<double, 2>&,
+                                             const primal::Triangle<double, 2>&)
+{
+  return 0.0;
+}
+
 }  // end namespace detail
 
+/*!
+ * \brief Methods used by SignedDistance to compute the signs of distances.
+ */
+enum class SignMethod
+{
+  PseudoNormal,  //!< sign of the pseudo-normal at the closest point (default)
+  WindingNumber  //!< generalized winding number of the surface, in 3D only
+};
+
 template <int NDIMS, typename ExecSpace = axom::SEQ_EXEC>
 class SignedDistance
 {
@@ -331,6 +464,97 @@ public:
                         PointType* outClosestPts = nullptr,
                         VectorType* outNormals = nullptr) const;
 
+  /*!
+   * \brief Sets whether computeDistances() reorders the query points along
+   *  a Morton curve.
+   *
+   * When enabled, the queries of each call to computeDistances() with
+   * several points are sorted by the Morton code of their position within
+   * the bounding box of the query points, and evaluated in chunks of
+   * consecutive sorted queries. Within a chunk, the distance of the previous
+   * query bounds the search radius of the next one, so BVH traversals visit
+   * fewer, and mostly cached, nodes. The results are returned in input
+   * order and are identical to those of unsorted queries.
+   *
+   * This pays off when consecutive query points are spatially scattered,
+   * e.g., for the nodes of an unstructured volume mesh. It is disabled by
+   * default.
+   *
+   * \param [in] sortQueries true to sort the queries, false otherwise
+   */
+  void setSortQueries(bool sortQueries) { m_sortQueries = sortQueries; }
+
+  /// Returns whether computeDistances() reorders the query points
+  bool getSortQueries() const { return m_sortQueries; }
+
+  /*!
+   * \brief Sets the method used to compute the signs of the distances.
+   *
+   * With SignMethod::WindingNumber, a query point is inside the surface if
+   * the generalized winding number of the surface at the point is at least
+   * 1/2. Unlike the pseudo-normal at the closest point, the winding number
+   * degrades gracefully on surfaces with cracks, holes or overlapping cells,
+   * and does not assume that the surface divides the domain into two
+   * regions. The isWatertight flag is not used for the signs in this mode.
+   *
+   * The winding number is approximated hierarchically over the bins of the
+   * BVH, in the style of Barnes-Hut: the cells of each bin whose bounding
+   * ball is far enough from the query point contribute through the dipole
+   * of their area-weighted normals at their area-weighted centroid, and the
+   * remaining cells contribute their exact solid angles. A bin is far
+   * enough when the distance of the query point to its center exceeds
+   * \a accuracy times its radius. The cost of a query is logarithmic in the
+   * number of surface cells, and larger values of \a accuracy trade speed
+   * for accuracy.
+   *
+   * \param [in] method the method used to compute the signs
+   * \param [in] accuracy ratio of the distance to the radius of the BVH bins
+   *  above which they are approximated by their dipoles (optional)
+   *
+   * \note Winding numbers are only supported for 3D surface meshes.
+   *
+   * \pre accuracy > 1
+   */
+  void setSignMethod(SignMethod method, double accuracy = 2.0);
+
+  /// Returns the method used to compute the signs of the distances
+  SignMethod getSignMethod() const { return m_signMethod; }
+
+  /*!
+   * \brief Computes a node-centered signed distance field on a uniform or
+   *  rectilinear mesh, with exact distances only in a band around the surface.
+   *
+   * The nodes in the band are found from the bounding boxes of the surface
+   * cells, expanded by \a bandWidth and by one node along each axis, and
+   * only their distances are computed with the BVH. Nodes outside the band
+   * are further than \a bandWidth from the surface. They are assigned
+   * \a bandWidth, with the sign of the band found by a flood fill through the
+   * mesh from the band nodes. The cost of the BVH queries scales with the
+   * area of the surface instead of the number of nodes.
+   *
+   * \param [in] mesh uniform or rectilinear mesh of dimension NDIMS
+   * \param [in] bandWidth width of the band on each side of the surface
+   * \param [out] outSgnDist array of mesh->getNumberOfNodes() values to fill
+   *  with the signed distances of the nodes, clamped to
+   *  [-bandWidth, bandWidth]
+   *
+   * \return the number of nodes whose distance was computed with the BVH
+   *
+   * \note The signs of the nodes outside the band are only meaningful if the
+   *  band separates the inside of the surface from the outside. Every mesh
+   *  edge crossed by the surface has both of its nodes in the band.
+   *
+   * \note The flood fill runs on the host. When ExecSpace is a device
+   *  execution space, the distances are copied to the host and back.
+   *
+   * \pre mesh != nullptr
+   * \pre bandWidth >= 0
+   * \pre outSgnDist != nullptr
+   */
+  IndexType computeNarrowBandDistances(const mint::StructuredMesh* mesh,
+                                       double bandWidth,
+                                       double* outSgnDist) const;
+
   /*!
    * \brief Returns a const reference to the underlying bucket tree.
    * \return ptr pointer to the underlying bucket tree
@@ -338,6 +562,14 @@ public:
   const BVHTreeType& getBVHTree() const { return m_bvh; }
 
 private:
+  using WindingNode = detail::WindingNode<NDIMS>;
+
+  /*!
+   * \brief Computes the far-field data of the cells in each bin of the BVH,
+   *  for SignMethod::WindingNumber.
+   */
+  void buildWindingNodes();
+
   /*!
    * \brief Computes the bounding box of the given cell on the surface mesh.
    * \param [in] icell the index of the cell on the surface mesh.
@@ -350,6 +582,19 @@ private:
                                                      const detail::UcdMeshData& mesh,
                                                      ZipPoint meshPts);
 
+  /*!
+   * \brief Splits the given cell on the surface mesh into triangles.
+   * \param [in] cellId the index of the cell on the surface mesh.
+   * \param [in] mesh the surface mesh data
+   * \param [in] meshPts the surface mesh point coordinate data
+   * \param [out] tris the triangles of the cell
+   * \return the number of triangles: 2 for a quad, 1 otherwise.
+   */
+  AXOM_HOST_DEVICE static int getCellTriangles(IndexType cellId,
+                                               const detail::UcdMeshData& mesh,
+                                               ZipPoint meshPts,
+                                               TriangleType tris[2]);
+
   /*!
    * \brief Checks a given candidate surface element against a query point
    *  and updates the minimum-distance candidate data if the element is closer.
@@ -369,6 +614,81 @@ private:
                                               ZipPoint meshPts,
                                               bool computeSign);
 
+  /*!
+   * \brief Traverses the BVH to find the closest surface element to a query
+   *  point.
+   *
+   * \param [in] it the BVH traverser
+   * \param [in] qpt the query point
+   * \param [in,out] currMin the minimum-distance candidate data. Only the
+   *  elements closer than its initial squared distance are considered.
+   * \param [in] mesh the surface mesh data
+   * \param [in] meshPts the surface mesh point coordinate data
+   * \param [in] computeSign if true, will compute normals for the minimum
+   *  candidate to use in determining sign
+   */
+  template <typename TraverserType>
+  AXOM_HOST_DEVICE static void findMinCandidate(const TraverserType& it,
+                                                const PointType& qpt,
+                                                MinCandidate& currMin,
+                                                const detail::UcdMeshData& mesh,
+                                                ZipPoint meshPts,
+                                                bool computeSign);
+
+  /*!
+   * \brief Returns the signed distance of a query point given the closest
+   *  point data
+   *
+   * \param [in] qpt the query point
+   * \param [in] currMin the minimum-distance surface element data
+   * \param [in] watertightInput whether the surface mesh is watertight
+   * \param [in] boxDomain bounding box of the surface mesh
+   * \param [in] computeSigns if false, the distance is unsigned
+   */
+  AXOM_HOST_DEVICE static double getSignedDistance(const PointType& qpt,
+                                                   const MinCandidate& currMin,
+                                                   bool watertightInput,
+                                                   const BoxType& boxDomain,
+                                                   bool computeSigns);
+
+  /*!
+   * \brief Returns the sign of a query point from the generalized winding
+   *  number of the surface mesh at that point.
+   *
+   * \param [in] it the BVH traverser
+   * \param [in] qpt the query point
+   * \param [in] nodes the far-field data of the BVH bins
+   * \param [in] accuracy the ratio of the distance to the radius of a bin
+   *  above which the bin is approximated by its dipole
+   * \param [in] mesh the surface mesh data
+   * \param [in] meshPts the surface mesh point coordinate data
+   *
+   * \return 1.0 if outside, -1.0 if inside
+   *
+   * \see setSignMethod()
+   */
+  template <typename TraverserType>
+  AXOM_HOST_DEVICE static double getWindingNumberSign(
+    const TraverserType& it,
+    const PointType& qpt,
+    axom::ArrayView<const WindingNode> nodes,
+    double accuracy,
+    const detail::UcdMeshData& mesh,
+    ZipPoint meshPts);
+
+  /*!
+   * \brief Implements computeDistances() for queries sorted along a Morton
+   *  curve.
+   *
+   * \see setSortQueries()
+   */
+  template <typename PointIndexable>
+  void computeSortedDistances(int npts,
+                              PointIndexable queryPts,
+                              double* outSgnDist,
+                              PointType* outClosestPts,
+                              VectorType* outNormals) const;
+
   /*!
    * \brief Returns the surface (pseudo)-normal at the closest point
    * to the query point associated with \a currMin
@@ -391,10 +711,18 @@ private:
 private:
   bool m_isInputWatertight;        /*!< indicates if input is watertight     */
   bool m_computeSign;              /*!< indicates if queries compute sign    */
+  bool m_sortQueries {false};      /*!< indicates if queries are reordered   */
   const mint::Mesh* m_surfaceMesh; /*!< User-supplied surface mesh.          */
   BoxType m_boxDomain;             /*!< bounding box containing surface mesh */
   BVHTreeType m_bvh;               /*!< Spatial acceleration data-structure. */
 
+  /*! method used to compute the signs of the distances */
+  SignMethod m_signMethod {SignMethod::PseudoNormal};
+  /*! distance-to-radius ratio of the winding number approximation */
+  double m_windingAccuracy {2.0};
+  /*! far-field data of the BVH bins, for winding numbers */
+  axom::Array<WindingNode> m_windingNodes;
+
   DISABLE_COPY_AND_ASSIGNMENT(SignedDistance);
 };
 
@@ -505,7 +833,115 @@ bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
   int result = m_bvh.initialize(boxes, ncells);
 
   axom::deallocate(boxes);
-  return (result == spin::BVH_BUILD_OK);
+
+  const bool built = (result == spin::BVH_BUILD_OK);
+  if(built && m_signMethod == SignMethod::WindingNumber)
+  {
+    buildWindingNodes();
+  }
+  return built;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+inline void SignedDistance<NDIMS, ExecSpace>::setSignMethod(SignMethod method,
+                                                            double accuracy)
+{
+  SLIC_ERROR_IF(method == SignMethod::WindingNumber && NDIMS != 3,
+                "Winding numbers are only supported for 3D surface meshes");
+  SLIC_ASSERT(accuracy > 1.0);
+
+  m_signMethod = method;
+  m_windingAccuracy = accuracy;
+  if(m_signMethod == SignMethod::WindingNumber && m_surfaceMesh != nullptr)
+  {
+    buildWindingNodes();
+  }
+  else
+  {
+    m_windingNodes.clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+inline void SignedDistance<NDIMS, ExecSpace>::buildWindingNodes()
+{
+  AXOM_PERF_MARK_FUNCTION("SignedDistance::buildWindingNodes");
+
+  auto it = m_bvh.getTraverser();
+  const IndexType nbins = it.getNumBins();
+  m_windingNodes =
+    axom::Array<WindingNode>(nbins, nbins, m_bvh.getAllocatorID());
+  const auto nodes_v = m_windingNodes.view();
+
+  const double* xs = m_surfaceMesh->getCoordinateArray(0);
+  const double* ys = m_surfaceMesh->getCoordinateArray(1);
+  const double* zs = nullptr;
+  if(NDIMS == 3)
+  {
+    zs = m_surfaceMesh->getCoordinateArray(2);
+  }
+
+  ZipPoint surf_pts {{xs, ys, zs}};
+
+  detail::UcdMeshData surfaceData;
+  bool result = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
+  AXOM_UNUSED_VAR(result);
+  SLIC_CHECK_MSG(result, "Input mesh is not an unstructured surface mesh");
+
+  // Each bin sums the moments of the cells below it; the total work is
+  // proportional to the number of cells times the depth of the BVH
+  for_all<ExecSpace>(
+    nbins,
+    AXOM_LAMBDA(IndexType bin) {
+      const BoxType& box = it.getBin(bin);
+      WindingNode node;
+      if(!box.isValid())
+      {
+        nodes_v[bin] = node;
+        return;
+      }
+
+      double area = 0.0;
+      VectorType weightedCenter {};
+      auto addCell = [&](int32 current_node, const int32* leaf_nodes) {
+        TriangleType tris[2];
+        const int ntris = getCellTriangles(leaf_nodes[current_node],
+                                           surfaceData,
+                                           surf_pts,
+                                           tris);
+        for(int i = 0; i < ntris; ++i)
+        {
+          const VectorType n = detail::getAreaNormal(tris[i]);
+          const double a = n.norm();
+          const VectorType centroid = (VectorType(tris[i][0]) +
+                                       VectorType(tris[i][1]) +
+                                       VectorType(tris[i][2])) /
+            3.0;
+          node.areaNormal += n;
+          weightedCenter += a * centroid;
+          area += a;
+        }
+      };
+      it.traverse_bin_leaves(bin, addCell);
+
+      node.center = (area > 0.0) ? PointType((weightedCenter / area).array())
+                                 : box.getCentroid();
+
+      // Distance from the center to the furthest corner of the bin
+      double sqRadius = 0.0;
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        const double extent =
+          axom::utilities::max(node.center[d] - box.getMin()[d],
+                               box.getMax()[d] - node.center[d]);
+        sqRadius += extent * extent;
+      }
+      node.radius = sqrt(sqRadius);
+
+      nodes_v[bin] = node;
+    });
 }
 
 //------------------------------------------------------------------------------
@@ -544,6 +980,16 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
   SLIC_ASSERT(m_surfaceMesh != nullptr);
   SLIC_ASSERT(outSgnDist != nullptr);
 
+  if(m_sortQueries && npts > 1)
+  {
+    computeSortedDistances(npts,
+                           queryPts,
+                           outSgnDist,
+                           outClosestPts,
+                           outNormals);
+    return;
+  }
+
   // Get a device-useable iterator
   auto it = m_bvh.getTraverser();
 
@@ -561,6 +1007,10 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
   const bool watertightInput = m_isInputWatertight;
   const BoxType boxDomain = m_boxDomain;
   const bool computeSigns = m_computeSign;
+  const bool useWindingNumber =
+    computeSigns && m_signMethod == SignMethod::WindingNumber;
+  const double windingAccuracy = m_windingAccuracy;
+  const auto windingNodes = m_windingNodes.view();
 
   detail::UcdMeshData surfaceData;
   bool result = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
@@ -575,38 +1025,31 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
         PointType qpt = queryPts[idx];
 
         MinCandidate curr_min {};
-
-        auto searchMinDist = [&](int32 current_node, const int32* leaf_nodes) {
-          int candidate_idx = leaf_nodes[current_node];
-
-          checkCandidate(qpt,
+        findMinCandidate(it,
+                         qpt,
                          curr_min,
-                         candidate_idx,
                          surfaceData,
                          surf_pts,
                          computeSigns);
-        };
-
-        auto traversePredicate = [&](const PointType& p,
-                                     const BoxType& bb) -> bool {
-          return axom::primal::squared_distance(p, bb) <= curr_min.minSqDist;
-        };
 
-        // Traverse the tree, searching for the point with minimum distance.
-        it.traverse_tree(qpt, searchMinDist, traversePredicate);
-
-        double sgn = 1.0;
-        if(computeSigns)
+        if(useWindingNumber)
         {
-          // STEP 0: if point is outside the bounding box of the surface mesh, then
-          // it is outside, just return 1.0
-          if(!(watertightInput && !boxDomain.contains(curr_min.minPt)))
-          {
-            sgn = computeSign(qpt, curr_min);
-          }
+          outSgnDist[idx] = sqrt(curr_min.minSqDist) *
+            getWindingNumberSign(it,
+                                 qpt,
+                                 windingNodes,
+                                 windingAccuracy,
+                                 surfaceData,
+                                 surf_pts);
+        }
+        else
+        {
+          outSgnDist[idx] = getSignedDistance(qpt,
+                                              curr_min,
+                                              watertightInput,
+                                              boxDomain,
+                                              computeSigns);
         }
-
-        outSgnDist[idx] = sqrt(curr_min.minSqDist) * sgn;
         if(outClosestPts)
         {
           outClosestPts[idx] = curr_min.minPt;
@@ -619,6 +1062,462 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
       }););
 }
 
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+template <typename PointIndexable>
+inline void SignedDistance<NDIMS, ExecSpace>::computeSortedDistances(
+  int npts,
+  PointIndexable queryPts,
+  double* outSgnDist,
+  PointType* outClosestPts,
+  VectorType* outNormals) const
+{
+  // Number of consecutive sorted queries evaluated by each thread
+  constexpr int CHUNK_SIZE = 32;
+
+  using MortonType = axom::uint64;
+  using QuantizedCoordType = axom::uint32;
+  using MortonizerType =
+    spin::Mortonizer<QuantizedCoordType, MortonType, NDIMS>;
+
+  const int allocatorID = m_bvh.getAllocatorID();
+
+  // STEP 1: sort the queries by the Morton code of their cell in a lattice
+  // over the bounding box of the queries
+  BoxType queryBox;
+#ifdef AXOM_USE_RAJA
+  using reduce_policy =
+    typename axom::execution_space<ExecSpace>::reduce_policy;
+
+  double minInit = numerics::floating_point_limits<double>::max();
+  double maxInit = numerics::floating_point_limits<double>::lowest();
+  RAJA::ReduceMin<reduce_policy, double> xmin(minInit), ymin(minInit),
+    zmin(minInit);
+
+  RAJA::ReduceMax<reduce_policy, double> xmax(maxInit), ymax(maxInit),
+    zmax(maxInit);
+
+  for_all<ExecSpace>(
+    npts,
+    AXOM_LAMBDA(int32 idx) {
+      const PointType qpt = queryPts[idx];
+      xmin.min(qpt[0]);
+      xmax.max(qpt[0]);
+
+      ymin.min(qpt[1]);
+      ymax.max(qpt[1]);
+
+      if(NDIMS == 3)
+      {
+        zmin.min(qpt[2]);
+        zmax.max(qpt[2]);
+      }
+    });
+  PointType boxMin {xmin.get(), ymin.get(), zmin.get()};
+  PointType boxMax {xmax.get(), ymax.get(), zmax.get()};
+  queryBox = BoxType {boxMin, boxMax};
+#else
+  for(int32 idx = 0; idx < npts; ++idx)
+  {
+    queryBox.addPoint(queryPts[idx]);
+  }
+#endif
+
+  // Fit as many bits as possible per dimension into a 64-bit Morton code
+  constexpr int MORTON_BITS = (NDIMS == 2) ? 31 : 21;
+  const primal::NumericArray<QuantizedCoordType, NDIMS> res(
+    (QuantizedCoordType {1} << MORTON_BITS) - 1);
+  const auto lattice =
+    spin::rectangular_lattice_from_bounding_box(queryBox, res);
+
+  axom::Array<MortonType> mcodes(npts, npts, allocatorID);
+  axom::Array<IndexType> order(npts, npts, allocatorID);
+  const auto mcodes_v = mcodes.view();
+  const auto order_v = order.view();
+  for_all<ExecSpace>(
+    npts,
+    AXOM_LAMBDA(IndexType idx) {
+      const PointType qpt = queryPts[idx];
+      mcodes_v[idx] = MortonizerType::mortonize(lattice.gridCell(qpt));
+      order_v[idx] = idx;
+    });
+
+  auto mortonLess = AXOM_LAMBDA(IndexType a, IndexType b)
+  {
+    return mcodes_v[a] != mcodes_v[b] ? mcodes_v[a] < mcodes_v[b] : a < b;
+  };
+
+#ifdef AXOM_USE_RAJA
+  using exec_pol = typename axom::execution_space<ExecSpace>::loop_policy;
+  RAJA::sort<exec_pol>(RAJA::make_span(order.data(), npts), mortonLess);
+#else
+  std::sort(order.begin(), order.end(), mortonLess);
+#endif
+
+  // STEP 2: evaluate chunks of consecutive sorted queries, bounding the
+  // distance of each query by the distance of the previous one
+  auto it = m_bvh.getTraverser();
+
+  const double* xs = m_surfaceMesh->getCoordinateArray(0);
+  const double* ys = m_surfaceMesh->getCoordinateArray(1);
+  const double* zs = nullptr;
+  if(NDIMS == 3)
+  {
+    zs = m_surfaceMesh->getCoordinateArray(2);
+  }
+
+  ZipPoint surf_pts {{xs, ys, zs}};
+
+  const bool watertightInput = m_isInputWatertight;
+  const BoxType boxDomain = m_boxDomain;
+  const bool computeSigns = m_computeSign;
+  const bool useWindingNumber =
+    computeSigns && m_signMethod == SignMethod::WindingNumber;
+  const double windingAccuracy = m_windingAccuracy;
+  const auto windingNodes = m_windingNodes.view();
+
+  detail::UcdMeshData surfaceData;
+  bool result = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
+  AXOM_UNUSED_VAR(result);
+  SLIC_CHECK_MSG(result, "Input mesh is not an unstructured surface mesh");
+
+  const IndexType nchunks = (npts + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  AXOM_PERF_MARK_SECTION(
+    "ComputeSortedDistances",
+    for_all<ExecSpace>(
+      nchunks,
+      AXOM_LAMBDA(IndexType ichunk) {
+        const IndexType begin = ichunk * CHUNK_SIZE;
+        const IndexType end =
+          axom::utilities::min<IndexType>(begin + CHUNK_SIZE, npts);
+
+        PointType prevPt;
+        double prevDist = -1.0;
+        for(IndexType k = begin; k < end; ++k)
+        {
+          const IndexType idx = order_v[k];
+          const PointType qpt = queryPts[idx];
+
+          // By the triangle inequality, the closest element is no further
+          // than the previous query's distance plus the distance between the
+          // two queries. Pad the bound to keep elements at that distance.
+          MinCandidate curr_min {};
+          if(prevDist >= 0.0)
+          {
+            const double bound =
+              prevDist + sqrt(axom::primal::squared_distance(qpt, prevPt));
+            curr_min.minSqDist = bound * bound * (1.0 + 1e-10) + 1e-300;
+          }
+          findMinCandidate(it,
+                           qpt,
+                           curr_min,
+                           surfaceData,
+                           surf_pts,
+                           computeSigns);
+
+          // Search again without the bound if it excluded every element
+          if(curr_min.minType == detail::ClosestPointLocType::uninitialized)
+          {
+            curr_min = MinCandidate {};
+            findMinCandidate(it,
+                             qpt,
+                             curr_min,
+                             surfaceData,
+                             surf_pts,
+                             computeSigns);
+          }
+          prevPt = qpt;
+          prevDist = sqrt(curr_min.minSqDist);
+
+          if(useWindingNumber)
+          {
+            outSgnDist[idx] = prevDist *
+              getWindingNumberSign(it,
+                                   qpt,
+                                   windingNodes,
+                                   windingAccuracy,
+                                   surfaceData,
+                                   surf_pts);
+          }
+          else
+          {
+            outSgnDist[idx] = getSignedDistance(qpt,
+                                                curr_min,
+                                                watertightInput,
+                                                boxDomain,
+                                                computeSigns);
+          }
+          if(outClosestPts)
+          {
+            outClosestPts[idx] = curr_min.minPt;
+          }
+
+          if(outNormals)
+          {
+            outNormals[idx] = getSurfaceNormal(curr_min).unitVector();
+          }
+        }
+      }););
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+inline IndexType SignedDistance<NDIMS, ExecSpace>::computeNarrowBandDistances(
+  const mint::StructuredMesh* mesh,
+  double bandWidth,
+  double* outSgnDist) const
+{
+  AXOM_PERF_MARK_FUNCTION("SignedDistance::computeNarrowBandDistances");
+  SLIC_ASSERT(mesh != nullptr);
+  SLIC_ASSERT(m_surfaceMesh != nullptr);
+  SLIC_ASSERT(bandWidth >= 0.0);
+  SLIC_ASSERT(outSgnDist != nullptr);
+
+  const int meshType = mesh->getMeshType();
+  SLIC_ERROR_IF(meshType != mint::STRUCTURED_UNIFORM_MESH &&
+                  meshType != mint::STRUCTURED_RECTILINEAR_MESH,
+                "Narrow band distances require a uniform or rectilinear mesh");
+  SLIC_ERROR_IF(mesh->getDimension() != NDIMS,
+                "Mesh dimension " << mesh->getDimension()
+                                  << " does not match the surface dimension "
+                                  << NDIMS);
+
+  const int allocatorID = m_bvh.getAllocatorID();
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  constexpr bool onDevice = axom::execution_space<ExecSpace>::onDevice();
+
+  // Gather the node coordinates along each axis
+  const IndexType nnodes = mesh->getNumberOfNodes();
+  detail::StructuredMeshNodes<NDIMS> meshNodes;
+  IndexType numCoords = 0;
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    meshNodes.offsets[d] = numCoords;
+    meshNodes.resolution[d] = mesh->getNodeResolution(d);
+    numCoords += meshNodes.resolution[d];
+  }
+
+  axom::Array<double> hostCoords(numCoords, numCoords, hostAllocatorID);
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    double* axisCoords = hostCoords.data() + meshNodes.offsets[d];
+    if(meshType == mint::STRUCTURED_UNIFORM_MESH)
+    {
+      const auto* umesh = static_cast<const mint::UniformMesh*>(mesh);
+      for(IndexType i = 0; i < meshNodes.resolution[d]; ++i)
+      {
+        axisCoords[i] = umesh->evaluateCoordinate(i, d);
+      }
+    }
+    else
+    {
+      const double* meshCoords = mesh->getCoordinateArray(d);
+      std::copy(meshCoords, meshCoords + meshNodes.resolution[d], axisCoords);
+    }
+  }
+  const axom::Array<double> coords(hostCoords, allocatorID);
+  meshNodes.coords = coords.data();
+
+  // Get mesh data
+  const double* xs = m_surfaceMesh->getCoordinateArray(0);
+  const double* ys = m_surfaceMesh->getCoordinateArray(1);
+  const double* zs = nullptr;
+  if(NDIMS == 3)
+  {
+    zs = m_surfaceMesh->getCoordinateArray(2);
+  }
+
+  ZipPoint surf_pts {{xs, ys, zs}};
+
+  detail::UcdMeshData surfaceData;
+  bool result = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
+  AXOM_UNUSED_VAR(result);
+  SLIC_CHECK_MSG(result, "Input mesh is not an unstructured surface mesh");
+
+  // STEP 1: flag the nodes in the band around each surface cell
+  axom::Array<IndexType> inBand(nnodes, nnodes, allocatorID);
+  const auto inBandView = inBand.view();
+  for_all<ExecSpace>(
+    nnodes,
+    AXOM_LAMBDA(IndexType inode) { inBandView[inode] = 0; });
+
+#ifdef AXOM_USE_RAJA
+  using atomic_pol = typename axom::execution_space<ExecSpace>::atomic_policy;
+#endif
+
+  const IndexType ncells = m_surfaceMesh->getNumberOfCells();
+  for_all<ExecSpace>(
+    ncells,
+    AXOM_LAMBDA(IndexType icell) {
+      BoxType bb = getCellBoundingBox(icell, surfaceData, surf_pts);
+      bb.expand(bandWidth);
+
+      // Range of nodes along each axis, extended by one node on each side
+      IndexType lower[3] = {0, 0, 0};
+      IndexType upper[3] = {0, 0, 0};
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        const double* axisCoords = meshNodes.coords + meshNodes.offsets[d];
+        const IndexType n = meshNodes.resolution[d];
+        const double lo = bb.getMin()[d];
+        const double hi = bb.getMax()[d];
+        if(hi < axisCoords[0] || lo > axisCoords[n - 1])
+        {
+          return;
+        }
+        lower[d] = detail::lowerBoundIndex(axisCoords, n, lo) - 1;
+        upper[d] = detail::lowerBoundIndex(axisCoords, n, hi) + 1;
+        lower[d] = axom::utilities::clampLower<IndexType>(lower[d], 0);
+        upper[d] = axom::utilities::clampUpper<IndexType>(upper[d], n - 1);
+      }
+
+      const IndexType jStride = meshNodes.resolution[0];
+      const IndexType kStride =
+        (NDIMS == 3) ? jStride * meshNodes.resolution[1] : 0;
+      for(IndexType k = lower[2]; k <= upper[2]; ++k)
+      {
+        for(IndexType j = lower[1]; j <= upper[1]; ++j)
+        {
+          const IndexType offset = j * jStride + k * kStride;
+          for(IndexType i = lower[0]; i <= upper[0]; ++i)
+          {
+#ifdef AXOM_USE_RAJA
+            RAJA::atomicExchange<atomic_pol>(&inBandView[offset + i],
+                                             IndexType {1});
+#else
+            inBandView[offset + i] = 1;
+#endif
+          }
+        }
+      }
+    });
+
+  // STEP 2: gather the indices of the band nodes
+  axom::Array<IndexType> offsets(nnodes, nnodes, allocatorID);
+#ifdef AXOM_USE_RAJA
+  using loop_pol = typename axom::execution_space<ExecSpace>::loop_policy;
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+
+  RAJA::exclusive_scan<loop_pol>(RAJA::make_span(inBand.data(), nnodes),
+                                 RAJA::make_span(offsets.data(), nnodes),
+                                 RAJA::operators::plus<IndexType> {});
+  RAJA::ReduceSum<reduce_pol, IndexType> bandSum(0);
+  for_all<ExecSpace>(
+    nnodes,
+    AXOM_LAMBDA(IndexType inode) { bandSum += inBandView[inode]; });
+  IndexType numBand = bandSum.get();
+#else
+  IndexType numBand = 0;
+  for(IndexType inode = 0; inode < nnodes; ++inode)
+  {
+    offsets[inode] = numBand;
+    numBand += inBand[inode];
+  }
+#endif
+
+  axom::Array<IndexType> bandNodes;
+  if(numBand > 0)
+  {
+    bandNodes = axom::Array<IndexType>(numBand, numBand, allocatorID);
+    const auto offsetsView = offsets.view();
+    const auto bandNodesView = bandNodes.view();
+    for_all<ExecSpace>(
+      nnodes,
+      AXOM_LAMBDA(IndexType inode) {
+        if(inBandView[inode])
+        {
+          bandNodesView[offsetsView[inode]] = inode;
+        }
+      });
+  }
+  else
+  {
+    // The surface does not overlap the mesh; use the first node to find the
+    // sign of all nodes
+    const IndexType firstNode = 0;
+    const IndexType inBandFlag = 1;
+    numBand = 1;
+    bandNodes = axom::Array<IndexType>(1, 1, allocatorID);
+    axom::copy(bandNodes.data(), &firstNode, sizeof(IndexType));
+    axom::copy(inBand.data(), &inBandFlag, sizeof(IndexType));
+  }
+
+  // STEP 3: compute the distances of the band nodes
+  axom::Array<double> bandDist(numBand, numBand, allocatorID);
+  meshNodes.nodes = bandNodes.data();
+  this->computeDistances(numBand, meshNodes, bandDist.data());
+
+  const auto bandNodesView = bandNodes.view();
+  const auto bandDistView = bandDist.view();
+  for_all<ExecSpace>(
+    numBand,
+    AXOM_LAMBDA(IndexType idx) {
+      outSgnDist[bandNodesView[idx]] =
+        axom::utilities::clampVal(bandDistView[idx], -bandWidth, bandWidth);
+    });
+
+  // STEP 4: flood fill the nodes outside the band from the band nodes, with
+  // a breadth-first search over the mesh edges
+  axom::Array<IndexType> hostInBand = onDevice
+    ? axom::Array<IndexType>(inBand, hostAllocatorID)
+    : std::move(inBand);
+  axom::Array<double> hostDistCopy;
+  double* hostDist = outSgnDist;
+  if(onDevice)
+  {
+    hostDistCopy = axom::Array<double>(nnodes, nnodes, hostAllocatorID);
+    axom::copy(hostDistCopy.data(), outSgnDist, nnodes * sizeof(double));
+    hostDist = hostDistCopy.data();
+  }
+
+  IndexType strides[NDIMS];
+  strides[0] = 1;
+  for(int d = 1; d < NDIMS; ++d)
+  {
+    strides[d] = strides[d - 1] * meshNodes.resolution[d - 1];
+  }
+
+  std::vector<IndexType> queue;
+  queue.reserve(nnodes);
+  for(IndexType inode = 0; inode < nnodes; ++inode)
+  {
+    if(hostInBand[inode])
+    {
+      queue.push_back(inode);
+    }
+  }
+
+  for(std::size_t head = 0; head < queue.size(); ++head)
+  {
+    const IndexType inode = queue[head];
+    const double farDist = (hostDist[inode] < 0.0) ? -bandWidth : bandWidth;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const IndexType idx = (inode / strides[d]) % meshNodes.resolution[d];
+      if(idx > 0 && !hostInBand[inode - strides[d]])
+      {
+        hostInBand[inode - strides[d]] = 1;
+        hostDist[inode - strides[d]] = farDist;
+        queue.push_back(inode - strides[d]);
+      }
+      if(idx + 1 < meshNodes.resolution[d] && !hostInBand[inode + strides[d]])
+      {
+        hostInBand[inode + strides[d]] = 1;
+        hostDist[inode + strides[d]] = farDist;
+        queue.push_back(inode + strides[d]);
+      }
+    }
+  }
+
+  if(onDevice)
+  {
+    axom::copy(outSgnDist, hostDist, nnodes * sizeof(double));
+  }
+
+  return numBand;
+}
+
 //------------------------------------------------------------------------------
 template <int NDIMS, typename ExecSpace>
 AXOM_HOST_DEVICE inline axom::primal::BoundingBox<double, NDIMS>
@@ -650,30 +1549,41 @@ SignedDistance<NDIMS, ExecSpace>::getCellBoundingBox(axom::IndexType icell,
 
 //------------------------------------------------------------------------------
 template <int NDIMS, typename ExecSpace>
-AXOM_HOST_DEVICE inline void SignedDistance<NDIMS, ExecSpace>::checkCandidate(
-  const PointType& qpt,
-  MinCandidate& currMin,
+AXOM_HOST_DEVICE inline int SignedDistance<NDIMS, ExecSpace>::getCellTriangles(
   IndexType cellId,
   const detail::UcdMeshData& mesh,
   ZipPoint meshPts,
-  bool computeNormal)
+  TriangleType tris[2])
 {
   int nnodes;
   const IndexType* nodes = mesh.getCellNodeIDs(cellId, nnodes);
   SLIC_ASSERT(nnodes <= 4);
 
-  TriangleType surface_elems[2];
-
-  int num_candidates = 1;
-  surface_elems[0] =
+  tris[0] =
     TriangleType {meshPts[nodes[0]], meshPts[nodes[1]], meshPts[nodes[2]]};
 
   if(nnodes == 4)
   {
-    num_candidates = 2;
-    surface_elems[1] =
+    tris[1] =
       TriangleType {meshPts[nodes[0]], meshPts[nodes[2]], meshPts[nodes[3]]};
+    return 2;
   }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+AXOM_HOST_DEVICE inline void SignedDistance<NDIMS, ExecSpace>::checkCandidate(
+  const PointType& qpt,
+  MinCandidate& currMin,
+  IndexType cellId,
+  const detail::UcdMeshData& mesh,
+  ZipPoint meshPts,
+  bool computeNormal)
+{
+  TriangleType surface_elems[2];
+  const int num_candidates =
+    getCellTriangles(cellId, mesh, meshPts, surface_elems);
 
   using axom::primal::closest_point;
   using axom::primal::squared_distance;
@@ -756,6 +1666,101 @@ AXOM_HOST_DEVICE inline void SignedDistance<NDIMS, ExecSpace>::checkCandidate(
   }
 }
 
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+template <typename TraverserType>
+AXOM_HOST_DEVICE inline void SignedDistance<NDIMS, ExecSpace>::findMinCandidate(
+  const TraverserType& it,
+  const PointType& qpt,
+  MinCandidate& currMin,
+  const detail::UcdMeshData& mesh,
+  ZipPoint meshPts,
+  bool computeSign)
+{
+  auto searchMinDist = [&](int32 current_node, const int32* leaf_nodes) {
+    int candidate_idx = leaf_nodes[current_node];
+
+    checkCandidate(qpt, currMin, candidate_idx, mesh, meshPts, computeSign);
+  };
+
+  auto traversePredicate = [&](const PointType& p, const BoxType& bb) -> bool {
+    return axom::primal::squared_distance(p, bb) <= currMin.minSqDist;
+  };
+
+  // Traverse the tree, searching for the point with minimum distance.
+  it.traverse_tree(qpt, searchMinDist, traversePredicate);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+template <typename TraverserType>
+AXOM_HOST_DEVICE inline double
+SignedDistance<NDIMS, ExecSpace>::getWindingNumberSign(
+  const TraverserType& it,
+  const PointType& qpt,
+  axom::ArrayView<const WindingNode> nodes,
+  double accuracy,
+  const detail::UcdMeshData& mesh,
+  ZipPoint meshPts)
+{
+  // Sum of the solid angles of the cells, i.e., 4*pi times the winding number
+  double solidAngle = 0.0;
+
+  // Bins far from the query point contribute through their dipole
+  auto farField = [&](const PointType& p, const BoxType&, int32 bin) -> bool {
+    const WindingNode& node = nodes[bin];
+    const VectorType r(p, node.center);
+    const double dist = r.norm();
+    if(dist <= accuracy * node.radius)
+    {
+      return false;
+    }
+    solidAngle += node.areaNormal.dot(r) / (dist * dist * dist);
+    return true;
+  };
+
+  // Cells close to the query point contribute their exact solid angles
+  auto nearField = [&](int32 current_node, const int32* leaf_nodes) {
+    TriangleType tris[2];
+    const int ntris =
+      getCellTriangles(leaf_nodes[current_node], mesh, meshPts, tris);
+    for(int i = 0; i < ntris; ++i)
+    {
+      solidAngle += detail::getSolidAngle(qpt, tris[i]);
+    }
+  };
+
+  it.traverse_approximate(qpt, nearField, farField);
+
+  // The point is inside when the winding number is at least 1/2
+  constexpr double TWO_PI = 6.283185307179586;
+  return (solidAngle >= TWO_PI) ? -1.0 : 1.0;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+AXOM_HOST_DEVICE inline double
+SignedDistance<NDIMS, ExecSpace>::getSignedDistance(
+  const PointType& qpt,
+  const MinCandidate& currMin,
+  bool watertightInput,
+  const BoxType& boxDomain,
+  bool computeSigns)
+{
+  double sgn = 1.0;
+  if(computeSigns)
+  {
+    // STEP 0: if point is outside the bounding box of the surface mesh, then
+    // it is outside, just return 1.0
+    if(!(watertightInput && !boxDomain.contains(currMin.minPt)))
+    {
+      sgn = computeSign(qpt, currMin);
+    }
+  }
+
+  return sqrt(currMin.minSqDist) * sgn;
+}
+
 //------------------------------------------------------------------------------
 template <int NDIMS, typename ExecSpace>
 AXOM_HOST_DEVICE inline typename SignedDistance<NDIMS, ExecSpace>::VectorType
@@ -6,6 +6,17 @@
 #ifndef AXOM_QUEST_ALL_NEAREST_NEIGHBORS_DETAIL_HPP_
 #define AXOM_QUEST_ALL_NEAREST_NEIGHBORS_DETAIL_HPP_
 
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/primal/geometry/BoundingBox.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
 namespace axom
 {
 namespace quest
@@ -13,12 +24,12 @@ namespace quest
 namespace detail
 {
 //------------------------------------------------------------------------------
-inline double squared_distance(double x1,
-                               double y1,
-                               double z1,
-                               double x2,
-                               double y2,
-                               double z2)
+AXOM_HOST_DEVICE inline double squared_distance(double x1,
+                                                double y1,
+                                                double z1,
+                                                double x2,
+                                                double y2,
+                                                double z2)
 {
   double dx = x2 - x1;
   double dy = y2 - y1;
@@ -27,6 +38,100 @@ inline double squared_distance(double x1,
   return dx * dx + dy * dy + dz * dz;
 }
 
+//------------------------------------------------------------------------------
+/*!
+ * \brief A point stored in the bins of the all-nearest-neighbors index
+ */
+struct CandidatePoint
+{
+  double x;
+  double y;
+  double z;
+  IndexType index;
+  int region;
+};
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Computes the bounding box of the given points in the execution space
+ */
+template <typename ExecSpace>
+primal::BoundingBox<double, 3> points_bounds(const double* x,
+                                             const double* y,
+                                             const double* z,
+                                             IndexType n)
+{
+  using PointType = primal::Point<double, 3>;
+
+  primal::BoundingBox<double, 3> bounds;
+  if(n == 0)
+  {
+    return bounds;
+  }
+
+#ifdef AXOM_USE_RAJA
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  constexpr double MAX = axom::numerics::floating_point_limits<double>::max();
+  RAJA::ReduceMin<reduce_pol, double> xmin(MAX), ymin(MAX), zmin(MAX);
+  RAJA::ReduceMax<reduce_pol, double> xmax(-MAX), ymax(-MAX), zmax(-MAX);
+
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType i) {
+      xmin.min(x[i]);
+      ymin.min(y[i]);
+      zmin.min(z[i]);
+      xmax.max(x[i]);
+      ymax.max(y[i]);
+      zmax.max(z[i]);
+    });
+
+  bounds.addPoint(PointType {xmin.get(), ymin.get(), zmin.get()});
+  bounds.addPoint(PointType {xmax.get(), ymax.get(), zmax.get()});
+#else
+  for(IndexType i = 0; i < n; ++i)
+  {
+    bounds.addPoint(PointType {x[i], y[i], z[i]});
+  }
+#endif
+
+  return bounds;
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Computes the resolution of a grid over the given bounds with bins
+ *  of about the given width, using at most about 4 bins per point.
+ *
+ * Coarser bins only add candidates to the queries, so the cap bounds the
+ * memory of the grid for sparse point clouds without changing the results.
+ */
+inline primal::NumericArray<int, 3> grid_resolution(
+  const primal::BoundingBox<double, 3>& bounds,
+  double width,
+  IndexType n)
+{
+  const auto range = bounds.range();
+  double res[3];
+  double numBins = 1.;
+  for(int d = 0; d < 3; ++d)
+  {
+    res[d] = std::max(1., std::floor(range[d] / width + 0.5));
+    numBins *= res[d];
+  }
+
+  const double maxBins = 4. * std::max(n, IndexType {1});
+  const double scale =
+    numBins > maxBins ? std::cbrt(maxBins / numBins) : 1.;
+
+  primal::NumericArray<int, 3> resolution;
+  for(int d = 0; d < 3; ++d)
+  {
+    resolution[d] = static_cast<int>(std::max(1., std::floor(res[d] * scale)));
+  }
+  return resolution;
+}
+
 }  // end namespace detail
 }  // end namespace quest
 }  // end namespace axom
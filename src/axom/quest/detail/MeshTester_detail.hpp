@@ -503,6 +503,307 @@ struct CandidateFinder<AccelType::UniformGrid, ExecSpace, FloatType>
   axom::Array<IndexType> m_currCandidates;
 };
 
+/*!
+ * \brief Computes an exclusive prefix sum of \a in into \a out in the given
+ *  execution space.
+ *
+ * \return the sum of all entries of \a in
+ */
+template <typename ExecSpace>
+IndexType exclusiveScanWithTotal(axom::ArrayView<IndexType> in,
+                                 axom::ArrayView<IndexType> out)
+{
+  const IndexType n = in.size();
+  if(n == 0)
+  {
+    return 0;
+  }
+
+#ifdef AXOM_USE_RAJA
+  using exec_pol = typename axom::execution_space<ExecSpace>::loop_policy;
+  RAJA::exclusive_scan<exec_pol>(RAJA::make_span(in.data(), n),
+                                 RAJA::make_span(out.data(), n),
+                                 RAJA::operators::plus<IndexType> {});
+#else
+  IndexType sum = 0;
+  for(IndexType i = 0; i < n; ++i)
+  {
+    out[i] = sum;
+    sum += in[i];
+  }
+#endif
+
+  IndexType lastIn, lastOut;
+  axom::copy(&lastIn, in.data() + n - 1, sizeof(IndexType));
+  axom::copy(&lastOut, out.data() + n - 1, sizeof(IndexType));
+  return lastIn + lastOut;
+}
+
+/*!
+ * \brief Computes the bounding box of the vertices of a mesh in the given
+ *  execution space.
+ */
+template <typename ExecSpace>
+SpatialBoundingBox computeMeshBounds(const UMesh* mesh)
+{
+  const IndexType numVerts = mesh->getNumberOfNodes();
+  const double* x = mesh->getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh->getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = mesh->getCoordinateArray(mint::Z_COORDINATE);
+
+  SpatialBoundingBox meshBB;
+  if(numVerts == 0)
+  {
+    return meshBB;
+  }
+
+#ifdef AXOM_USE_RAJA
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  constexpr double MAX = axom::numerics::floating_point_limits<double>::max();
+  RAJA::ReduceMin<reduce_pol, double> xmin(MAX), ymin(MAX), zmin(MAX);
+  RAJA::ReduceMax<reduce_pol, double> xmax(-MAX), ymax(-MAX), zmax(-MAX);
+
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType i) {
+      xmin.min(x[i]);
+      ymin.min(y[i]);
+      zmin.min(z[i]);
+      xmax.max(x[i]);
+      ymax.max(y[i]);
+      zmax.max(z[i]);
+    });
+
+  meshBB.addPoint(Point3 {xmin.get(), ymin.get(), zmin.get()});
+  meshBB.addPoint(Point3 {xmax.get(), ymax.get(), zmax.get()});
+#else
+  for(IndexType i = 0; i < numVerts; ++i)
+  {
+    meshBB.addPoint(Point3 {x[i], y[i], z[i]});
+  }
+#endif
+
+  return meshBB;
+}
+
+/*!
+ * \brief Welds the vertices of a triangle mesh that fall into the same cell
+ *  of a lattice with spacing \a eps and the given origin.
+ *
+ * \param [in] oldMesh the triangle mesh whose vertices are welded
+ * \param [in] origin the origin of the lattice
+ * \param [in] eps the spacing of the lattice
+ * \param [out] vertexRemap the index of the new vertex for each old vertex
+ *
+ * \return a new mesh with the welded vertices and its non-degenerate
+ *  triangles.
+ *
+ * The vertices are sorted by the Morton code of their lattice cell, with
+ * ties broken by the cell coordinates and the vertex index, so that each run
+ * of equal cells starts with the vertex of smallest index. The new vertices
+ * are numbered in the order of their first occurrence in the old mesh, and
+ * take the coordinates of that vertex, which matches the results of the
+ * serial, hash-based welding in weldTriMeshVertices().
+ *
+ * \note The mesh data must be accessible from the execution space.
+ */
+template <typename ExecSpace>
+UMesh* weldTriMeshVerticesOnLattice(const UMesh* oldMesh,
+                                    const Point3& origin,
+                                    double eps,
+                                    axom::Array<IndexType>& vertexRemap)
+{
+  // Note: Use 64-bit index to accomodate small values of epsilon
+  using IdxType = axom::int64;
+  using Lattice3 = spin::RectangularLattice<3, double, IdxType>;
+  using GridCell = Lattice3::GridCell;
+  using MortonType = axom::uint64;
+
+  const int allocID = axom::execution_space<ExecSpace>::allocatorID();
+
+  const IndexType numVerts = oldMesh->getNumberOfNodes();
+  const IndexType numTris = oldMesh->getNumberOfCells();
+  const double* x = oldMesh->getCoordinateArray(mint::X_COORDINATE);
+  const double* y = oldMesh->getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = oldMesh->getCoordinateArray(mint::Z_COORDINATE);
+  const IndexType* conn = oldMesh->getCellNodesArray();
+
+  const Lattice3 lattice(origin, Lattice3::SpaceVector(Point3(eps)));
+
+  // STEP 1: quantize the vertices and compute the Morton codes of their cells
+  axom::Array<GridCell> cells(axom::ArrayOptions::Uninitialized {},
+                              numVerts,
+                              numVerts,
+                              allocID);
+  axom::Array<MortonType> mcodes(numVerts, numVerts, allocID);
+  axom::Array<IndexType> order(numVerts, numVerts, allocID);
+  const auto cells_v = cells.view();
+  const auto mcodes_v = mcodes.view();
+  const auto order_v = order.view();
+
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType i) {
+      const GridCell cell = lattice.gridCell(Point3 {x[i], y[i], z[i]});
+      cells_v[i] = cell;
+      mcodes_v[i] = spin::convertPointToMorton<MortonType>(cell);
+      order_v[i] = i;
+    });
+
+  // STEP 2: sort the vertices by their cells
+  auto cellLess = [=] AXOM_HOST_DEVICE(IndexType a, IndexType b) -> bool {
+    if(mcodes_v[a] != mcodes_v[b])
+    {
+      return mcodes_v[a] < mcodes_v[b];
+    }
+    for(int d = 0; d < 3; ++d)
+    {
+      if(cells_v[a][d] != cells_v[b][d])
+      {
+        return cells_v[a][d] < cells_v[b][d];
+      }
+    }
+    return a < b;
+  };
+
+#ifdef AXOM_USE_RAJA
+  using exec_pol = typename axom::execution_space<ExecSpace>::loop_policy;
+  RAJA::sort<exec_pol>(RAJA::make_span(order.data(), numVerts), cellLess);
+#else
+  std::sort(order.begin(), order.end(), cellLess);
+#endif
+
+  // STEP 3: find the runs of equal cells and the leading vertex of each run
+  axom::Array<IndexType> isHead(numVerts, numVerts, allocID);
+  axom::Array<IndexType> runIds(numVerts, numVerts, allocID);
+  const auto isHead_v = isHead.view();
+  const auto runIds_v = runIds.view();
+
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType j) {
+      bool head = (j == 0);
+      if(!head)
+      {
+        const GridCell& prev = cells_v[order_v[j - 1]];
+        const GridCell& curr = cells_v[order_v[j]];
+        head = (prev[0] != curr[0]) || (prev[1] != curr[1]) ||
+          (prev[2] != curr[2]);
+      }
+      isHead_v[j] = head ? 1 : 0;
+    });
+
+  const IndexType numRuns =
+    exclusiveScanWithTotal<ExecSpace>(isHead_v, runIds_v);
+
+  axom::Array<IndexType> runLeaders(numRuns, numRuns, allocID);
+  axom::Array<IndexType> leaders(numVerts, numVerts, allocID);
+  const auto runLeaders_v = runLeaders.view();
+  const auto leaders_v = leaders.view();
+
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType j) {
+      if(isHead_v[j])
+      {
+        runLeaders_v[runIds_v[j]] = order_v[j];
+      }
+    });
+
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType j) {
+      const IndexType run = runIds_v[j] + isHead_v[j] - 1;
+      leaders_v[order_v[j]] = runLeaders_v[run];
+    });
+
+  // STEP 4: number the leading vertices in order of their first occurrence
+  // Note: reuses the isHead and runIds arrays, indexed by vertex
+  const auto isLeader_v = isHead_v;
+  const auto newIds_v = runIds_v;
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType i) { isLeader_v[i] = (leaders_v[i] == i) ? 1 : 0; });
+
+  const IndexType numNewVerts =
+    exclusiveScanWithTotal<ExecSpace>(isLeader_v, newIds_v);
+  SLIC_ASSERT(numNewVerts == numRuns);
+
+  vertexRemap = axom::Array<IndexType>(numVerts, numVerts, allocID);
+  const auto remap_v = vertexRemap.view();
+
+  axom::Array<double> newCoords(3 * numNewVerts, 3 * numNewVerts, allocID);
+  double* newX = newCoords.data();
+  double* newY = newX + numNewVerts;
+  double* newZ = newY + numNewVerts;
+
+  for_all<ExecSpace>(
+    numVerts,
+    AXOM_LAMBDA(IndexType i) {
+      remap_v[i] = newIds_v[leaders_v[i]];
+      if(isLeader_v[i])
+      {
+        const IndexType newId = newIds_v[i];
+        newX[newId] = x[i];
+        newY[newId] = y[i];
+        newZ[newId] = z[i];
+      }
+    });
+
+  // STEP 5: reindex the triangles and remove the degenerate ones
+  axom::Array<IndexType> keep(numTris, numTris, allocID);
+  axom::Array<IndexType> triOffsets(numTris, numTris, allocID);
+  const auto keep_v = keep.view();
+  const auto triOffsets_v = triOffsets.view();
+
+  for_all<ExecSpace>(
+    numTris,
+    AXOM_LAMBDA(IndexType t) {
+      const IndexType a = remap_v[conn[3 * t]];
+      const IndexType b = remap_v[conn[3 * t + 1]];
+      const IndexType c = remap_v[conn[3 * t + 2]];
+      keep_v[t] = (a != b && b != c && a != c) ? 1 : 0;
+    });
+
+  const IndexType numNewTris =
+    exclusiveScanWithTotal<ExecSpace>(keep_v, triOffsets_v);
+
+  axom::Array<IndexType> newConn(3 * numNewTris, 3 * numNewTris, allocID);
+  const auto newConn_v = newConn.view();
+
+  for_all<ExecSpace>(
+    numTris,
+    AXOM_LAMBDA(IndexType t) {
+      if(keep_v[t])
+      {
+        const IndexType offset = 3 * triOffsets_v[t];
+        for(int k = 0; k < 3; ++k)
+        {
+          newConn_v[offset + k] = remap_v[conn[3 * t + k]];
+        }
+      }
+    });
+
+  // STEP 6: copy the welded vertices and triangles into a new mesh
+  UMesh* newMesh = new UMesh(3, mint::TRIANGLE, numNewVerts, numNewTris);
+  newMesh->resize(numNewVerts, numNewTris);
+
+  axom::copy(newMesh->getCoordinateArray(mint::X_COORDINATE),
+             newX,
+             numNewVerts * sizeof(double));
+  axom::copy(newMesh->getCoordinateArray(mint::Y_COORDINATE),
+             newY,
+             numNewVerts * sizeof(double));
+  axom::copy(newMesh->getCoordinateArray(mint::Z_COORDINATE),
+             newZ,
+             numNewVerts * sizeof(double));
+  axom::copy(newMesh->getCellNodesArray(),
+             newConn.data(),
+             3 * numNewTris * sizeof(IndexType));
+
+  return newMesh;
+}
+
 }  // namespace detail
 }  // namespace quest
 }  // namespace axom
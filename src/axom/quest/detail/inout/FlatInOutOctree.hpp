@@ -0,0 +1,520 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file FlatInOutOctree.hpp
+ *
+ * \brief Defines a flattened copy of an InOutOctree for point containment
+ * queries within an execution space
+ */
+
+#ifndef AXOM_QUEST_FLAT_INOUT_OCTREE__HPP_
+#define AXOM_QUEST_FLAT_INOUT_OCTREE__HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+#include "axom/fmt.hpp"
+
+#include "BlockData.hpp"
+#include "GrayBlockContainment.hpp"
+#include "MeshWrapper.hpp"
+
+#include <numeric>
+#include <vector>
+
+namespace axom
+{
+namespace quest
+{
+// Predeclare InOutOctree class
+template <int DIM>
+class InOutOctree;
+
+/**
+ * \class FlatInOutOctree
+ * \brief A flattened copy of a generated InOutOctree, whose point containment
+ * queries can be evaluated within an execution space
+ *
+ * The InOutOctree stores its blocks in a hash map per level, so each query
+ * hashes the grid cells of a binary search over the levels. This class
+ * exports the octree to contiguous arrays instead:
+ *  - the blocks are stored in level order, and the children of an internal
+ *    block are stored contiguously, in the order of their child index. A
+ *    query descends from the root by offsetting into the child blocks;
+ *  - the colors of the leaf blocks;
+ *  - the indices of the surface cells that intersect each gray leaf, in a
+ *    compressed array with an offset per block;
+ *  - the vertex indices of the cells and the positions of the vertices of
+ *    the octree's welded surface mesh.
+ *
+ * The flattened octree is a snapshot: it is unaffected by later changes to
+ * the InOutOctree and is usable after the InOutOctree is destroyed. Its
+ * queries return the same results as InOutOctree::within().
+ *
+ * \tparam DIM The dimension of the octree, 2 or 3
+ * \tparam ExecSpace A host execution space, e.g. SEQ_EXEC or OMP_EXEC
+ *
+ * \sa QueryObject
+ */
+template <int DIM, typename ExecSpace = axom::SEQ_EXEC>
+class FlatInOutOctree
+{
+  AXOM_STATIC_ASSERT_MSG(DIM == 2 || DIM == 3,
+                         "FlatInOutOctree only supports 2D and 3D octrees");
+  AXOM_STATIC_ASSERT_MSG(!axom::execution_space<ExecSpace>::onDevice(),
+                         "FlatInOutOctree requires a host execution space");
+
+public:
+  using InOutOctreeType = InOutOctree<DIM>;
+  using GeometricBoundingBox = primal::BoundingBox<double, DIM>;
+  using SpacePt = primal::Point<double, DIM>;
+  using SpaceVector = primal::Vector<double, DIM>;
+  using SpaceRay = primal::Ray<double, DIM>;
+  using SpaceCell = typename MeshWrapper<DIM>::SpaceCell;
+  using GridPt = primal::Point<axom::IndexType, DIM>;
+  using ColorType = axom::int8;
+
+  /// Marks the blocks without children in the child offsets array
+  static constexpr axom::IndexType NO_CHILD = -1;
+  static constexpr int NUM_CHILDREN = 1 << DIM;
+  static constexpr int NUM_CELL_VERTS = MeshWrapper<DIM>::NUM_CELL_VERTS;
+
+  struct QueryObject;
+
+public:
+  /**
+   * \brief Exports a generated InOutOctree to flat arrays
+   *
+   * \param [in] octree The InOutOctree to flatten
+   * \param [in] allocatorID The allocator for the arrays, defaults to the
+   * allocator of \a ExecSpace
+   *
+   * \note If the index of \a octree was neither generated nor loaded, a
+   * warning is logged and all queries return false
+   */
+  explicit FlatInOutOctree(
+    const InOutOctreeType& octree,
+    int allocatorID = axom::execution_space<ExecSpace>::allocatorID());
+
+  /// Returns a lightweight, copyable object to query the flattened octree
+  QueryObject getQueryObject() const;
+
+  /**
+   * \brief The batched point containment query
+   *
+   * \param [in] pts The points at which we are checking for containment
+   * \param [out] results Whether each point is within (or on) the surface
+   * \pre results.size() >= pts.size()
+   */
+  void within(axom::ArrayView<const SpacePt> pts,
+              axom::ArrayView<bool> results) const;
+
+  /// Returns the number of blocks (internal blocks and leaves)
+  axom::IndexType numBlocks() const { return m_firstChild.size(); }
+
+  /// Returns the number of levels of the octree that have blocks
+  int numLevels() const { return m_deltas.size(); }
+
+private:
+  DISABLE_COPY_AND_ASSIGNMENT(FlatInOutOctree);
+
+private:
+  GeometricBoundingBox m_boundingBox;
+  double m_boundingBoxScaleFactor;
+
+  axom::Array<SpaceVector> m_deltas;
+  axom::Array<SpaceVector> m_invDeltas;
+
+  axom::Array<axom::IndexType> m_firstChild;
+  axom::Array<ColorType> m_colors;
+  axom::Array<axom::IndexType> m_cellOffsets;
+  axom::Array<axom::IndexType> m_leafCells;
+
+  axom::Array<axom::IndexType> m_cellVertices;
+  axom::Array<SpacePt> m_vertices;
+};
+
+/**
+ * \brief A view of a FlatInOutOctree that evaluates point containment queries
+ *
+ * The query object holds array views into its FlatInOutOctree and is meant to
+ * be captured by copy in the kernels of \a ExecSpace, e.g. within
+ * axom::for_all(). It must not outlive its FlatInOutOctree.
+ */
+template <int DIM, typename ExecSpace>
+struct FlatInOutOctree<DIM, ExecSpace>::QueryObject
+{
+public:
+  QueryObject(const GeometricBoundingBox& bbox,
+              double boundingBoxScaleFactor,
+              axom::ArrayView<const SpaceVector> deltas,
+              axom::ArrayView<const SpaceVector> invDeltas,
+              axom::ArrayView<const axom::IndexType> firstChild,
+              axom::ArrayView<const ColorType> colors,
+              axom::ArrayView<const axom::IndexType> cellOffsets,
+              axom::ArrayView<const axom::IndexType> leafCells,
+              axom::ArrayView<const axom::IndexType> cellVertices,
+              axom::ArrayView<const SpacePt> vertices)
+    : m_boundingBox(bbox)
+    , m_boundingBoxScaleFactor(boundingBoxScaleFactor)
+    , m_deltas(deltas)
+    , m_invDeltas(invDeltas)
+    , m_firstChild(firstChild)
+    , m_colors(colors)
+    , m_cellOffsets(cellOffsets)
+    , m_leafCells(leafCells)
+    , m_cellVertices(cellVertices)
+    , m_vertices(vertices)
+  { }
+
+  /**
+   * \brief The point containment query
+   *
+   * \param pt The point at which we are checking for containment
+   * \return True if the point is within (or on) the surface, false otherwise
+   * \note Points outside the octree bounding box are considered outside
+   */
+  bool within(const SpacePt& pt) const
+  {
+    if(!m_boundingBox.contains(pt))
+    {
+      return false;
+    }
+
+    int lev = 0;
+    GridPt gridPt;
+    const axom::IndexType blk = findLeafBlock(pt, lev, gridPt);
+
+    switch(m_colors[blk])
+    {
+    case InOutBlockData::Black:
+      return true;
+    case InOutBlockData::Gray:
+      return withinGrayBlock(pt, blk, blockBoundingBox(gridPt, lev));
+    default:
+      return false;
+    }
+  }
+
+  /**
+   * \brief Finds the leaf block containing a point
+   *
+   * \param [in] pt The query point
+   * \param [out] lev The level of the leaf block
+   * \param [out] gridPt The grid point of the leaf block at level \a lev
+   * \return The index of the leaf block in the flattened octree
+   * \pre pt is within the bounding box of the octree
+   */
+  axom::IndexType findLeafBlock(const SpacePt& pt,
+                                int& lev,
+                                GridPt& gridPt) const
+  {
+    axom::IndexType blk = 0;
+    lev = 0;
+    gridPt = GridPt();
+
+    while(m_firstChild[blk] != NO_CHILD)
+    {
+      ++lev;
+      gridPt = findGridCellAtLevel(pt, lev);
+
+      // The lowest bit of each coordinate selects the child block
+      int childIndex = 0;
+      for(int d = 0; d < DIM; ++d)
+      {
+        childIndex |= static_cast<int>(gridPt[d] & 1) << d;
+      }
+      blk = m_firstChild[blk] + childIndex;
+    }
+
+    return blk;
+  }
+
+private:
+  /// Finds the grid cell of \a pt at level \a lev, as in SpatialOctree
+  GridPt findGridCellAtLevel(const SpacePt& pt, int lev) const
+  {
+    GridPt quantizedPt;
+
+    const SpacePt& bbMin = m_boundingBox.getMin();
+    const SpaceVector& invDelta = m_invDeltas[lev];
+    const axom::IndexType highestCell = (axom::IndexType(1) << lev) - 1;
+
+    for(int i = 0; i < DIM; ++i)
+    {
+      const axom::IndexType quantCell =
+        static_cast<axom::IndexType>((pt[i] - bbMin[i]) * invDelta[i]);
+      quantizedPt[i] = axom::utilities::min(quantCell, highestCell);
+    }
+
+    return quantizedPt;
+  }
+
+  /// Returns the bounding box of the block at \a gridPt on level \a lev
+  GeometricBoundingBox blockBoundingBox(const GridPt& gridPt, int lev) const
+  {
+    const SpaceVector& deltaVec = m_deltas[lev];
+
+    SpacePt lower(m_boundingBox.getMin());
+    SpacePt upper(m_boundingBox.getMin());
+    for(int i = 0; i < DIM; ++i)
+    {
+      lower[i] += gridPt[i] * deltaVec[i];
+      upper[i] += (gridPt[i] + 1) * deltaVec[i];
+    }
+
+    return GeometricBoundingBox(lower, upper);
+  }
+
+  /// Returns the positions of the vertices of cell \a idx
+  SpaceCell cellPositions(axom::IndexType idx) const
+  {
+    SpaceCell cell;
+    for(int i = 0; i < NUM_CELL_VERTS; ++i)
+    {
+      cell[i] = m_vertices[cellVertex(idx, i)];
+    }
+    return cell;
+  }
+
+  /// Returns the index of vertex \a i of cell \a idx
+  axom::IndexType cellVertex(axom::IndexType idx, int i) const
+  {
+    return m_cellVertices[NUM_CELL_VERTS * idx + i];
+  }
+
+  /**
+   * \brief Determines whether a point is within the gray leaf \a blk
+   *
+   * \sa detail::withinGrayBlock(), which is shared with the InOutOctree
+   */
+  bool withinGrayBlock(const SpacePt& queryPt,
+                       axom::IndexType blk,
+                       const GeometricBoundingBox& blockBB) const
+  {
+    const axom::IndexType begin = m_cellOffsets[blk];
+    const axom::ArrayView<const axom::IndexType> cells(
+      m_leafCells.data() + begin,
+      m_cellOffsets[blk + 1] - begin);
+
+    return detail::withinGrayBlock(
+      queryPt,
+      blockBB,
+      m_boundingBoxScaleFactor,
+      cells,
+      [this](axom::IndexType idx) { return cellPositions(idx); },
+      [this](axom::IndexType idx, int i) { return cellVertex(idx, i); });
+  }
+
+private:
+  GeometricBoundingBox m_boundingBox;
+  double m_boundingBoxScaleFactor;
+
+  axom::ArrayView<const SpaceVector> m_deltas;
+  axom::ArrayView<const SpaceVector> m_invDeltas;
+
+  axom::ArrayView<const axom::IndexType> m_firstChild;
+  axom::ArrayView<const ColorType> m_colors;
+  axom::ArrayView<const axom::IndexType> m_cellOffsets;
+  axom::ArrayView<const axom::IndexType> m_leafCells;
+
+  axom::ArrayView<const axom::IndexType> m_cellVertices;
+  axom::ArrayView<const SpacePt> m_vertices;
+};
+
+template <int DIM, typename ExecSpace>
+constexpr axom::IndexType FlatInOutOctree<DIM, ExecSpace>::NO_CHILD;
+
+template <int DIM, typename ExecSpace>
+constexpr int FlatInOutOctree<DIM, ExecSpace>::NUM_CHILDREN;
+
+template <int DIM, typename ExecSpace>
+constexpr int FlatInOutOctree<DIM, ExecSpace>::NUM_CELL_VERTS;
+
+//------------------------------------------------------------------------------
+template <int DIM, typename ExecSpace>
+FlatInOutOctree<DIM, ExecSpace>::FlatInOutOctree(const InOutOctreeType& octree,
+                                                 int allocatorID)
+  : m_boundingBox()
+  , m_boundingBoxScaleFactor(octree.m_boundingBoxScaleFactor)
+  , m_deltas(0, 0, allocatorID)
+  , m_invDeltas(0, 0, allocatorID)
+  , m_firstChild(0, 0, allocatorID)
+  , m_colors(0, 0, allocatorID)
+  , m_cellOffsets(0, 0, allocatorID)
+  , m_leafCells(0, 0, allocatorID)
+  , m_cellVertices(0, 0, allocatorID)
+  , m_vertices(0, 0, allocatorID)
+{
+  using BlockIndex = typename InOutOctreeType::BlockIndex;
+  using IndexType = axom::IndexType;
+
+  if(octree.m_generationState != InOutOctreeType::INOUTOCTREE_LEAVES_COLORED)
+  {
+    SLIC_WARNING(
+      "Can only flatten an InOutOctree after generating or loading its index");
+    return;
+  }
+
+  axom::utilities::Timer timer(true);
+
+  // STEP 1: Order the blocks by level, with the children of each internal
+  // block stored contiguously
+  std::vector<BlockIndex> blocks {octree.root()};
+  std::vector<IndexType> firstChild;
+  int maxLevel = 0;
+  for(std::size_t i = 0; i < blocks.size(); ++i)
+  {
+    const BlockIndex blk = blocks[i];
+    if(octree.isLeaf(blk))
+    {
+      firstChild.push_back(NO_CHILD);
+      continue;
+    }
+
+    firstChild.push_back(static_cast<IndexType>(blocks.size()));
+    for(int j = 0; j < NUM_CHILDREN; ++j)
+    {
+      blocks.push_back(blk.child(j));
+    }
+    maxLevel = axom::utilities::max(maxLevel, blk.childLevel());
+  }
+
+  const IndexType nBlocks = static_cast<IndexType>(blocks.size());
+  m_firstChild = axom::Array<IndexType>(nBlocks, nBlocks, allocatorID);
+  std::copy(firstChild.begin(), firstChild.end(), m_firstChild.begin());
+
+  // STEP 2: Copy the leaf colors and count the cells of the gray leaves
+  m_colors = axom::Array<ColorType>(nBlocks, nBlocks, allocatorID);
+  m_cellOffsets = axom::Array<IndexType>(nBlocks + 1, nBlocks + 1, allocatorID);
+
+  const BlockIndex* blocks_p = blocks.data();
+  const InOutOctreeType* octree_p = &octree;
+  const auto colors_v = m_colors.view();
+  const auto offsets_v = m_cellOffsets.view();
+
+  axom::for_all<ExecSpace>(nBlocks, [=](IndexType i) {
+    const BlockIndex& blk = blocks_p[i];
+    ColorType color = InOutBlockData::Undetermined;
+    IndexType numCells = 0;
+    if(octree_p->isLeaf(blk))
+    {
+      const InOutBlockData& data = (*octree_p)[blk];
+      color = static_cast<ColorType>(data.color());
+      if(color == InOutBlockData::Gray)
+      {
+        numCells = octree_p->leafCells(blk, data).size();
+      }
+    }
+    colors_v[i] = color;
+    offsets_v[i + 1] = numCells;
+  });
+
+  m_cellOffsets[0] = 0;
+  std::partial_sum(m_cellOffsets.begin(),
+                   m_cellOffsets.end(),
+                   m_cellOffsets.begin());
+
+  // STEP 3: Copy the cells of the gray leaves
+  const IndexType nLeafCells = m_cellOffsets[nBlocks];
+  m_leafCells = axom::Array<IndexType>(nLeafCells, nLeafCells, allocatorID);
+  const auto leafCells_v = m_leafCells.view();
+
+  axom::for_all<ExecSpace>(nBlocks, [=](IndexType i) {
+    if(colors_v[i] == InOutBlockData::Gray)
+    {
+      const BlockIndex& blk = blocks_p[i];
+      const auto cells = octree_p->leafCells(blk, (*octree_p)[blk]);
+      for(IndexType j = 0; j < cells.size(); ++j)
+      {
+        leafCells_v[offsets_v[i] + j] = cells[j];
+      }
+    }
+  });
+
+  // STEP 4: Copy the welded surface mesh
+  const MeshWrapper<DIM>* mesh_p = &octree.m_meshWrapper;
+  const IndexType nVerts = mesh_p->numMeshVertices();
+  const IndexType nCells = mesh_p->numMeshCells();
+
+  m_vertices = axom::Array<SpacePt>(nVerts, nVerts, allocatorID);
+  m_cellVertices = axom::Array<IndexType>(NUM_CELL_VERTS * nCells,
+                                          NUM_CELL_VERTS * nCells,
+                                          allocatorID);
+  const auto vertices_v = m_vertices.view();
+  const auto cellVertices_v = m_cellVertices.view();
+
+  axom::for_all<ExecSpace>(nVerts, [=](IndexType i) {
+    vertices_v[i] = mesh_p->vertexPosition(i);
+  });
+  axom::for_all<ExecSpace>(nCells, [=](IndexType i) {
+    const auto verts = mesh_p->cellVertexIndices(i);
+    for(int j = 0; j < NUM_CELL_VERTS; ++j)
+    {
+      cellVertices_v[NUM_CELL_VERTS * i + j] = verts[j];
+    }
+  });
+
+  // STEP 5: Cache the block widths at each level
+  m_deltas = axom::Array<SpaceVector>(maxLevel + 1, maxLevel + 1, allocatorID);
+  m_invDeltas =
+    axom::Array<SpaceVector>(maxLevel + 1, maxLevel + 1, allocatorID);
+  for(int lev = 0; lev <= maxLevel; ++lev)
+  {
+    m_deltas[lev] = octree.spacingAtLevel(lev);
+    for(int d = 0; d < DIM; ++d)
+    {
+      m_invDeltas[lev][d] = 1. / m_deltas[lev][d];
+    }
+  }
+
+  m_boundingBox = octree.boundingBox();
+
+  timer.stop();
+  SLIC_INFO(axom::fmt::format(
+    "Flattened InOutOctree into {} blocks on {} levels with {} gray leaf "
+    "cell references in {} seconds",
+    nBlocks,
+    maxLevel + 1,
+    nLeafCells,
+    timer.elapsed()));
+}
+
+//------------------------------------------------------------------------------
+template <int DIM, typename ExecSpace>
+typename FlatInOutOctree<DIM, ExecSpace>::QueryObject
+FlatInOutOctree<DIM, ExecSpace>::getQueryObject() const
+{
+  return QueryObject {m_boundingBox,
+                      m_boundingBoxScaleFactor,
+                      m_deltas.view(),
+                      m_invDeltas.view(),
+                      m_firstChild.view(),
+                      m_colors.view(),
+                      m_cellOffsets.view(),
+                      m_leafCells.view(),
+                      m_cellVertices.view(),
+                      m_vertices.view()};
+}
+
+//------------------------------------------------------------------------------
+template <int DIM, typename ExecSpace>
+void FlatInOutOctree<DIM, ExecSpace>::within(
+  axom::ArrayView<const SpacePt> pts,
+  axom::ArrayView<bool> results) const
+{
+  SLIC_ASSERT(results.size() >= pts.size());
+
+  const QueryObject query = getQueryObject();
+  axom::for_all<ExecSpace>(pts.size(), [=](axom::IndexType i) {
+    results[i] = query.within(pts[i]);
+  });
+}
+
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // AXOM_QUEST_FLAT_INOUT_OCTREE__HPP_
@@ -0,0 +1,276 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file GrayBlockContainment.hpp
+ *
+ * \brief Defines the point containment test within the gray leaf blocks of
+ * an InOutOctree, shared with the FlatInOutOctree
+ */
+
+#ifndef AXOM_QUEST_INOUT_OCTREE_GRAY_BLOCK_CONTAINMENT__HPP_
+#define AXOM_QUEST_INOUT_OCTREE_GRAY_BLOCK_CONTAINMENT__HPP_
+
+#include "axom/core.hpp"
+#include "axom/primal.hpp"
+
+#include "MeshWrapper.hpp"
+
+#include <limits>
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+/**
+ * \brief Returns the unit normal of the surface on segment \a cidx at
+ * parameter \a segmentParameter
+ *
+ * If we are at an endpoint of the segment (i.e. if the \a segmentParameter is
+ * close to 0 or 1), we compute the average normal of the segments in \a cells
+ * that are incident in it
+ *
+ * \param cidx The index of the segment
+ * \param segmentParameter The parameter of the point along the segment
+ * \param cells An indexable set of the indices of nearby segments
+ * \param cellPositions Returns the Segment of a cell index
+ * \param cellVertex Returns the index of vertex \a i of a cell index
+ */
+template <typename CellSet, typename CellPositions, typename CellVertex>
+primal::Vector<double, 2> surfaceNormal(axom::IndexType cidx,
+                                        double segmentParameter,
+                                        const CellSet& cells,
+                                        const CellPositions& cellPositions,
+                                        const CellVertex& cellVertex)
+{
+  primal::Vector<double, 2> vec = cellPositions(cidx).normal();
+
+  const bool atFirst = axom::utilities::isNearlyEqual(segmentParameter, 0.);
+  if(atFirst || axom::utilities::isNearlyEqual(segmentParameter, 1.))
+  {
+    const axom::IndexType vidx = cellVertex(cidx, atFirst ? 0 : 1);
+
+    vec = vec.unitVector();
+    const axom::IndexType numCells = cells.size();
+    for(axom::IndexType k = 0; k < numCells; ++k)
+    {
+      const axom::IndexType idx = cells[k];
+      const bool incident =
+        (cellVertex(idx, 0) == vidx) || (cellVertex(idx, 1) == vidx);
+      if(idx != cidx && incident)
+      {
+        vec += cellPositions(idx).normal().unitVector();
+      }
+    }
+  }
+
+  return vec.unitVector();
+}
+
+/**
+ * \brief Determines whether a 3D point is within the surface, using the
+ * triangles of the gray leaf block that contains it
+ *
+ * Finds a ray from \a queryPt to a point of a triangle within the block.
+ * Then finds the first triangle along this ray. The orientation of the ray
+ * against this triangle's normal indicates queryPt's containment.
+ * It is inside when the dot product is positive.
+ *
+ * \param queryPt The point we are querying
+ * \param blockBB The bounding box of the gray leaf block
+ * \param bbScaleFactor The scale factor of the octree's bounding box
+ * \param cells An indexable set of the indices of the block's triangles
+ * \param cellPositions Returns the Triangle of a cell index
+ * \return True, if the point is inside the local surface associated with the
+ * block, false otherwise
+ */
+template <typename CellSet, typename CellPositions, typename CellVertex>
+bool withinGrayBlock(const primal::Point<double, 3>& queryPt,
+                     const primal::BoundingBox<double, 3>& blockBB,
+                     double bbScaleFactor,
+                     const CellSet& cells,
+                     const CellPositions& cellPositions,
+                     const CellVertex& AXOM_UNUSED_PARAM(cellVertex))
+{
+  using SpaceVector = primal::Vector<double, 3>;
+  using SpaceRay = primal::Ray<double, 3>;
+
+  const axom::IndexType numTris = cells.size();
+  for(axom::IndexType i = 0; i < numTris; ++i)
+  {
+    const axom::IndexType idx = cells[i];
+    const auto tri = cellPositions(idx);
+
+    // Find a point from this triangle within the bounding box of the block
+    primal::Polygon<double, 3> poly = primal::clip(tri, blockBB);
+    if(poly.numVertices() == 0)
+    {
+      // Account for cases where the triangle only grazes the bounding box.
+      // Here, intersect(tri,blockBB) is true, but the clipping algorithm
+      // produces an empty polygon.  To resolve this, clip against a
+      // slightly expanded bounding box
+      primal::BoundingBox<double, 3> expandedBB = blockBB;
+      expandedBB.scale(10 * bbScaleFactor);
+
+      poly = primal::clip(tri, expandedBB);
+
+      // If that still doesn't work, move on to the next triangle
+      if(poly.numVertices() == 0)
+      {
+        continue;
+      }
+    }
+
+    const primal::Point<double, 3> triPt = poly.vertexMean();
+
+    // Use a ray from the query point to the triangle point to find an
+    // intersection. Note: We have to check all triangles to ensure that
+    // there is not a closer triangle than tri along this direction.
+    axom::IndexType tIdx = MeshWrapper<3>::NO_CELL;
+    double minRayParam = std::numeric_limits<double>::infinity();
+    const SpaceRay ray(queryPt, SpaceVector(queryPt, triPt));
+
+    double rayParam = 0;
+    if(primal::intersect(tri, ray, rayParam))
+    {
+      minRayParam = rayParam;
+      tIdx = idx;
+    }
+
+    for(axom::IndexType j = 0; j < numTris; ++j)
+    {
+      const axom::IndexType localIdx = cells[j];
+      if(localIdx == idx) continue;
+
+      if(primal::intersect(cellPositions(localIdx), ray, rayParam))
+      {
+        if(rayParam < minRayParam)
+        {
+          minRayParam = rayParam;
+          tIdx = localIdx;
+        }
+      }
+    }
+
+    if(tIdx == MeshWrapper<3>::NO_CELL)
+    {
+      continue;
+    }
+
+    // Inside when the dot product of the normal with this triangle is positive
+    const SpaceVector normal =
+      (tIdx == idx) ? tri.normal() : cellPositions(tIdx).normal();
+
+    return normal.dot(ray.direction()) > 0.;
+  }
+
+  return false;  // query points on boundary might get here -- revisit this.
+}
+
+/**
+ * \brief Determines whether a 2D point is within the surface, using the
+ * segments of the gray leaf block that contains it
+ *
+ * Finds a ray from \a queryPt to a point of a segment within the block.
+ * Then finds the first segment along this ray. The orientation of the ray
+ * against the surface normal at the intersection indicates queryPt's
+ * containment. It is inside when the dot product is positive.
+ *
+ * \param queryPt The point we are querying
+ * \param blockBB The bounding box of the gray leaf block
+ * \param bbScaleFactor The scale factor of the octree's bounding box
+ * \param cells An indexable set of the indices of the block's segments
+ * \param cellPositions Returns the Segment of a cell index
+ * \param cellVertex Returns the index of vertex \a i of a cell index
+ * \return True, if the point is inside the local surface associated with the
+ * block, false otherwise
+ */
+template <typename CellSet, typename CellPositions, typename CellVertex>
+bool withinGrayBlock(const primal::Point<double, 2>& queryPt,
+                     const primal::BoundingBox<double, 2>& blockBB,
+                     double bbScaleFactor,
+                     const CellSet& cells,
+                     const CellPositions& cellPositions,
+                     const CellVertex& cellVertex)
+{
+  using SpaceVector = primal::Vector<double, 2>;
+  using SpaceRay = primal::Ray<double, 2>;
+
+  primal::BoundingBox<double, 2> expandedBB = blockBB;
+  expandedBB.scale(bbScaleFactor);
+
+  const axom::IndexType numSegments = cells.size();
+  for(axom::IndexType i = 0; i < numSegments; ++i)
+  {
+    const axom::IndexType idx = cells[i];
+    const auto seg = cellPositions(idx);
+
+    // Find a point from this segment within the expanded bounding box.
+    // We'll use the midpoint of the segment after clipping it against the box
+    double pMin, pMax;
+    if(!primal::intersect(seg, expandedBB, pMin, pMax))
+    {
+      continue;
+    }
+    const primal::Point<double, 2> segmentPt = seg.at(0.5 * (pMin + pMax));
+
+    // Using a ray from query pt to point on this segment,
+    // find the closest intersection with the segments of the block
+    axom::IndexType tIdx = MeshWrapper<2>::NO_CELL;
+    double minRayParam = std::numeric_limits<double>::infinity();
+    double minSegParam = std::numeric_limits<double>::infinity();
+    const SpaceRay ray(queryPt, SpaceVector(queryPt, segmentPt));
+
+    double rayParam = 0;
+    double segParam = 0;
+    if(primal::intersect(ray, seg, rayParam, segParam))
+    {
+      minRayParam = rayParam;
+      minSegParam = segParam;
+      tIdx = idx;
+    }
+
+    for(axom::IndexType j = 0; j < numSegments; ++j)
+    {
+      const axom::IndexType localIdx = cells[j];
+      if(localIdx == idx) continue;
+
+      if(primal::intersect(ray, cellPositions(localIdx), rayParam, segParam))
+      {
+        if(rayParam < minRayParam)
+        {
+          minRayParam = rayParam;
+          minSegParam = segParam;
+          tIdx = localIdx;
+        }
+      }
+    }
+
+    if(tIdx == MeshWrapper<2>::NO_CELL)
+    {
+      continue;
+    }
+
+    // Get the surface normal at the intersection point
+    // If the latter is a vertex, the normal is the average of its incident
+    // segments
+    const SpaceVector normal =
+      surfaceNormal(tIdx, minSegParam, cells, cellPositions, cellVertex);
+
+    // Query point is inside when the dot product of the normal with ray is
+    // positive
+    return normal.dot(ray.direction()) > 0.;
+  }
+
+  return false;  // query points on boundary might get here -- revisit this.
+}
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_INOUT_OCTREE_GRAY_BLOCK_CONTAINMENT__HPP_
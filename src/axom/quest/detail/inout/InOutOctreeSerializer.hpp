@@ -0,0 +1,617 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file InOutOctreeSerializer.hpp
+ *
+ * \brief Defines helper class to save and restore an InOutOctree instance
+ */
+
+#ifndef AXOM_QUEST_INOUT_OCTREE_SERIALIZER__HPP_
+#define AXOM_QUEST_INOUT_OCTREE_SERIALIZER__HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/slam.hpp"
+#include "axom/primal.hpp"
+
+#include "BlockData.hpp"
+#include "MeshWrapper.hpp"
+
+#include "axom/fmt.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace axom
+{
+namespace quest
+{
+// Predeclare InOutOctree class
+template <int DIM>
+class InOutOctree;
+
+namespace detail
+{
+/**
+ * \brief Writes the generated index of an InOutOctree to a binary file and
+ * restores it from that file.
+ *
+ * The file holds a header, the welded surface mesh, the octree blocks of each
+ * level with their data, the map from mesh vertices to octree blocks and the
+ * relations from the gray leaves to the mesh vertices and elements. The
+ * header holds a hash of the input surface mesh, the bounding box and the
+ * vertex welding threshold of the octree, which must match those of the
+ * InOutOctree that reads the file.
+ *
+ * \note The file uses the native byte order and index size.
+ */
+template <int DIM>
+class InOutOctreeSerializer
+{
+public:
+  using InOutOctreeType = InOutOctree<DIM>;
+
+  using OctreeBaseType = typename InOutOctreeType::OctreeBaseType;
+  using BlockIndex = typename OctreeBaseType::BlockIndex;
+  using GridPt = typename OctreeBaseType::GridPt;
+
+  using SpacePt = typename InOutOctreeType::SpacePt;
+  using VertexIndex = typename InOutOctreeType::VertexIndex;
+  using GeometricBoundingBox = typename InOutOctreeType::GeometricBoundingBox;
+  using VertexBlockMap = typename InOutOctreeType::VertexBlockMap;
+  using IndexBuffer = typename InOutOctreeType::IndexBuffer;
+
+  using IndexArray = std::vector<axom::IndexType>;
+  using CoordArray = std::vector<double>;
+
+private:
+  /// Identifies an InOutOctree file ('AXIOOCT' followed by a zero byte)
+  static constexpr axom::uint64 FILE_MAGIC = 0x0054434F4F495841ULL;
+
+  /// Version of the file format
+  static constexpr axom::int32 FILE_VERSION = 1;
+
+  /// The header of a saved InOutOctree
+  struct Header
+  {
+    axom::uint64 magic {0};
+    axom::int32 version {0};
+    axom::int32 dimension {0};
+    axom::int32 indexSize {0};
+    axom::int32 numLevels {0};
+    axom::uint64 meshHash {0};
+    double bbMin[DIM];
+    double bbMax[DIM];
+    double vertexWeldThresholdSquared {0.};
+    double boundingBoxScaleFactor {0.};
+  };
+
+  /// The contents of a saved InOutOctree, other than its header
+  struct IndexData
+  {
+    CoordArray vertexPositions;
+    IndexArray cellVertices;
+    IndexArray vertexBlocks;
+    std::vector<IndexArray> levelBlocks;
+    std::vector<axom::int32> levelHasGrayLeaves;
+    std::vector<IndexArray> grayLeafVertices;
+    std::vector<IndexArray> grayLeafOffsets;
+    std::vector<IndexArray> grayLeafElements;
+  };
+
+public:
+  /**
+   * \brief Writes the index of \a octree to the file \a fileName
+   *
+   * \return True if the file was written, false otherwise
+   * \pre The index of \a octree was generated or loaded
+   */
+  static bool write(const InOutOctreeType& octree, const std::string& fileName)
+  {
+    std::ofstream ofs(fileName, std::ios::binary);
+    if(!ofs)
+    {
+      SLIC_WARNING(
+        fmt::format("Could not open file '{}' to save InOutOctree", fileName));
+      return false;
+    }
+
+    const int numLevels = octree.m_levels.size();
+
+    Header header = makeHeader(octree);
+    header.meshHash = octree.m_meshWrapper.inputMeshHash();
+    writeValue(ofs, header);
+
+    // Welded surface mesh
+    const auto& meshWrapper = octree.m_meshWrapper;
+    const int numVerts = meshWrapper.numMeshVertices();
+    const int numCells = meshWrapper.numMeshCells();
+
+    IndexData data;
+    data.vertexPositions.reserve(DIM * numVerts);
+    data.vertexBlocks.reserve((DIM + 1) * numVerts);
+    for(int i = 0; i < numVerts; ++i)
+    {
+      const SpacePt& pos = meshWrapper.vertexPosition(i);
+      data.vertexPositions.insert(data.vertexPositions.end(),
+                                  pos.data(),
+                                  pos.data() + DIM);
+
+      appendBlock(data.vertexBlocks,
+                  octree.m_vertexToBlockMap[i].pt(),
+                  octree.m_vertexToBlockMap[i].level());
+    }
+
+    data.cellVertices.reserve(DIM * numCells);
+    for(int i = 0; i < numCells; ++i)
+    {
+      const auto cellVerts = meshWrapper.cellVertexIndices(i);
+      for(int j = 0; j < cellVerts.size(); ++j)
+      {
+        data.cellVertices.push_back(cellVerts[j]);
+      }
+    }
+
+    // Octree blocks, as (grid point, data) for each level
+    data.levelBlocks.resize(numLevels);
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      const auto& levelLeafMap = octree.getOctreeLevel(lev);
+      auto itEnd = levelLeafMap.end();
+      for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
+      {
+        appendBlock(data.levelBlocks[lev], it.pt(), it->dataIndex());
+      }
+    }
+
+    // Relations from gray leaves to the mesh vertices and elements
+    data.levelHasGrayLeaves.resize(numLevels, 0);
+    data.grayLeafVertices.resize(numLevels);
+    data.grayLeafOffsets.resize(numLevels);
+    data.grayLeafElements.resize(numLevels);
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      if(octree.getOctreeLevel(lev).empty()) continue;
+
+      data.levelHasGrayLeaves[lev] = 1;
+
+      const auto& gvRel = octree.m_grayLeafToVertexRelationLevelMap[lev];
+      const auto& geRel = octree.m_grayLeafToElementRelationLevelMap[lev];
+      const int numGrayLeaves = octree.m_grayLeafsMap[lev].size();
+
+      data.grayLeafOffsets[lev].push_back(0);
+      for(int i = 0; i < numGrayLeaves; ++i)
+      {
+        data.grayLeafVertices[lev].push_back(gvRel[i][0]);
+
+        const auto cells = geRel[i];
+        for(int j = 0; j < cells.size(); ++j)
+        {
+          data.grayLeafElements[lev].push_back(cells[j]);
+        }
+        data.grayLeafOffsets[lev].push_back(
+          static_cast<axom::IndexType>(data.grayLeafElements[lev].size()));
+      }
+    }
+
+    writeArray(ofs, data.vertexPositions);
+    writeArray(ofs, data.cellVertices);
+    writeArray(ofs, data.vertexBlocks);
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      writeArray(ofs, data.levelBlocks[lev]);
+    }
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      writeValue(ofs, data.levelHasGrayLeaves[lev]);
+      if(data.levelHasGrayLeaves[lev])
+      {
+        writeArray(ofs, data.grayLeafVertices[lev]);
+        writeArray(ofs, data.grayLeafOffsets[lev]);
+        writeArray(ofs, data.grayLeafElements[lev]);
+      }
+    }
+
+    if(!ofs)
+    {
+      SLIC_WARNING(
+        fmt::format("Error while saving InOutOctree to file '{}'", fileName));
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Restores the index of \a octree from the file \a fileName
+   *
+   * \return True if the index was restored, false otherwise
+   * \note \a octree is only modified when the file was read successfully
+   * and its header matches \a octree and its input surface mesh
+   * \pre The index of \a octree was not yet generated
+   */
+  static bool read(InOutOctreeType& octree, const std::string& fileName)
+  {
+    std::ifstream ifs(fileName, std::ios::binary);
+    if(!ifs)
+    {
+      SLIC_WARNING(
+        fmt::format("Could not open file '{}' to load InOutOctree", fileName));
+      return false;
+    }
+
+    Header header;
+    if(!readValue(ifs, header) || !checkHeader(octree, header, fileName))
+    {
+      return false;
+    }
+
+    const int numLevels = header.numLevels;
+
+    IndexData data;
+    bool ok = readArray(ifs, data.vertexPositions) &&
+      readArray(ifs, data.cellVertices) && readArray(ifs, data.vertexBlocks);
+
+    data.levelBlocks.resize(numLevels);
+    for(int lev = 0; ok && lev < numLevels; ++lev)
+    {
+      ok = readArray(ifs, data.levelBlocks[lev]);
+    }
+
+    data.levelHasGrayLeaves.resize(numLevels, 0);
+    data.grayLeafVertices.resize(numLevels);
+    data.grayLeafOffsets.resize(numLevels);
+    data.grayLeafElements.resize(numLevels);
+    for(int lev = 0; ok && lev < numLevels; ++lev)
+    {
+      ok = readValue(ifs, data.levelHasGrayLeaves[lev]);
+      if(ok && data.levelHasGrayLeaves[lev])
+      {
+        ok = readArray(ifs, data.grayLeafVertices[lev]) &&
+          readArray(ifs, data.grayLeafOffsets[lev]) &&
+          readArray(ifs, data.grayLeafElements[lev]);
+      }
+    }
+
+    const std::size_t numVerts = data.vertexPositions.size() / DIM;
+    ok = ok && data.vertexPositions.size() % DIM == 0 &&
+      data.cellVertices.size() % DIM == 0 &&
+      data.vertexBlocks.size() == (DIM + 1) * numVerts;
+    for(int lev = 0; ok && lev < numLevels; ++lev)
+    {
+      ok = data.levelBlocks[lev].size() % (DIM + 1) == 0;
+    }
+
+    if(!ok)
+    {
+      SLIC_WARNING(fmt::format(
+        "Could not load InOutOctree: file '{}' is truncated or corrupt",
+        fileName));
+      return false;
+    }
+
+    return restore(octree, header, data, fileName);
+  }
+
+private:
+  /// Returns a header with the properties of \a octree, other than its hash
+  static Header makeHeader(const InOutOctreeType& octree)
+  {
+    Header header;
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.dimension = DIM;
+    header.indexSize = static_cast<axom::int32>(sizeof(axom::IndexType));
+    header.numLevels = octree.m_levels.size();
+
+    const GeometricBoundingBox& bb = octree.boundingBox();
+    for(int d = 0; d < DIM; ++d)
+    {
+      header.bbMin[d] = bb.getMin()[d];
+      header.bbMax[d] = bb.getMax()[d];
+    }
+
+    header.vertexWeldThresholdSquared = octree.m_vertexWeldThresholdSquared;
+    header.boundingBoxScaleFactor = octree.m_boundingBoxScaleFactor;
+
+    return header;
+  }
+
+  /// Checks that the file's \a header matches \a octree and its input mesh
+  static bool checkHeader(const InOutOctreeType& octree,
+                          const Header& header,
+                          const std::string& fileName)
+  {
+    const Header expected = makeHeader(octree);
+
+    if(header.magic != expected.magic || header.version != expected.version)
+    {
+      SLIC_WARNING(fmt::format(
+        "Could not load InOutOctree: '{}' is not a saved InOutOctree file "
+        "with version {}",
+        fileName,
+        expected.version));
+      return false;
+    }
+
+    bool matches = header.dimension == expected.dimension &&
+      header.indexSize == expected.indexSize &&
+      header.numLevels == expected.numLevels &&
+      header.vertexWeldThresholdSquared ==
+        expected.vertexWeldThresholdSquared &&
+      header.boundingBoxScaleFactor == expected.boundingBoxScaleFactor;
+    for(int d = 0; d < DIM; ++d)
+    {
+      matches = matches && header.bbMin[d] == expected.bbMin[d] &&
+        header.bbMax[d] == expected.bbMax[d];
+    }
+
+    if(!matches)
+    {
+      SLIC_WARNING(fmt::format(
+        "Could not load InOutOctree: the parameters saved in '{}' do not match "
+        "the dimension, bounding box or vertex welding threshold of the octree",
+        fileName));
+      return false;
+    }
+
+    if(header.meshHash != octree.m_meshWrapper.inputMeshHash())
+    {
+      SLIC_WARNING(fmt::format(
+        "Could not load InOutOctree: the surface mesh saved in '{}' does not "
+        "match the octree's surface mesh",
+        fileName));
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Checks that the indices in the saved \a data are consistent
+   *
+   * The cells must refer to the saved vertices, the grid points of the blocks
+   * must lie within their levels and the offsets of the gray leaves must be
+   * nondecreasing and within their elements
+   */
+  static bool isConsistent(const Header& header, const IndexData& data)
+  {
+    const int numLevels = header.numLevels;
+    const axom::IndexType numVerts = data.vertexPositions.size() / DIM;
+    const axom::IndexType numCells = data.cellVertices.size() / DIM;
+
+    for(const axom::IndexType v : data.cellVertices)
+    {
+      if(v < 0 || v >= numVerts) return false;
+    }
+
+    for(std::size_t b = 0; b < data.vertexBlocks.size(); b += DIM + 1)
+    {
+      const axom::IndexType lev = data.vertexBlocks[b + DIM];
+      if(lev < 0 || lev >= numLevels ||
+         !isInLevel(&data.vertexBlocks[b], static_cast<int>(lev)))
+      {
+        return false;
+      }
+    }
+
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      const IndexArray& blocks = data.levelBlocks[lev];
+      for(std::size_t b = 0; b < blocks.size(); b += DIM + 1)
+      {
+        if(!isInLevel(&blocks[b], lev)) return false;
+      }
+
+      if(!data.levelHasGrayLeaves[lev]) continue;
+
+      const IndexArray& offsets = data.grayLeafOffsets[lev];
+      const IndexArray& elements = data.grayLeafElements[lev];
+      if(offsets.size() != data.grayLeafVertices[lev].size() + 1 ||
+         offsets.front() != 0 ||
+         offsets.back() != static_cast<axom::IndexType>(elements.size()))
+      {
+        return false;
+      }
+      for(std::size_t i = 1; i < offsets.size(); ++i)
+      {
+        if(offsets[i] < offsets[i - 1]) return false;
+      }
+      for(const axom::IndexType c : elements)
+      {
+        if(c < 0 || c >= numCells) return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Restores the saved \a data into \a octree
+   *
+   * \return True if the data was restored, false if it is not consistent,
+   * in which case \a octree is not modified
+   */
+  static bool restore(InOutOctreeType& octree,
+                      const Header& header,
+                      const IndexData& data,
+                      const std::string& fileName)
+  {
+    if(!isConsistent(header, data))
+    {
+      SLIC_WARNING(fmt::format(
+        "Could not load InOutOctree: file '{}' holds inconsistent indices",
+        fileName));
+      return false;
+    }
+
+    const int numLevels = header.numLevels;
+
+    // Replace the input mesh with the welded mesh
+    const int numVerts = static_cast<int>(data.vertexPositions.size() / DIM);
+    std::vector<SpacePt> positions(numVerts);
+    for(int i = 0; i < numVerts; ++i)
+    {
+      positions[i] = SpacePt(&data.vertexPositions[DIM * i]);
+    }
+    std::vector<VertexIndex> cellVertices(data.cellVertices.begin(),
+                                          data.cellVertices.end());
+    octree.m_meshWrapper.setReindexedMesh(positions,
+                                          cellVertices,
+                                          header.meshHash);
+
+    // Recreate the octree blocks: refining the internal blocks level by level
+    // adds all blocks of the next level to the tree, after which we can set
+    // the data of each block
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      const IndexArray& blocks = data.levelBlocks[lev];
+      for(std::size_t b = 0; b < blocks.size(); b += DIM + 1)
+      {
+        const InOutBlockData blockData(static_cast<int>(blocks[b + DIM]));
+        if(!blockData.isLeaf())
+        {
+          octree.refineLeaf(BlockIndex(toGridPt(&blocks[b]), lev));
+        }
+      }
+    }
+
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      const IndexArray& blocks = data.levelBlocks[lev];
+      for(std::size_t b = 0; b < blocks.size(); b += DIM + 1)
+      {
+        octree[BlockIndex(toGridPt(&blocks[b]), lev)] =
+          InOutBlockData(static_cast<int>(blocks[b + DIM]));
+      }
+    }
+
+    // Recreate the map from the mesh vertices to their octree blocks
+    octree.m_vertexToBlockMap =
+      VertexBlockMap(&octree.m_meshWrapper.vertexSet());
+    for(int i = 0; i < numVerts; ++i)
+    {
+      const axom::IndexType* blk = &data.vertexBlocks[(DIM + 1) * i];
+      octree.m_vertexToBlockMap[i] =
+        BlockIndex(toGridPt(blk), static_cast<int>(blk[DIM]));
+    }
+
+    // Recreate the relations from the gray leaves to the mesh
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      if(!data.levelHasGrayLeaves[lev]) continue;
+
+      IndexBuffer& gvRelData = octree.m_indexRegistry.addNamelessBuffer();
+      IndexBuffer& geIndRelData = octree.m_indexRegistry.addNamelessBuffer();
+      IndexBuffer& geSizeRelData = octree.m_indexRegistry.addNamelessBuffer();
+
+      gvRelData.assign(data.grayLeafVertices[lev].begin(),
+                       data.grayLeafVertices[lev].end());
+      geIndRelData.assign(data.grayLeafElements[lev].begin(),
+                          data.grayLeafElements[lev].end());
+      geSizeRelData.assign(data.grayLeafOffsets[lev].begin(),
+                           data.grayLeafOffsets[lev].end());
+
+      octree.bindGrayLeafRelations(lev, gvRelData, geIndRelData, geSizeRelData);
+    }
+
+    return true;
+  }
+
+  /// Appends the grid point \a pt of a block and a \a value to \a arr
+  static void appendBlock(IndexArray& arr,
+                          const GridPt& pt,
+                          axom::IndexType value)
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      arr.push_back(static_cast<axom::IndexType>(pt[d]));
+    }
+    arr.push_back(value);
+  }
+
+  /// Checks that the DIM coordinates starting at \a coords lie in level \a lev
+  static bool isInLevel(const axom::IndexType* coords, int lev)
+  {
+    const axom::IndexType maxCoord = OctreeBaseType::maxCoordAtLevel(lev);
+    for(int d = 0; d < DIM; ++d)
+    {
+      if(coords[d] < 0 || coords[d] > maxCoord) return false;
+    }
+    return true;
+  }
+
+  /// Returns the grid point whose DIM coordinates start at \a coords
+  static GridPt toGridPt(const axom::IndexType* coords)
+  {
+    GridPt pt;
+    for(int d = 0; d < DIM; ++d)
+    {
+      pt[d] = static_cast<typename GridPt::CoordType>(coords[d]);
+    }
+    return pt;
+  }
+
+  template <typename T>
+  static void writeValue(std::ostream& os, const T& value)
+  {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  static bool readValue(std::istream& is, T& value)
+  {
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(is);
+  }
+
+  /// Writes the size of \a arr followed by its entries
+  template <typename T>
+  static void writeArray(std::ostream& os, const std::vector<T>& arr)
+  {
+    writeValue(os, static_cast<axom::int64>(arr.size()));
+    if(!arr.empty())
+    {
+      os.write(reinterpret_cast<const char*>(arr.data()),
+               arr.size() * sizeof(T));
+    }
+  }
+
+  /// Reads an array written by writeArray() into \a arr
+  template <typename T>
+  static bool readArray(std::istream& is, std::vector<T>& arr)
+  {
+    axom::int64 size = 0;
+    if(!readValue(is, size) || size < 0)
+    {
+      return false;
+    }
+
+    // Check that the file holds the data before allocating it
+    const std::streampos pos = is.tellg();
+    is.seekg(0, std::ios::end);
+    const std::streamoff remaining = is.tellg() - pos;
+    is.seekg(pos);
+    if(size > remaining / static_cast<std::streamoff>(sizeof(T)))
+    {
+      return false;
+    }
+
+    arr.resize(size);
+    if(size > 0)
+    {
+      is.read(reinterpret_cast<char*>(arr.data()), size * sizeof(T));
+    }
+    return static_cast<bool>(is);
+  }
+};
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_INOUT_OCTREE_SERIALIZER__HPP_
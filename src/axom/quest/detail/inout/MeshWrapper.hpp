@@ -21,6 +21,8 @@
 
 #include "axom/fmt.hpp"
 
+#include <cstring>
+
 namespace axom
 {
 namespace quest
@@ -264,6 +266,111 @@ public:
     return false;
   }
 
+  /**
+   * \brief Returns a hash of the vertex positions and cell connectivity of
+   * the input surface mesh
+   *
+   * \note Used to check that a saved InOutOctree was built over the same mesh.
+   * Once the mesh has been reindexed, this is the hash recorded while the
+   * input mesh was visited by reindexMesh(), or set by setReindexedMesh()
+   */
+  axom::uint64 inputMeshHash() const
+  {
+    if(m_meshWasReindexed)
+    {
+      return m_inputMeshHash;
+    }
+
+    InputMeshHasher hasher;
+
+    const axom::int64 numVerts = m_surfaceMesh->getNumberOfNodes();
+    hasher.add(numVerts);
+    for(axom::int64 i = 0; i < numVerts; ++i)
+    {
+      hasher.add(getMeshVertexPosition(i));
+    }
+
+    const axom::int64 numCells = m_surfaceMesh->getNumberOfCells();
+    hasher.add(numCells);
+    for(axom::int64 i = 0; i < numCells; ++i)
+    {
+      axom::IndexType vertIds[NUM_CELL_VERTS];
+      m_surfaceMesh->getCellNodeIDs(i, vertIds);
+      for(int j = 0; j < NUM_CELL_VERTS; ++j)
+      {
+        hasher.add(static_cast<axom::int64>(vertIds[j]));
+      }
+    }
+
+    return hasher.value();
+  }
+
+  /**
+   * \brief Replaces the wrapped mesh with already reindexed vertices and cells
+   *
+   * \param positions The positions of the vertices
+   * \param cellVertices The indices of the vertices of each cell, with
+   * NUM_CELL_VERTS entries per cell
+   * \param inputMeshHash The hash of the input mesh of the saved InOutOctree
+   * \note Used when restoring a saved InOutOctree. Like reindexMesh(), this
+   * step clears out the original mesh, which can be reconstructed using the
+   * regenerateSurfaceMesh() function
+   */
+  void setReindexedMesh(const std::vector<SpacePt>& positions,
+                        const std::vector<VertexIndex>& cellVertices,
+                        axom::uint64 inputMeshHash)
+  {
+    m_vertexSet = MeshVertexSet(static_cast<int>(positions.size()));
+    m_vertexPositions = VertexPositionMap(&m_vertexSet);
+    for(int i = 0; i < m_vertexSet.size(); ++i)
+    {
+      m_vertexPositions[i] = positions[i];
+    }
+
+    m_cv_data = cellVertices;
+    m_elementSet =
+      MeshElementSet(static_cast<int>(m_cv_data.size()) / NUM_CELL_VERTS);
+    m_cellToVertexRelation = CellVertexRelation(&m_elementSet, &m_vertexSet);
+    m_cellToVertexRelation.bindIndices(static_cast<int>(m_cv_data.size()),
+                                       &m_cv_data);
+
+    // Delete old mesh, and NULL its pointer
+    delete m_surfaceMesh;
+    m_surfaceMesh = nullptr;
+
+    m_inputMeshHash = inputMeshHash;
+    m_meshWasReindexed = true;
+  }
+
+protected:
+  /// Accumulates a 64-bit FNV-1a hash of the input mesh, one word at a time
+  class InputMeshHasher
+  {
+  public:
+    void add(axom::int64 value) { mix(static_cast<axom::uint64>(value)); }
+
+    void add(const SpacePt& pt)
+    {
+      for(int d = 0; d < DIM; ++d)
+      {
+        axom::uint64 bits;
+        std::memcpy(&bits, &pt[d], sizeof(bits));
+        mix(bits);
+      }
+    }
+
+    axom::uint64 value() const { return m_hash; }
+
+  private:
+    void mix(axom::uint64 word)
+    {
+      m_hash ^= word;
+      m_hash *= 1099511628211ULL;
+    }
+
+    axom::uint64 m_hash {14695981039346656037ULL};
+  };
+
 protected:
   SurfaceMesh*& m_surfaceMesh;  // ref to pointer to allow changing the mesh
 
@@ -275,6 +382,7 @@ protected:
   std::vector<VertexIndex> m_cv_data;
   CellVertexRelation m_cellToVertexRelation;
 
+  axom::uint64 m_inputMeshHash {0};
   bool m_meshWasReindexed {false};
 };
 
@@ -331,49 +439,6 @@ public:
     return (ids[0] == vIdx) || (ids[1] == vIdx);
   }
 
-  /**
-   * \brief Returns the normal vector of the surface for the cell with index \a cidx
-   * 
-   * If we are at an endpoint of the segment (i.e. if the \a segmentParameter is close
-   * to 0 or 1), we compute the average normal of its incident segments
-   */
-  template <typename CellIndexSet>
-  SpaceVector surfaceNormal(CellIndex cidx,
-                            double segmentParameter,
-                            const CellIndexSet& otherCells) const
-  {
-    SpaceVector vec = this->cellPositions(cidx).normal();
-
-    // Check if the point is at the first vertex of the segment
-    if(axom::utilities::isNearlyEqual(segmentParameter, 0.))
-    {
-      vec = vec.unitVector();
-      for(auto idx : otherCells)
-      {
-        auto vidx = cellVertexIndices(cidx)[0];
-        if(idx != cidx && incidentInVertex(cellVertexIndices(idx), vidx))
-        {
-          vec += this->cellPositions(idx).normal().unitVector();
-        }
-      }
-    }
-    // Check if the point is at the second vertex of the segment
-    else if(axom::utilities::isNearlyEqual(segmentParameter, 1.))
-    {
-      vec = vec.unitVector();
-      for(auto idx : otherCells)
-      {
-        auto vidx = cellVertexIndices(cidx)[1];
-        if(idx != cidx && incidentInVertex(cellVertexIndices(idx), vidx))
-        {
-          vec += this->cellPositions(idx).normal().unitVector();
-        }
-      }
-    }
-
-    return vec.unitVector();
-  }
-
   /**
    * \brief Reindexes the mesh vertices and edge indices using the given map
    *
@@ -388,17 +453,23 @@ public:
     m_vertexSet = MeshVertexSet(numVertices);
     m_vertexPositions = VertexPositionMap(&m_vertexSet);
 
+    // Hash the input mesh while visiting it, since it is deleted below
+    InputMeshHasher hasher;
+
     int numOrigVertices = numMeshVertices();
+    hasher.add(static_cast<axom::int64>(numOrigVertices));
     for(int i = 0; i < numOrigVertices; ++i)
     {
       const VertexIndex& vInd = vertexIndexMap[i];
       m_vertexPositions[vInd] = getMeshVertexPosition(i);
+      hasher.add(m_vertexPositions[vInd]);
     }
 
     // Update the vertex IDs of the triangles to the new vertices
     // and create a SLAM relation on these
     int numOrigEdges = numMeshCells();
 
+    hasher.add(static_cast<axom::int64>(numOrigEdges));
     m_cv_data.clear();
     m_cv_data.reserve(NUM_EDGE_VERTS * numOrigEdges);
     for(axom::IndexType i = 0; i < numOrigEdges; ++i)
@@ -410,7 +481,10 @@ public:
 
       // Remap the vertex IDs
       for(int j = 0; j < NUM_EDGE_VERTS; ++j)
+      {
+        hasher.add(static_cast<axom::int64>(vertIds[j]));
         vertIds[j] = vertexIndexMap[vertIds[j]];
+      }
 
       // Add to relation if not degenerate edge
       // (namely, we need 2 unique vertex IDs)
@@ -431,6 +505,7 @@ public:
     delete m_surfaceMesh;
     m_surfaceMesh = nullptr;
 
+    m_inputMeshHash = hasher.value();
     m_meshWasReindexed = true;
   }
 
@@ -537,17 +612,23 @@ public:
     m_vertexSet = MeshVertexSet(numVertices);
     m_vertexPositions = VertexPositionMap(&m_vertexSet);
 
+    // Hash the input mesh while visiting it, since it is deleted below
+    InputMeshHasher hasher;
+
     int numOrigVertices = numMeshVertices();
+    hasher.add(static_cast<axom::int64>(numOrigVertices));
     for(int i = 0; i < numOrigVertices; ++i)
     {
       const VertexIndex& vInd = vertexIndexMap[i];
       m_vertexPositions[vInd] = getMeshVertexPosition(i);
+      hasher.add(m_vertexPositions[vInd]);
     }
 
     // Update the vertex IDs of the triangles to the new vertices
     // and create a SLAM relation on these
     int numOrigTris = numMeshCells();
 
+    hasher.add(static_cast<axom::int64>(numOrigTris));
     m_cv_data.clear();
     m_cv_data.reserve(NUM_TRI_VERTS * numOrigTris);
     for(axom::IndexType i = 0; i < numOrigTris; ++i)
@@ -559,7 +640,10 @@ public:
 
       // Remap the vertex IDs
       for(int j = 0; j < NUM_TRI_VERTS; ++j)
+      {
+        hasher.add(static_cast<axom::int64>(vertIds[j]));
         vertIds[j] = vertexIndexMap[vertIds[j]];
+      }
 
       // Add to relation if not degenerate triangles
       // (namely, we need 3 unique vertex IDs)
@@ -582,6 +666,7 @@ public:
     delete m_surfaceMesh;
     m_surfaceMesh = nullptr;
 
+    m_inputMeshHash = hasher.value();
     m_meshWasReindexed = true;
   }
 
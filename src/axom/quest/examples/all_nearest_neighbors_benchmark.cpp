@@ -0,0 +1,243 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*! \file all_nearest_neighbors_benchmark.cpp
+ *  \brief This example compares the serial all-nearest-neighbors query of
+ *   Axom's quest component with its execution-space templated version.
+ *
+ *  Random points in a cube are assigned to random regions. For each point,
+ *  both queries find the closest point of another region within a search
+ *  radius, and the example reports their timings and checks that they find
+ *  neighbors at the same distances.
+ */
+
+// Axom includes
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/quest/AllNearestNeighbors.hpp"
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace slic = axom::slic;
+
+using IndexType = axom::IndexType;
+
+//------------------------------------------------------------------------------
+void initialize_logger()
+{
+  // initialize logger
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+
+  // setup the logstreams
+  std::string fmt = "";
+  slic::LogStream* logStream = nullptr;
+
+  fmt = "[<LEVEL>]: <MESSAGE>\n";
+  logStream = new slic::GenericOutputStream(&std::cout, fmt);
+
+  // register stream objects with the logger
+  slic::addStreamToAllMsgLevels(logStream);
+}
+
+//------------------------------------------------------------------------------
+void finalize_logger()
+{
+  slic::flushStreams();
+  slic::finalize();
+}
+
+struct Points
+{
+  std::vector<double> x, y, z;
+  std::vector<int> region;
+};
+
+/*!
+ * \brief Generates points uniformly in a cube whose size gives about
+ *  the given number of points in each unit volume.
+ */
+Points generate_points(IndexType numPoints, int numRegions, double density)
+{
+  constexpr unsigned int SEED = 42;
+  const double side = std::cbrt(numPoints / density);
+
+  Points pts;
+  pts.x.resize(numPoints);
+  pts.y.resize(numPoints);
+  pts.z.resize(numPoints);
+  pts.region.resize(numPoints);
+  for(IndexType i = 0; i < numPoints; ++i)
+  {
+    pts.x[i] = axom::utilities::random_real(0., side, SEED);
+    pts.y[i] = axom::utilities::random_real(0., side, SEED);
+    pts.z[i] = axom::utilities::random_real(0., side, SEED);
+    const double r = axom::utilities::random_real(0., 1. * numRegions, SEED);
+    pts.region[i] = std::min(static_cast<int>(r), numRegions - 1);
+  }
+  return pts;
+}
+
+/*!
+ * \brief Runs the templated query in the given execution space and logs its
+ *  timing and the number of distances that differ from the expected ones.
+ */
+template <typename ExecSpace>
+void run_query(const std::string& name,
+               const Points& pts,
+               double limit,
+               const std::vector<double>& expected_sqdist)
+{
+  const IndexType n = pts.region.size();
+  std::vector<IndexType> neighbor(n);
+  std::vector<double> sqdist(n);
+
+  axom::utilities::Timer timer(true);
+  axom::quest::all_nearest_neighbors<ExecSpace>(pts.x.data(),
+                                                pts.y.data(),
+                                                pts.z.data(),
+                                                pts.region.data(),
+                                                n,
+                                                limit,
+                                                neighbor.data(),
+                                                sqdist.data());
+  timer.stop();
+
+  IndexType mismatches = 0;
+  for(IndexType i = 0; i < n; ++i)
+  {
+    if(sqdist[i] != expected_sqdist[i])
+    {
+      ++mismatches;
+    }
+  }
+
+  SLIC_INFO(
+    axom::fmt::format("{:>10}: {:.4f}s, {:.2f} Mpoints/s, {} mismatches",
+                      name,
+                      timer.elapsed(),
+                      n / timer.elapsed() / 1e6,
+                      mismatches));
+}
+
+struct Arguments
+{
+  IndexType num_points {1000000};
+  int num_regions {4};
+  double density {1.};
+  double limit {1.};
+  std::string policy {"seq"};
+
+  void parse(int argc, char** argv, axom::CLI::App& app)
+  {
+    app.add_option("-n,--points", this->num_points, "number of points")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("-r,--regions", this->num_regions, "number of regions")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app
+      .add_option("-d,--density",
+                  this->density,
+                  "number of points in each unit volume")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("-l,--limit", this->limit, "search radius")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    std::vector<std::string> policies {"seq"};
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+    policies.push_back("omp");
+#endif
+    app
+      .add_option("-p,--policy",
+                  this->policy,
+                  "execution space of the templated query")
+      ->capture_default_str()
+      ->check(axom::CLI::IsMember(policies));
+
+    app.get_formatter()->column_width(40);
+
+    // could throw an exception
+    app.parse(argc, argv);
+
+    slic::flushStreams();
+  }
+};
+
+int main(int argc, char** argv)
+{
+  initialize_logger();
+  Arguments args;
+  axom::CLI::App app {
+    "Compares the serial and the templated all-nearest-neighbors queries"};
+
+  try
+  {
+    args.parse(argc, argv, app);
+  }
+  catch(const axom::CLI::ParseError& e)
+  {
+    int retval = -1;
+    retval = app.exit(e);
+    finalize_logger();
+    return retval;
+  }
+
+  const Points pts =
+    generate_points(args.num_points, args.num_regions, args.density);
+  SLIC_INFO(axom::fmt::format("{} points in {} regions, search radius {}",
+                              args.num_points,
+                              args.num_regions,
+                              args.limit));
+
+  // The serial query uses int sizes
+  SLIC_ERROR_IF(args.num_points > std::numeric_limits<int>::max(),
+                "The serial query supports at most "
+                  << std::numeric_limits<int>::max() << " points");
+  const int n = static_cast<int>(args.num_points);
+  std::vector<int> neighbor(n);
+  std::vector<double> sqdist(n);
+
+  axom::utilities::Timer timer(true);
+  axom::quest::all_nearest_neighbors(pts.x.data(),
+                                     pts.y.data(),
+                                     pts.z.data(),
+                                     pts.region.data(),
+                                     n,
+                                     args.limit,
+                                     neighbor.data(),
+                                     sqdist.data());
+  timer.stop();
+  SLIC_INFO(axom::fmt::format("{:>10}: {:.4f}s, {:.2f} Mpoints/s",
+                              "serial",
+                              timer.elapsed(),
+                              n / timer.elapsed() / 1e6));
+
+  if(args.policy == "seq")
+  {
+    run_query<axom::SEQ_EXEC>("seq", pts, args.limit, sqdist);
+  }
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+  else if(args.policy == "omp")
+  {
+    run_query<axom::OMP_EXEC>("omp", pts, args.limit, sqdist);
+  }
+#endif
+
+  finalize_logger();
+  return 0;
+}
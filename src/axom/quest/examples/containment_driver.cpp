@@ -95,11 +95,10 @@ public:
   {
     quest::STLReader reader;
     reader.setFileName(inputFile);
-    reader.read();
 
     // Create surface mesh
     m_surfaceMesh = new UMesh(3, mint::TRIANGLE);
-    reader.getMesh(static_cast<UMesh*>(m_surfaceMesh));
+    reader.readMesh(static_cast<UMesh*>(m_surfaceMesh));
   }
 
   mint::Mesh* getSurfaceMesh() const { return m_surfaceMesh; }
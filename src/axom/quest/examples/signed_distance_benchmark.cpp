@@ -0,0 +1,248 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*! \file signed_distance_benchmark.cpp
+ *  \brief This example measures the speedup of quest::SignedDistance
+ *   queries sorted along a Morton curve over queries in input order.
+ *
+ *  The surface is a triangulated sphere, and the query points are spread
+ *  in random order over a box around it, like the nodes of an unstructured
+ *  volume mesh. The example reports the timings of unsorted and sorted
+ *  queries and checks that they compute the same distances.
+ */
+
+// Axom includes
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/mint.hpp"
+#include "axom/primal.hpp"
+#include "axom/quest/SignedDistance.hpp"
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace mint = axom::mint;
+namespace primal = axom::primal;
+namespace slic = axom::slic;
+
+using UMesh = mint::UnstructuredMesh<mint::SINGLE_SHAPE>;
+using PointType = primal::Point<double, 3>;
+
+//------------------------------------------------------------------------------
+void initialize_logger()
+{
+  // initialize logger
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+
+  // setup the logstreams
+  std::string fmt = "";
+  slic::LogStream* logStream = nullptr;
+
+  fmt = "[<LEVEL>]: <MESSAGE>\n";
+  logStream = new slic::GenericOutputStream(&std::cout, fmt);
+
+  // register stream objects with the logger
+  slic::addStreamToAllMsgLevels(logStream);
+}
+
+//------------------------------------------------------------------------------
+void finalize_logger()
+{
+  slic::flushStreams();
+  slic::finalize();
+}
+
+/*!
+ * \brief Triangulates a unit sphere with the given number of subdivisions
+ *  along its latitude and longitude.
+ */
+void make_sphere(int resolution, UMesh& mesh)
+{
+  const double PI = M_PI;
+  const int numTheta = 2 * resolution;
+  const int numPhi = resolution;
+
+  // The poles, followed by rings of nodes from north to south
+  mesh.appendNode(0., 0., 1.);
+  mesh.appendNode(0., 0., -1.);
+  for(int j = 1; j < numPhi; ++j)
+  {
+    const double phi = PI * j / numPhi;
+    for(int i = 0; i < numTheta; ++i)
+    {
+      const double theta = 2. * PI * i / numTheta;
+      mesh.appendNode(std::sin(phi) * std::cos(theta),
+                      std::sin(phi) * std::sin(theta),
+                      std::cos(phi));
+    }
+  }
+
+  auto ringNode = [=](int j, int i) -> axom::IndexType {
+    return 2 + (j - 1) * numTheta + (i % numTheta);
+  };
+
+  for(int i = 0; i < numTheta; ++i)
+  {
+    const axom::IndexType north[3] = {0, ringNode(1, i), ringNode(1, i + 1)};
+    mesh.appendCell(north);
+
+    for(int j = 1; j < numPhi - 1; ++j)
+    {
+      const axom::IndexType upper[3] = {ringNode(j, i),
+                                        ringNode(j + 1, i),
+                                        ringNode(j + 1, i + 1)};
+      const axom::IndexType lower[3] = {ringNode(j, i),
+                                        ringNode(j + 1, i + 1),
+                                        ringNode(j, i + 1)};
+      mesh.appendCell(upper);
+      mesh.appendCell(lower);
+    }
+
+    const axom::IndexType south[3] = {1,
+                                      ringNode(numPhi - 1, i + 1),
+                                      ringNode(numPhi - 1, i)};
+    mesh.appendCell(south);
+  }
+}
+
+/*!
+ * \brief Runs unsorted and sorted queries in the given execution space and
+ *  logs their timings.
+ */
+template <typename ExecSpace>
+void run_queries(const UMesh& surface, const std::vector<PointType>& queryPts)
+{
+  const int npts = static_cast<int>(queryPts.size());
+  axom::quest::SignedDistance<3, ExecSpace> signedDistance(&surface, true);
+
+  std::vector<double> dist(npts);
+  axom::utilities::Timer timer(true);
+  signedDistance.computeDistances(npts, queryPts.data(), dist.data());
+  timer.stop();
+  const double unsortedTime = timer.elapsed();
+
+  signedDistance.setSortQueries(true);
+  std::vector<double> sortedDist(npts);
+  timer.start();
+  signedDistance.computeDistances(npts, queryPts.data(), sortedDist.data());
+  timer.stop();
+  const double sortedTime = timer.elapsed();
+
+  int mismatches = 0;
+  for(int i = 0; i < npts; ++i)
+  {
+    if(dist[i] != sortedDist[i])
+    {
+      ++mismatches;
+    }
+  }
+
+  SLIC_INFO(axom::fmt::format("{:>10}: {:.4f}s, {:.2f} Mqueries/s",
+                              "unsorted",
+                              unsortedTime,
+                              npts / unsortedTime / 1e6));
+  SLIC_INFO(axom::fmt::format("{:>10}: {:.4f}s, {:.2f} Mqueries/s",
+                              "sorted",
+                              sortedTime,
+                              npts / sortedTime / 1e6));
+  SLIC_INFO(axom::fmt::format("Speedup {:.2f}x, {} mismatches",
+                              unsortedTime / sortedTime,
+                              mismatches));
+}
+
+struct Arguments
+{
+  int num_queries {100000};
+  int resolution {50};
+  std::string policy {"seq"};
+
+  void parse(int argc, char** argv, axom::CLI::App& app)
+  {
+    app.add_option("-n,--queries", this->num_queries, "number of queries")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app
+      .add_option("-r,--resolution",
+                  this->resolution,
+                  "number of subdivisions of the sphere's latitude")
+      ->capture_default_str()
+      ->check(axom::CLI::Range(2, 10000));
+
+    std::vector<std::string> policies {"seq"};
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+    policies.push_back("omp");
+#endif
+    app
+      .add_option("-p,--policy",
+                  this->policy,
+                  "execution space of the queries")
+      ->capture_default_str()
+      ->check(axom::CLI::IsMember(policies));
+
+    app.get_formatter()->column_width(40);
+
+    // could throw an exception
+    app.parse(argc, argv);
+
+    slic::flushStreams();
+  }
+};
+
+int main(int argc, char** argv)
+{
+  initialize_logger();
+  Arguments args;
+  axom::CLI::App app {"Compares unsorted and sorted signed distance queries"};
+
+  try
+  {
+    args.parse(argc, argv, app);
+  }
+  catch(const axom::CLI::ParseError& e)
+  {
+    int retval = -1;
+    retval = app.exit(e);
+    finalize_logger();
+    return retval;
+  }
+
+  UMesh surface(3, mint::TRIANGLE);
+  make_sphere(args.resolution, surface);
+
+  // Queries in random order in a box around the sphere
+  constexpr unsigned int SEED = 42;
+  std::vector<PointType> queryPts(args.num_queries);
+  for(auto& pt : queryPts)
+  {
+    for(int d = 0; d < 3; ++d)
+    {
+      pt[d] = axom::utilities::random_real(-1.5, 1.5, SEED);
+    }
+  }
+
+  SLIC_INFO(axom::fmt::format("{} queries on a sphere with {} triangles",
+                              args.num_queries,
+                              surface.getNumberOfCells()));
+
+  if(args.policy == "seq")
+  {
+    run_queries<axom::SEQ_EXEC>(surface, queryPts);
+  }
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+  else if(args.policy == "omp")
+  {
+    run_queries<axom::OMP_EXEC>(surface, queryPts);
+  }
+#endif
+
+  finalize_logger();
+  return 0;
+}
@@ -265,28 +265,47 @@ struct InOutHelper
              int npoints,
              int* res) const
   {
-    if(z == nullptr)
-    {
-#ifdef AXOM_USE_OPENMP
+#if defined(AXOM_USE_OPENMP) && !defined(AXOM_USE_RAJA)
+    // The batched query needs RAJA to run under OpenMP,
+    // so evaluate the points one at a time in parallel
   #pragma omp parallel for schedule(static)
-#endif
-      for(int i = 0; i < npoints; ++i)
-      {
-        const bool ins = m_inoutTree->within(SpacePt {x[i], y[i]});
-        res[i] = ins ? 1 : 0;
-      }
-    }
-    else
+    for(int i = 0; i < npoints; ++i)
     {
-#ifdef AXOM_USE_OPENMP
-  #pragma omp parallel for schedule(static)
-#endif
-      for(int i = 0; i < npoints; ++i)
-      {
-        const bool ins = m_inoutTree->within(SpacePt {x[i], y[i], z[i]});
-        res[i] = ins ? 1 : 0;
-      }
+      const SpacePt pt = (z == nullptr) ? SpacePt {x[i], y[i]}
+                                        : SpacePt {x[i], y[i], z[i]};
+      res[i] = m_inoutTree->within(pt) ? 1 : 0;
     }
+#else
+  #ifdef AXOM_USE_OPENMP
+    using ExecSpace = axom::OMP_EXEC;
+  #else
+    using ExecSpace = axom::SEQ_EXEC;
+  #endif
+
+    axom::Array<SpacePt> pts(npoints, npoints);
+    axom::Array<bool> ins(npoints, npoints);
+    for_all<ExecSpace>(npoints, [&](IndexType i) {
+      pts[i] = (z == nullptr) ? SpacePt {x[i], y[i]}
+                              : SpacePt {x[i], y[i], z[i]};
+    });
+
+    const auto stats =
+      m_inoutTree->template within<ExecSpace>(pts.view(), ins.view());
+
+    for_all<ExecSpace>(npoints, [&](IndexType i) { res[i] = ins[i] ? 1 : 0; });
+
+    SLIC_DEBUG(fmt::format(
+      "Evaluated {} points in {} seconds ({} seconds sorting). "
+      "Leaf colors: {} black, {} white, {} gray; {} points were outside",
+      stats.numQueries,
+      stats.queryTime,
+      stats.sortTime,
+      stats.numBlack,
+      stats.numWhite,
+      stats.numGray,
+      stats.numOutside));
+    AXOM_UNUSED_VAR(stats);
+#endif
 
     return QUEST_INOUT_SUCCESS;
   }
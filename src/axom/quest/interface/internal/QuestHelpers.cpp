@@ -334,12 +334,18 @@ int read_stl_mesh(const std::string& file, mint::Mesh*& m, MPI_Comm comm)
 
   // STEP 3: read the mesh from the STL file
   reader.setFileName(file);
+#ifdef AXOM_USE_MPI
   int rc = reader.read();
   if(rc == READ_SUCCESS)
   {
     reader.getMesh(static_cast<TriangleMesh*>(m));
   }
-  else
+#else
+  // read directly into the mesh, without an intermediate copy
+  int rc = reader.readMesh(static_cast<TriangleMesh*>(m));
+#endif
+
+  if(rc != READ_SUCCESS)
   {
     SLIC_WARNING("reading STL file failed, setting mesh to NULL");
     delete m;
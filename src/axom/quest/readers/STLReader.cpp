@@ -6,17 +6,207 @@
 #include "axom/quest/readers/STLReader.hpp"
 
 // Axom includes
+#include "axom/core/utilities/Timer.hpp"
 #include "axom/core/utilities/Utilities.hpp"
 #include "axom/mint/mesh/CellTypes.hpp"
 #include "axom/slic/interface/slic.hpp"
 
+#include "axom/fmt.hpp"
+
 // C/C++ includes
+#include <cstring>  // for std::memcpy
 #include <fstream>
 
+#ifdef WIN32
+  #include <iterator>  // for std::istreambuf_iterator
+#else
+  #include <fcntl.h>     // for open
+  #include <sys/mman.h>  // for mmap, munmap
+  #include <sys/stat.h>  // for fstat
+  #include <unistd.h>    // for close
+#endif
+
 namespace
 {
-const std::size_t BINARY_HEADER_SIZE = 80;  // bytes
-const std::size_t BINARY_TRI_SIZE = 50;     // bytes
+const std::size_t BINARY_HEADER_SIZE = 80;   // bytes
+const std::size_t BINARY_TRI_SIZE = 50;      // bytes
+const std::size_t BINARY_VERTS_OFFSET = 12;  // bytes, skips the normal
+
+/*!
+ * \brief Read-only view of the contents of a file.
+ *
+ * The file is memory-mapped where supported, so that its pages are loaded
+ * on demand by the threads that decode them. Otherwise, it is read into a
+ * buffer.
+ */
+class FileBuffer
+{
+public:
+  FileBuffer() = default;
+  ~FileBuffer() { close(); }
+
+  FileBuffer(const FileBuffer&) = delete;
+  FileBuffer& operator=(const FileBuffer&) = delete;
+
+  /// Opens the given file, returns false if it cannot be read
+  bool open(const std::string& fileName)
+  {
+#ifdef WIN32
+    std::ifstream ifs(fileName.c_str(), std::ios::in | std::ios::binary);
+    if(!ifs.is_open())
+    {
+      return false;
+    }
+    m_buffer.assign(std::istreambuf_iterator<char>(ifs),
+                    std::istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+#else
+    const int fd = ::open(fileName.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+      return false;
+    }
+
+    struct stat sb;
+    if(fstat(fd, &sb) != 0 || sb.st_size == 0)
+    {
+      ::close(fd);
+      return false;
+    }
+
+    const std::size_t fileSize = static_cast<std::size_t>(sb.st_size);
+    void* addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping remains valid after closing the descriptor
+
+    if(addr == MAP_FAILED)
+    {
+      return false;
+    }
+
+    m_data = static_cast<const char*>(addr);
+    m_size = fileSize;
+    return true;
+#endif
+  }
+
+  /// Releases the file contents
+  void close()
+  {
+#ifdef WIN32
+    m_buffer.clear();
+#else
+    if(m_data != nullptr)
+    {
+      munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  const char* data() const { return m_data; }
+  std::size_t size() const { return m_size; }
+
+private:
+  const char* m_data {nullptr};
+  std::size_t m_size {0};
+#ifdef WIN32
+  std::vector<char> m_buffer;
+#endif
+};
+
+/*!
+ * \brief Returns the number of triangles in a binary STL buffer, or -1 if
+ *  the buffer is too small to hold them.
+ */
+axom::IndexType getNumBinaryTriangles(const FileBuffer& buffer)
+{
+  const std::size_t totalHeaderSize = BINARY_HEADER_SIZE + sizeof(axom::int32);
+  if(buffer.size() < totalHeaderSize)
+  {
+    return -1;
+  }
+
+  axom::uint32 numTris = 0;
+  std::memcpy(&numTris, buffer.data() + BINARY_HEADER_SIZE, sizeof(numTris));
+  if(!axom::utilities::isLittleEndian())
+  {
+    numTris = axom::utilities::swapEndian(numTris);
+  }
+
+  const std::size_t expectedSize = totalHeaderSize + numTris * BINARY_TRI_SIZE;
+  return (buffer.size() < expectedSize) ? -1
+                                        : static_cast<axom::IndexType>(numTris);
+}
+
+/*!
+ * \brief Decodes the vertex positions of the triangles of a binary STL buffer.
+ *
+ * The coordinates of the jth vertex of the ith triangle are written to
+ * x, y and z at index (3*i+j)*stride, so the same routine fills interleaved
+ * and separate coordinate arrays. Triangles are decoded in parallel when
+ * OpenMP is available.
+ */
+void decodeBinaryTriangles(const FileBuffer& buffer,
+                           axom::IndexType numTris,
+                           double* x,
+                           double* y,
+                           double* z,
+                           int stride)
+{
+  const char* tris =
+    buffer.data() + BINARY_HEADER_SIZE + sizeof(axom::int32);
+  const bool isLittleEndian = axom::utilities::isLittleEndian();
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numTris; ++i)
+  {
+    // copy out of the buffer since triangles are not 4-byte aligned
+    float vert[9];
+    const char* tri = tris + i * BINARY_TRI_SIZE;
+    std::memcpy(vert, tri + BINARY_VERTS_OFFSET, sizeof(vert));
+
+    for(int j = 0; j < 3; ++j)
+    {
+      const axom::IndexType idx = (3 * i + j) * stride;
+      for(int d = 0; d < 3; ++d)
+      {
+        const float v = vert[3 * j + d];
+        const float coord =
+          isLittleEndian ? v : axom::utilities::swapEndian(v);
+        double* coords = (d == 0) ? x : ((d == 1) ? y : z);
+        coords[idx] = static_cast<double>(coord);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Logs the time taken to read a binary STL file and the throughput,
+ *  at the debug level.
+ */
+void logBinaryReadStats(const std::string& AXOM_DEBUG_PARAM(fileName),
+                        std::size_t AXOM_DEBUG_PARAM(numBytes),
+                        axom::IndexType AXOM_DEBUG_PARAM(numTris),
+                        double AXOM_DEBUG_PARAM(seconds))
+{
+#ifdef AXOM_DEBUG
+  const double megabytes = numBytes / (1024. * 1024.);
+  SLIC_DEBUG(axom::fmt::format(
+    "Read {} triangles ({:.1f} MB) from binary STL file '{}' in {} seconds "
+    "({:.1f} MB/s)",
+    numTris,
+    megabytes,
+    fileName,
+    seconds,
+    seconds > 0. ? megabytes / seconds : 0.));
+#endif
+}
+
 }  // namespace
 
 //------------------------------------------------------------------------------
@@ -57,17 +247,17 @@ bool STLReader::isAsciiFormat() const
     return false;
   }
 
-  // Find out the file size
+  // Find out the file size; binary STL files may be larger than 2GB
   ifs.seekg(0, ifs.end);
-  axom::int32 fileSize = static_cast<axom::int32>(ifs.tellg());
+  const std::size_t fileSize = static_cast<std::size_t>(ifs.tellg());
 
-  const int totalHeaderSize = (BINARY_HEADER_SIZE + sizeof(axom::int32));
+  const std::size_t totalHeaderSize = BINARY_HEADER_SIZE + sizeof(axom::int32);
   if(fileSize < totalHeaderSize) return true;
 
   // Find the number of triangles (if the file were binary)
-  int numTris = 0;
+  axom::uint32 numTris = 0;
   ifs.seekg(BINARY_HEADER_SIZE, ifs.beg);
-  ifs.read((char*)&numTris, sizeof(axom::int32));
+  ifs.read((char*)&numTris, sizeof(axom::uint32));
 
   if(!utilities::isLittleEndian())
   {
@@ -75,7 +265,8 @@ bool STLReader::isAsciiFormat() const
   }
 
   // Check if the size matches our expectation
-  int expectedBinarySize = totalHeaderSize + (numTris * BINARY_TRI_SIZE);
+  const std::size_t expectedBinarySize =
+    totalHeaderSize + (numTris * BINARY_TRI_SIZE);
 
   ifs.close();
 
@@ -128,59 +319,85 @@ int STLReader::readBinarySTL()
   //    an 80 byte header (BINARY_HEADER_SIZE)
   //    followed by a 32 bit int encoding the number of faces
   //    followed by the triangles, each of which is 50 bytes (BINARY_TRI_SIZE)
+  axom::utilities::Timer timer(true);
 
-  // A local union data structure for triangles in a binary STL
-  union BinarySTLTri
+  FileBuffer buffer;
+  if(!buffer.open(m_fileName))
   {
-    axom::int8 raw[BINARY_TRI_SIZE];
+    SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
+    return (-1);
+  }
 
-    struct
-    {
-      float normal[3];
-      float vert[9];
-      axom::uint16 attr;
-    } data;
+  const axom::IndexType numTris = getNumBinaryTriangles(buffer);
+  if(numTris < 0)
+  {
+    SLIC_WARNING("Truncated binary STL file [" << m_fileName << "]");
+    return (-1);
+  }
+
+  m_num_faces = numTris;
+  m_num_nodes = m_num_faces * 3;
+  m_nodes.resize(m_num_nodes * 3);
 
-  } tri;
+  // Cast to doubles and ignore normals and attributes
+  if(m_num_nodes > 0)
+  {
+    decodeBinaryTriangles(buffer,
+                          m_num_faces,
+                          &m_nodes[0],
+                          &m_nodes[1],
+                          &m_nodes[2],
+                          3);
+  }
 
-  bool const isLittleEndian = axom::utilities::isLittleEndian();
+  timer.stop();
+  logBinaryReadStats(m_fileName, buffer.size(), m_num_faces, timer.elapsed());
 
-  // Open binary file, skip the header
-  std::ifstream ifs(m_fileName.c_str(), std::ios::in | std::ios::binary);
-  if(!ifs.is_open())
+  return (0);
+}
+
+//------------------------------------------------------------------------------
+int STLReader::readBinarySTL(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
+{
+  axom::utilities::Timer timer(true);
+
+  FileBuffer buffer;
+  if(!buffer.open(m_fileName))
   {
     SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
     return (-1);
   }
 
-  ifs.seekg(BINARY_HEADER_SIZE);
-
-  // read the num faces and reserve room for the vertex positions
-  ifs.read((char*)&m_num_faces, sizeof(axom::int32));
-
-  if(!isLittleEndian)
+  const axom::IndexType numTris = getNumBinaryTriangles(buffer);
+  if(numTris < 0)
   {
-    m_num_faces = utilities::swapEndian(m_num_faces);
+    SLIC_WARNING("Truncated binary STL file [" << m_fileName << "]");
+    return (-1);
   }
 
+  m_num_faces = numTris;
   m_num_nodes = m_num_faces * 3;
-  m_nodes.reserve(m_num_nodes * 3);
+  prepareMesh(mesh);
 
-  // Read the triangles. Cast to doubles and ignore normals and attributes
-  for(axom::IndexType i = 0; i < m_num_faces; ++i)
-  {
-    ifs.read((char*)tri.raw, BINARY_TRI_SIZE);
-
-    for(int j = 0; j < 9; ++j)
-    {
-      float coord = isLittleEndian ? tri.data.vert[j]
-                                   : utilities::swapEndian(tri.data.vert[j]);
+  // Decode the vertices straight into the mesh
+  double* x = mesh->getCoordinateArray(mint::X_COORDINATE);
+  double* y = mesh->getCoordinateArray(mint::Y_COORDINATE);
+  double* z = mesh->getCoordinateArray(mint::Z_COORDINATE);
+  decodeBinaryTriangles(buffer, m_num_faces, x, y, z, 1);
 
-      m_nodes.push_back(static_cast<double>(coord));
-    }
+  // Load the triangles.  Note that the indices are implicitly defined.
+  axom::IndexType* conn = mesh->getCellNodesArray();
+  const axom::IndexType numConn = m_num_nodes;
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numConn; ++i)
+  {
+    conn[i] = i;
   }
 
-  ifs.close();
+  timer.stop();
+  logBinaryReadStats(m_fileName, buffer.size(), m_num_faces, timer.elapsed());
 
   return (0);
 }
@@ -200,13 +417,73 @@ int STLReader::read()
   return (rc);
 }
 
+//------------------------------------------------------------------------------
+int STLReader::readMesh(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
+{
+  if(m_fileName.empty())
+  {
+    return (-1);
+  }
+
+  // Clear internal data, check the format and load the data
+  this->clear();
+
+  if(isAsciiFormat())
+  {
+    int rc = readAsciiSTL();
+    if(rc == 0)
+    {
+      getMesh(mesh);
+    }
+    return (rc);
+  }
+
+  return readBinarySTL(mesh);
+}
+
 //------------------------------------------------------------------------------
 void STLReader::getMesh(axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
 {
-  /* Sanity checks */
-  SLIC_ERROR_IF(mesh == nullptr, "supplied mesh is null!");
   SLIC_ERROR_IF(static_cast<axom::IndexType>(m_nodes.size()) != 3 * m_num_nodes,
                 "nodes vector size doesn't match expected size!");
+
+  prepareMesh(mesh);
+
+  double* x = mesh->getCoordinateArray(mint::X_COORDINATE);
+  double* y = mesh->getCoordinateArray(mint::Y_COORDINATE);
+  double* z = mesh->getCoordinateArray(mint::Z_COORDINATE);
+
+  // Load the vertices into the mesh
+  const double* nodes = m_nodes.data();
+  const axom::IndexType numNodes = m_num_nodes;
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numNodes; ++i)
+  {
+    const axom::IndexType offset = i * 3;
+    x[i] = nodes[offset];
+    y[i] = nodes[offset + 1];
+    z[i] = nodes[offset + 2];
+  }
+
+  // Load the triangles.  Note that the indices are implicitly defined.
+  axom::IndexType* conn = mesh->getCellNodesArray();
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numNodes; ++i)
+  {
+    conn[i] = i;
+  }
+}
+
+//------------------------------------------------------------------------------
+void STLReader::prepareMesh(
+  axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh) const
+{
+  /* Sanity checks */
+  SLIC_ERROR_IF(mesh == nullptr, "supplied mesh is null!");
   SLIC_ERROR_IF(mesh->getDimension() != 3, "STL reader expects a 3D mesh!");
   SLIC_ERROR_IF(mesh->getCellType() != mint::TRIANGLE,
                 "STL reader expects a triangle mesh!");
@@ -223,29 +500,6 @@ void STLReader::getMesh(axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
   SLIC_ERROR_IF(
     mesh->getNumberOfCells() != m_num_faces,
     "mesh number of cells does not match number of triangles in the STL file!");
-
-  double* x = mesh->getCoordinateArray(mint::X_COORDINATE);
-  double* y = mesh->getCoordinateArray(mint::Y_COORDINATE);
-  double* z = mesh->getCoordinateArray(mint::Z_COORDINATE);
-
-  // Load the vertices into the mesh
-  for(axom::IndexType i = 0; i < m_num_nodes; ++i)
-  {
-    const axom::IndexType offset = i * 3;
-    x[i] = m_nodes[offset];
-    y[i] = m_nodes[offset + 1];
-    z[i] = m_nodes[offset + 2];
-  }
-
-  // Load the triangles.  Note that the indices are implicitly defined.
-  axom::IndexType* conn = mesh->getCellNodesArray();
-  for(axom::IndexType i = 0; i < m_num_faces; ++i)
-  {
-    const axom::IndexType offset = i * 3;
-    conn[offset] = offset;
-    conn[offset + 1] = offset + 1;
-    conn[offset + 2] = offset + 2;
-  }
 }
 
 }  // end namespace quest
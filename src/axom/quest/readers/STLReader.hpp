@@ -71,6 +71,21 @@ public:
    */
   virtual int read();
 
+  /*!
+   * \brief Reads in the surface mesh from an STL file directly into the
+   *  supplied unstructured mesh object.
+   *
+   * Equivalent to calling read() followed by getMesh(), except that binary
+   * STL files are decoded straight into the coordinate and connectivity
+   * arrays of the mesh, without an intermediate copy.
+   *
+   * \param [in,out] mesh pointer to the unstructured mesh.
+   * \pre m_fileName != ""
+   * \pre mesh != nullptr.
+   * \return status set to zero on success; set to a non-zero value otherwise.
+   */
+  int readMesh(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh);
+
   /*!
    * \brief Stores the STL data in the supplied unstructured mesh object.
    * \param [in,out] mesh pointer to the unstructured mesh.
@@ -104,6 +119,18 @@ private:
    */
   int readBinarySTL();
 
+  /*!
+   * \brief Reads a binary-encoded STL file into the supplied mesh
+   * \note The filename should be set with STLReader::setFileName()
+   */
+  int readBinarySTL(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh);
+
+  /*!
+   * \brief Checks that the supplied mesh can hold the STL data and resizes
+   *  it to the number of nodes and faces, unless it is external.
+   */
+  void prepareMesh(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh) const;
+
 protected:
   std::string m_fileName;
 
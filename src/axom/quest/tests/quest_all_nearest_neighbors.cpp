@@ -240,6 +240,132 @@ TEST(quest_all_nearnbr, cplx_13region_query)
   }
 }
 
+/*!
+ * Checks that the parallel query in ExecSpace matches the brute force query
+ * on random points in a few regions
+ */
+template <typename ExecSpace>
+void check_parallel_query(int n, double limit)
+{
+  std::vector<double> x(n), y(n), z(n);
+  std::vector<int> region(n);
+  for(int i = 0; i < n; ++i)
+  {
+    x[i] = axom::utilities::random_real(-5., 5.);
+    y[i] = axom::utilities::random_real(-5., 5.);
+    z[i] = axom::utilities::random_real(-1., 1.);
+    region[i] = i % 7;
+  }
+
+  std::vector<int> bfneighbor(n, -1);
+  std::vector<double> bfsqdst(n);
+  all_nearest_neighbors_bruteforce(x.data(),
+                                   y.data(),
+                                   z.data(),
+                                   region.data(),
+                                   n,
+                                   limit,
+                                   bfneighbor.data(),
+                                   bfsqdst.data());
+
+  std::vector<axom::IndexType> idxneighbor(n, -1);
+  std::vector<double> idxsqdst(n);
+  axom::quest::all_nearest_neighbors<ExecSpace>(x.data(),
+                                                y.data(),
+                                                z.data(),
+                                                region.data(),
+                                                n,
+                                                limit,
+                                                idxneighbor.data(),
+                                                idxsqdst.data());
+
+  for(int i = 0; i < n; ++i)
+  {
+    EXPECT_EQ(bfneighbor[i], idxneighbor[i]) << "point " << i;
+    EXPECT_DOUBLE_EQ(bfsqdst[i], idxsqdst[i]) << "point " << i;
+  }
+}
+
+TEST(quest_all_nearnbr, parallel_query_sequential)
+{
+  SCOPED_TRACE("Comparing brute force with parallel indexed, sequential");
+  check_parallel_query<axom::SEQ_EXEC>(0, 1.);
+  check_parallel_query<axom::SEQ_EXEC>(1, 1.);
+  check_parallel_query<axom::SEQ_EXEC>(2000, 0.3);
+  check_parallel_query<axom::SEQ_EXEC>(2000, 1.5);
+  check_parallel_query<axom::SEQ_EXEC>(2000, 20.);
+}
+
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+TEST(quest_all_nearnbr, parallel_query_openmp)
+{
+  SCOPED_TRACE("Comparing brute force with parallel indexed, OpenMP");
+  check_parallel_query<axom::OMP_EXEC>(2000, 0.3);
+  check_parallel_query<axom::OMP_EXEC>(2000, 1.5);
+}
+#endif
+
+TEST(quest_all_nearnbr, equidistant_neighbors)
+{
+  SCOPED_TRACE("Comparing queries with ties between neighbors");
+
+  // On a checkerboard lattice, the points have up to four nearest neighbors
+  // in the other region, at unit distance
+  const int res = 12;
+  const int n = res * res;
+  const double limit = 1.5;
+  std::vector<double> x(n), y(n), z(n, 0.);
+  std::vector<int> region(n);
+  for(int i = 0; i < n; ++i)
+  {
+    x[i] = i % res;
+    y[i] = i / res;
+    region[i] = (i % res + i / res) % 2;
+  }
+
+  std::vector<int> bfneighbor(n, -1);
+  std::vector<double> bfsqdst(n);
+  all_nearest_neighbors_bruteforce(x.data(),
+                                   y.data(),
+                                   z.data(),
+                                   region.data(),
+                                   n,
+                                   limit,
+                                   bfneighbor.data(),
+                                   bfsqdst.data());
+
+  std::vector<int> idxneighbor(n, -1);
+  std::vector<double> idxsqdst(n);
+  axom::quest::all_nearest_neighbors(x.data(),
+                                     y.data(),
+                                     z.data(),
+                                     region.data(),
+                                     n,
+                                     limit,
+                                     idxneighbor.data(),
+                                     idxsqdst.data());
+
+  std::vector<axom::IndexType> parneighbor(n, -1);
+  std::vector<double> parsqdst(n);
+  axom::quest::all_nearest_neighbors<axom::SEQ_EXEC>(x.data(),
+                                                     y.data(),
+                                                     z.data(),
+                                                     region.data(),
+                                                     n,
+                                                     limit,
+                                                     parneighbor.data(),
+                                                     parsqdst.data());
+
+  for(int i = 0; i < n; ++i)
+  {
+    EXPECT_DOUBLE_EQ(1., bfsqdst[i]) << "point " << i;
+    EXPECT_EQ(bfneighbor[i], idxneighbor[i]) << "point " << i;
+    EXPECT_EQ(bfneighbor[i], parneighbor[i]) << "point " << i;
+    EXPECT_DOUBLE_EQ(bfsqdst[i], idxsqdst[i]) << "point " << i;
+    EXPECT_DOUBLE_EQ(bfsqdst[i], parsqdst[i]) << "point " << i;
+  }
+}
+
 void readPointsFile(char* filename,
                     std::vector<double>& x,
                     std::vector<double>& y,
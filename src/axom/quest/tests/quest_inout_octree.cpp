@@ -33,8 +33,19 @@ using SpaceVector = Octree3D::SpaceVector;
 using GridPt = Octree3D::GridPt;
 using BlockIndex = Octree3D::BlockIndex;
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <string>
+
+#ifdef AXOM_USE_OPENMP
+  #include "omp.h"
+#endif
 
 // Uncomment the line below for true randomized points
 #ifndef INOUT_OCTREE_TESTER_SHOULD_SEED
@@ -240,6 +251,377 @@ TEST(quest_inout_octree, tetrahedron_mesh)
   }
 }
 
+/// Checks the batched containment query against the pointwise query
+template <typename ExecSpace>
+void check_batched_within()
+{
+  namespace quest = axom::quest;
+
+  axom::mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  GeometricBoundingBox bbox(SpacePt(-2.), SpacePt(2.));
+
+  Octree3D octree(bbox, mesh);
+  octree.generateIndex();
+
+  // Random points in a box slightly larger than the octree's
+  const double bbMin = bbox.getMin()[0] - 0.5;
+  const double bbMax = bbox.getMax()[0] + 0.5;
+
+  const int numPts = 10000;
+  axom::Array<SpacePt> pts(numPts);
+  for(int i = 0; i < numPts; ++i)
+  {
+    pts[i] = quest::utilities::randomSpacePt<DIM>(bbMin, bbMax);
+  }
+
+  axom::Array<bool> results(numPts, numPts);
+  const Octree3D::QueryStatistics stats =
+    octree.within<ExecSpace>(pts.view(), results.view());
+
+  for(int i = 0; i < numPts; ++i)
+  {
+    EXPECT_EQ(octree.within(pts[i]), results[i]) << "Point " << pts[i];
+  }
+
+  EXPECT_EQ(numPts, stats.numQueries);
+  EXPECT_GT(stats.numOutside, 0);
+  EXPECT_GT(stats.numBlack, 0);
+  EXPECT_GT(stats.numWhite, 0);
+  EXPECT_GT(stats.numGray, 0);
+  EXPECT_EQ(stats.numQueries,
+            stats.numOutside + stats.numBlack + stats.numWhite + stats.numGray);
+  EXPECT_GE(stats.sortTime, 0.);
+  EXPECT_GE(stats.queryTime, 0.);
+
+  // An empty batch is a no-op
+  const Octree3D::QueryStatistics emptyStats =
+    octree.within<ExecSpace>(axom::ArrayView<const SpacePt>(),
+                             axom::ArrayView<bool>());
+  EXPECT_EQ(0, emptyStats.numQueries);
+
+  delete mesh;
+}
+
+TEST(quest_inout_octree, batched_within_sequential)
+{
+  SLIC_INFO("*** Checks the batched InOutOctree queries in serial.\n");
+  check_batched_within<axom::SEQ_EXEC>();
+}
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+TEST(quest_inout_octree, batched_within_omp)
+{
+  SLIC_INFO("*** Checks the batched InOutOctree queries with OpenMP.\n");
+  check_batched_within<axom::OMP_EXEC>();
+}
+#endif
+
+/// Checks the flattened octree's queries against the octree's queries
+template <typename ExecSpace>
+void check_flat_within()
+{
+  namespace quest = axom::quest;
+  using FlatOctree3D = quest::FlatInOutOctree<DIM, ExecSpace>;
+
+  axom::mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  GeometricBoundingBox bbox(SpacePt(-2.), SpacePt(2.));
+
+  Octree3D octree(bbox, mesh);
+
+  // Flattening an octree without an index produces an empty octree
+  {
+    FlatOctree3D emptyFlat(octree);
+    EXPECT_EQ(0, emptyFlat.numBlocks());
+    EXPECT_FALSE(emptyFlat.getQueryObject().within(SpacePt(0.)));
+  }
+
+  octree.generateIndex();
+  FlatOctree3D flat(octree);
+  EXPECT_GT(flat.numBlocks(), 1);
+  EXPECT_GT(flat.numLevels(), 1);
+
+  // Random points in a box slightly larger than the octree's, along with
+  // points near the vertices of the octahedron
+  const double bbMin = bbox.getMin()[0] - 0.5;
+  const double bbMax = bbox.getMax()[0] + 0.5;
+
+  const int numPts = 10000;
+  axom::Array<SpacePt> pts(numPts);
+  for(int i = 0; i < numPts; ++i)
+  {
+    pts[i] = quest::utilities::randomSpacePt<DIM>(bbMin, bbMax);
+  }
+  for(int i = 0; i < mesh->getNumberOfNodes(); ++i)
+  {
+    const SpacePt vert = getVertex(mesh, i);
+    for(double scale : {0.99, 1., 1.01})
+    {
+      pts.push_back(SpacePt(vert.array() * scale));
+    }
+  }
+
+  const auto query = flat.getQueryObject();
+  for(const SpacePt& pt : pts)
+  {
+    EXPECT_EQ(octree.within(pt), query.within(pt)) << "Point " << pt;
+  }
+
+  axom::Array<bool> results(pts.size(), pts.size());
+  flat.within(pts.view(), results.view());
+  for(int i = 0; i < pts.size(); ++i)
+  {
+    EXPECT_EQ(octree.within(pts[i]), results[i]) << "Point " << pts[i];
+  }
+
+  delete mesh;
+}
+
+TEST(quest_inout_octree, flat_within_sequential)
+{
+  SLIC_INFO("*** Checks the flattened InOutOctree queries in serial.\n");
+  check_flat_within<axom::SEQ_EXEC>();
+}
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+TEST(quest_inout_octree, flat_within_omp)
+{
+  SLIC_INFO("*** Checks the flattened InOutOctree queries with OpenMP.\n");
+  check_flat_within<axom::OMP_EXEC>();
+}
+#endif
+
+TEST(quest_inout_octree, save_and_load_index)
+{
+  SLIC_INFO("*** Saves an InOutOctree to a file and loads it back.\n");
+
+  namespace quest = axom::quest;
+
+  const std::string fileName = "quest_inout_octree_index.bin";
+  GeometricBoundingBox bbox(SpacePt(-2.), SpacePt(2.));
+
+  axom::mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  Octree3D octree(bbox, mesh);
+
+  // Cannot save an octree before generating its index
+  EXPECT_FALSE(octree.saveIndex(fileName));
+
+  octree.generateIndex();
+  EXPECT_TRUE(octree.saveIndex(fileName));
+
+  // Load the index into an octree over the same input mesh
+  axom::mint::Mesh* loadedMesh = quest::utilities::make_octahedron_mesh();
+  Octree3D loadedOctree(bbox, loadedMesh);
+  EXPECT_TRUE(loadedOctree.loadIndex(fileName));
+
+  EXPECT_EQ(mesh->getNumberOfNodes(), loadedMesh->getNumberOfNodes());
+  EXPECT_EQ(mesh->getNumberOfCells(), loadedMesh->getNumberOfCells());
+
+  for(int i = 0; i < 1000; ++i)
+  {
+    SpacePt pt = quest::utilities::randomSpacePt<DIM>(-2.5, 2.5);
+    EXPECT_EQ(octree.within(pt), loadedOctree.within(pt)) << "Point " << pt;
+  }
+
+  // A loaded index can be saved again
+  EXPECT_TRUE(loadedOctree.saveIndex(fileName));
+
+  // The index cannot be loaded twice, or after it was generated
+  EXPECT_FALSE(loadedOctree.loadIndex(fileName));
+  EXPECT_FALSE(octree.loadIndex(fileName));
+
+  // The index is not loaded for a different mesh or bounding box
+  {
+    // Perturb a vertex of the octahedron
+    axom::mint::Mesh* otherMesh = quest::utilities::make_octahedron_mesh();
+    otherMesh->getCoordinateArray(axom::mint::X_COORDINATE)[0] += 0.01;
+
+    Octree3D otherOctree(bbox, otherMesh);
+    EXPECT_FALSE(otherOctree.loadIndex(fileName));
+    EXPECT_EQ(6, otherMesh->getNumberOfNodes());
+
+    // The octree can still generate its index
+    otherOctree.generateIndex();
+    EXPECT_TRUE(otherOctree.within(SpacePt(0.)));
+    delete otherMesh;
+  }
+  {
+    axom::mint::Mesh* otherMesh = quest::utilities::make_octahedron_mesh();
+    Octree3D otherOctree(GeometricBoundingBox(SpacePt(-3.), SpacePt(3.)),
+                         otherMesh);
+    EXPECT_FALSE(otherOctree.loadIndex(fileName));
+    delete otherMesh;
+  }
+  {
+    axom::mint::Mesh* otherMesh = quest::utilities::make_octahedron_mesh();
+    Octree3D otherOctree(bbox, otherMesh);
+    EXPECT_FALSE(otherOctree.loadIndex("missing_inout_octree_index.bin"));
+    delete otherMesh;
+  }
+
+  // The index is not loaded when its cells refer to missing vertices
+  {
+    std::ifstream ifs(fileName, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(ifs)),
+                         std::istreambuf_iterator<char>());
+
+    // After the header, the file holds the size and the coordinates of the
+    // vertices, followed by the size and the vertex indices of the cells
+    const axom::int64 numCoords = 3 * mesh->getNumberOfNodes();
+    const axom::int64 numCellVerts = 3 * mesh->getNumberOfCells();
+    const std::size_t cellsOffset = sizeof(axom::int64) * (numCoords + 1);
+    std::size_t pos = 0;
+    for(; pos + cellsOffset + 16 <= contents.size(); pos += 8)
+    {
+      axom::int64 sizes[2];
+      std::memcpy(&sizes[0], &contents[pos], 8);
+      std::memcpy(&sizes[1], &contents[pos + cellsOffset], 8);
+      if(sizes[0] == numCoords && sizes[1] == numCellVerts) break;
+    }
+    ASSERT_LT(pos + cellsOffset + 16, contents.size());
+
+    const axom::IndexType badVertex = mesh->getNumberOfNodes();
+    std::memcpy(&contents[pos + cellsOffset + 8],
+                &badVertex,
+                sizeof(badVertex));
+
+    const std::string corruptFile = "quest_inout_octree_corrupt.bin";
+    std::ofstream(corruptFile, std::ios::binary) << contents;
+
+    axom::mint::Mesh* otherMesh = quest::utilities::make_octahedron_mesh();
+    Octree3D otherOctree(bbox, otherMesh);
+    EXPECT_FALSE(otherOctree.loadIndex(corruptFile));
+    EXPECT_EQ(6, otherMesh->getNumberOfNodes());
+    delete otherMesh;
+
+    std::remove(corruptFile.c_str());
+  }
+
+  std::remove(fileName.c_str());
+
+  delete mesh;
+  delete loadedMesh;
+}
+
+#ifdef AXOM_USE_OPENMP
+/**
+ * Returns a latitude-longitude triangle mesh of the unit sphere, with
+ * \a numLat bands of \a numLon cells and outward normals
+ * \note The caller must delete the mesh
+ */
+axom::mint::Mesh* make_sphere_mesh(int numLat, int numLon)
+{
+  using UMesh = axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>;
+  UMesh* triMesh = new UMesh(3, axom::mint::TRIANGLE);
+
+  // The north pole, the rings from north to south and the south pole
+  triMesh->appendNode(0., 0., 1.);
+  for(int i = 1; i < numLat; ++i)
+  {
+    const double theta = M_PI * i / numLat;
+    for(int j = 0; j < numLon; ++j)
+    {
+      const double phi = 2. * M_PI * j / numLon;
+      triMesh->appendNode(std::sin(theta) * std::cos(phi),
+                          std::sin(theta) * std::sin(phi),
+                          std::cos(theta));
+    }
+  }
+  triMesh->appendNode(0., 0., -1.);
+
+  const axom::IndexType southPole = triMesh->getNumberOfNodes() - 1;
+  auto ringVertex = [=](int i, int j) -> axom::IndexType {
+    return 1 + (i - 1) * numLon + (j % numLon);
+  };
+
+  for(int j = 0; j < numLon; ++j)
+  {
+    const axom::IndexType tri[3] = {0, ringVertex(1, j), ringVertex(1, j + 1)};
+    triMesh->appendCell(tri);
+  }
+  for(int i = 1; i < numLat - 1; ++i)
+  {
+    for(int j = 0; j < numLon; ++j)
+    {
+      const axom::IndexType a = ringVertex(i, j);
+      const axom::IndexType b = ringVertex(i, j + 1);
+      const axom::IndexType c = ringVertex(i + 1, j + 1);
+      const axom::IndexType d = ringVertex(i + 1, j);
+
+      const axom::IndexType tri0[3] = {a, d, c};
+      const axom::IndexType tri1[3] = {a, c, b};
+      triMesh->appendCell(tri0);
+      triMesh->appendCell(tri1);
+    }
+  }
+  for(int j = 0; j < numLon; ++j)
+  {
+    const axom::IndexType tri[3] = {ringVertex(numLat - 1, j),
+                                    southPole,
+                                    ringVertex(numLat - 1, j + 1)};
+    triMesh->appendCell(tri);
+  }
+
+  return triMesh;
+}
+
+/// Returns the contents of the file \a fileName
+std::string readFile(const std::string& fileName)
+{
+  std::ifstream ifs(fileName, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(ifs),
+                     std::istreambuf_iterator<char>());
+}
+
+TEST(quest_inout_octree, openmp_matches_serial)
+{
+  SLIC_INFO("*** Checks that an InOutOctree generated with OpenMP threads "
+            << "matches one generated with a single thread.\n");
+
+  namespace quest = axom::quest;
+
+  const std::string serialFile = "quest_inout_octree_serial.bin";
+  const std::string threadedFile = "quest_inout_octree_threaded.bin";
+  GeometricBoundingBox bbox(SpacePt(-1.5), SpacePt(1.5));
+
+  // The saved index holds the blocks of each level along with the leaf data,
+  // including the vertices and cells of the gray leaves
+  const int maxThreads = omp_get_max_threads();
+
+  omp_set_num_threads(1);
+  axom::mint::Mesh* serialMesh = make_sphere_mesh(40, 80);
+  Octree3D serialOctree(bbox, serialMesh);
+  serialOctree.generateIndex();
+  EXPECT_TRUE(serialOctree.saveIndex(serialFile));
+
+  omp_set_num_threads(std::max(maxThreads, 4));
+  axom::mint::Mesh* threadedMesh = make_sphere_mesh(40, 80);
+  Octree3D threadedOctree(bbox, threadedMesh);
+  threadedOctree.generateIndex();
+  EXPECT_TRUE(threadedOctree.saveIndex(threadedFile));
+
+  omp_set_num_threads(maxThreads);
+
+  const std::string serialIndex = readFile(serialFile);
+  EXPECT_FALSE(serialIndex.empty());
+  EXPECT_TRUE(serialIndex == readFile(threadedFile));
+
+  EXPECT_TRUE(threadedOctree.within(SpacePt(0.)));
+  EXPECT_FALSE(threadedOctree.within(SpacePt(1.2)));
+  for(int i = 0; i < 1000; ++i)
+  {
+    SpacePt pt = quest::utilities::randomSpacePt<DIM>(-1.5, 1.5);
+    EXPECT_EQ(serialOctree.within(pt), threadedOctree.within(pt))
+      << "Point " << pt;
+  }
+
+  std::remove(serialFile.c_str());
+  std::remove(threadedFile.c_str());
+
+  delete serialMesh;
+  delete threadedMesh;
+}
+#endif
+
 //----------------------------------------------------------------------
 
 int main(int argc, char* argv[])
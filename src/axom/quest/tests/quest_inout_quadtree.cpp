@@ -197,6 +197,50 @@ TEST(quest_inout_quadtree, circle_mesh)
   }
 }
 
+TEST(quest_inout_quadtree, flat_within)
+{
+  SLIC_INFO("*** Checks the flattened InOutOctree queries in 2D.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+
+  for(int num_segments : {3, 100, 1000})
+  {
+    const double radius = 1.;
+    mint::Mesh* mesh =
+      quest::utilities::make_circle_mesh_2d(radius, num_segments);
+    GeometricBoundingBox bbox = computeBoundingBox(mesh).scale(1.2);
+
+    Octree2D octree(bbox, mesh);
+    octree.generateIndex();
+
+    quest::FlatInOutOctree<DIM> flat(octree);
+    const auto query = flat.getQueryObject();
+
+    for(int i = 0; i < NUM_PT_TESTS; ++i)
+    {
+      SpacePt queryPt = quest::utilities::randomSpacePt<2>(-1.5 * radius,
+                                                           1.5 * radius);
+      EXPECT_EQ(octree.within(queryPt), query.within(queryPt))
+        << "Query point: " << queryPt;
+    }
+
+    // Check the points at and near the vertices of the circle
+    for(int i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+      const SpacePt vert = getVertex(mesh, i);
+      for(double scale : {0.999, 1., 1.001})
+      {
+        const SpacePt queryPt(vert.array() * scale);
+        EXPECT_EQ(octree.within(queryPt), query.within(queryPt))
+          << "Query point: " << queryPt;
+      }
+    }
+
+    delete mesh;
+  }
+}
+
 //----------------------------------------------------------------------
 
 int main(int argc, char* argv[])
@@ -19,6 +19,7 @@
 
 // C/C++ includes
 #include <cmath>
+#include <vector>
 
 // Aliases
 namespace mint = axom::mint;
@@ -577,6 +578,350 @@ TEST(quest_signed_distance, sphere_vec_device_custom_alloc)
 }
 #endif  // defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA)
 
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void run_sorted_queries_test()
+{
+  using PointType = primal::Point<double, 3>;
+  using VectorType = primal::Vector<double, 3>;
+
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+
+  UMesh surface_mesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(&surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  quest::SignedDistance<3, ExecSpace> signed_distance(&surface_mesh, true);
+  EXPECT_FALSE(signed_distance.getSortQueries());
+
+  // Scattered query points, including points on the surface's vertices
+  constexpr int NPTS = 2000;
+  std::vector<PointType> queryPts(NPTS);
+  for(int i = 0; i < NPTS; ++i)
+  {
+    if(i % 100 == 0)
+    {
+      surface_mesh.getNode(i % surface_mesh.getNumberOfNodes(),
+                           queryPts[i].data());
+    }
+    else
+    {
+      queryPts[i] = PointType {axom::utilities::random_real(-1.0, 1.0),
+                               axom::utilities::random_real(-1.0, 1.0),
+                               axom::utilities::random_real(-1.0, 1.0)};
+    }
+  }
+
+  std::vector<double> dist(NPTS);
+  std::vector<PointType> closest(NPTS);
+  std::vector<VectorType> normals(NPTS);
+  signed_distance.computeDistances(NPTS,
+                                   queryPts.data(),
+                                   dist.data(),
+                                   closest.data(),
+                                   normals.data());
+
+  signed_distance.setSortQueries(true);
+  EXPECT_TRUE(signed_distance.getSortQueries());
+
+  std::vector<double> sortedDist(NPTS);
+  std::vector<PointType> sortedClosest(NPTS);
+  std::vector<VectorType> sortedNormals(NPTS);
+  signed_distance.computeDistances(NPTS,
+                                   queryPts.data(),
+                                   sortedDist.data(),
+                                   sortedClosest.data(),
+                                   sortedNormals.data());
+
+  // Sorting only changes the order of the queries
+  for(int i = 0; i < NPTS; ++i)
+  {
+    EXPECT_EQ(sortedDist[i], dist[i]) << "query " << i;
+    EXPECT_EQ(sortedClosest[i], closest[i]) << "query " << i;
+    EXPECT_EQ(sortedNormals[i], normals[i]) << "query " << i;
+  }
+
+  // Single queries are not sorted
+  EXPECT_EQ(signed_distance.computeDistance(queryPts[1]), dist[1]);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, sorted_queries_test)
+{
+  run_sorted_queries_test<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+TEST(quest_signed_distance, sorted_queries_omp_test)
+{
+  run_sorted_queries_test<axom::OMP_EXEC>();
+}
+#endif  // AXOM_USE_OPENMP
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void run_winding_number_test()
+{
+  using PointType = primal::Point<double, 3>;
+
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+
+  UMesh sphere_mesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(&sphere_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  // A copy of the sphere with every 7th triangle removed
+  UMesh cracked_mesh(3, mint::TRIANGLE);
+  PointType node;
+  for(axom::IndexType inode = 0; inode < sphere_mesh.getNumberOfNodes();
+      ++inode)
+  {
+    sphere_mesh.getNode(inode, node.data());
+    cracked_mesh.appendNode(node[0], node[1], node[2]);
+  }
+  for(axom::IndexType icell = 0; icell < sphere_mesh.getNumberOfCells();
+      ++icell)
+  {
+    if(icell % 7 != 3)
+    {
+      cracked_mesh.appendCell(sphere_mesh.getCellNodeIDs(icell));
+    }
+  }
+
+  constexpr int NPTS = 2000;
+  std::vector<PointType> queryPts(NPTS);
+  for(auto& pt : queryPts)
+  {
+    pt = PointType {axom::utilities::random_real(-1.0, 1.0),
+                    axom::utilities::random_real(-1.0, 1.0),
+                    axom::utilities::random_real(-1.0, 1.0)};
+  }
+
+  // On the watertight sphere, both methods agree away from the surface
+  quest::SignedDistance<3, ExecSpace> signed_distance(&sphere_mesh, true);
+  EXPECT_EQ(signed_distance.getSignMethod(), quest::SignMethod::PseudoNormal);
+
+  std::vector<double> pseudoDist(NPTS);
+  signed_distance.computeDistances(NPTS, queryPts.data(), pseudoDist.data());
+
+  signed_distance.setSignMethod(quest::SignMethod::WindingNumber);
+  EXPECT_EQ(signed_distance.getSignMethod(), quest::SignMethod::WindingNumber);
+
+  std::vector<double> windingDist(NPTS);
+  signed_distance.computeDistances(NPTS, queryPts.data(), windingDist.data());
+  for(int i = 0; i < NPTS; ++i)
+  {
+    EXPECT_DOUBLE_EQ(std::abs(windingDist[i]), std::abs(pseudoDist[i]));
+    if(std::abs(pseudoDist[i]) > 1e-3)
+    {
+      EXPECT_EQ(windingDist[i], pseudoDist[i]) << "query " << i;
+    }
+  }
+
+  // Sorted queries compute the same signs
+  signed_distance.setSortQueries(true);
+  std::vector<double> sortedDist(NPTS);
+  signed_distance.computeDistances(NPTS, queryPts.data(), sortedDist.data());
+  for(int i = 0; i < NPTS; ++i)
+  {
+    EXPECT_EQ(sortedDist[i], windingDist[i]) << "query " << i;
+  }
+
+  // Switching back restores the pseudo-normal signs
+  signed_distance.setSortQueries(false);
+  signed_distance.setSignMethod(quest::SignMethod::PseudoNormal);
+  for(int i = 0; i < NPTS; i += 100)
+  {
+    EXPECT_EQ(signed_distance.computeDistance(queryPts[i]), pseudoDist[i]);
+  }
+
+  // On the cracked sphere, the winding number still finds the inside, both
+  // with the default and with a tighter approximation
+  quest::SignedDistance<3, ExecSpace> cracked_distance(&cracked_mesh, false);
+  for(double accuracy : {2.0, 4.0})
+  {
+    cracked_distance.setSignMethod(quest::SignMethod::WindingNumber, accuracy);
+    cracked_distance.computeDistances(NPTS,
+                                      queryPts.data(),
+                                      windingDist.data());
+
+    for(int i = 0; i < NPTS; ++i)
+    {
+      const double radius = std::sqrt(
+        primal::squared_distance(queryPts[i], PointType(SPHERE_CENTER)));
+      if(std::abs(radius - SPHERE_RADIUS) > 0.1)
+      {
+        const bool inside = radius < SPHERE_RADIUS;
+        EXPECT_EQ(windingDist[i] < 0.0, inside)
+          << "query " << i << " at radius " << radius;
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, winding_number_test)
+{
+  run_winding_number_test<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+TEST(quest_signed_distance, winding_number_omp_test)
+{
+  run_winding_number_test<axom::OMP_EXEC>();
+}
+#endif  // AXOM_USE_OPENMP
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks the narrow band distances on the given mesh against the
+ *  clamped distances of all of its nodes.
+ */
+template <typename ExecSpace>
+void check_narrow_band_distances(const UMesh* surface_mesh,
+                                 const mint::StructuredMesh* mesh,
+                                 double band_width)
+{
+  using PointType = primal::Point<double, 3>;
+
+  constexpr bool is_watertight = true;
+  constexpr bool compute_signs = true;
+  quest::SignedDistance<3, ExecSpace> signed_distance(surface_mesh,
+                                                      is_watertight,
+                                                      compute_signs);
+
+  const int nnodes = mesh->getNumberOfNodes();
+  std::vector<PointType> queryPts(nnodes);
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    mesh->getNode(inode, queryPts[inode].data());
+  }
+  std::vector<double> phi_expected(nnodes);
+  signed_distance.computeDistances(nnodes,
+                                   queryPts.data(),
+                                   phi_expected.data());
+
+  std::vector<double> phi_computed(nnodes);
+  const axom::IndexType nband =
+    signed_distance.computeNarrowBandDistances(mesh,
+                                               band_width,
+                                               phi_computed.data());
+  SLIC_INFO("Computed " << nband << " of " << nnodes << " distances");
+  EXPECT_GT(nband, 0);
+  EXPECT_LE(nband, nnodes);
+
+  int num_exact = 0;
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    const double expected =
+      axom::utilities::clampVal(phi_expected[inode], -band_width, band_width);
+    EXPECT_DOUBLE_EQ(phi_computed[inode], expected) << "node " << inode;
+    if(std::fabs(phi_expected[inode]) < band_width)
+    {
+      ++num_exact;
+    }
+  }
+
+  // The band holds every node closer than the band width to the surface
+  EXPECT_GE(nband, num_exact);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void run_narrow_band_sphere_test()
+{
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+
+  UMesh surface_mesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(&surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  SLIC_INFO("Narrow band distances on a uniform mesh...");
+  {
+    constexpr int N = 32;
+    const double lo[3] = {-1.0, -1.0, -1.0};
+    const double hi[3] = {1.0, 1.0, 1.0};
+    mint::UniformMesh umesh(lo, hi, N, N, N);
+    check_narrow_band_distances<ExecSpace>(&surface_mesh, &umesh, 0.15);
+
+    // A zero band width keeps the nodes of the edges crossed by the surface
+    check_narrow_band_distances<ExecSpace>(&surface_mesh, &umesh, 0.0);
+  }
+
+  SLIC_INFO("Narrow band distances on a rectilinear mesh...");
+  {
+    constexpr int N = 24;
+    std::vector<double> x(N), y(N), z(N + 1);
+    for(int i = 0; i < N; ++i)
+    {
+      const double t = -1.0 + 2.0 * i / (N - 1);
+      x[i] = t * std::fabs(t);
+      y[i] = 0.8 * t;
+    }
+    for(int i = 0; i <= N; ++i)
+    {
+      z[i] = -0.7 + 1.3 * i / N;
+    }
+    mint::RectilinearMesh rmesh(N, x.data(), N, y.data(), N + 1, z.data());
+    check_narrow_band_distances<ExecSpace>(&surface_mesh, &rmesh, 0.1);
+  }
+
+  SLIC_INFO("Narrow band distances on a mesh inside the surface...");
+  {
+    constexpr int N = 8;
+    const double lo[3] = {-0.1, -0.1, -0.1};
+    const double hi[3] = {0.1, 0.1, 0.1};
+    mint::UniformMesh umesh(lo, hi, N, N, N);
+
+    // Only the first node is in the band when the surface is far away
+    quest::SignedDistance<3, ExecSpace> signed_distance(&surface_mesh, true);
+    const double band_width = 0.05;
+    std::vector<double> phi(umesh.getNumberOfNodes());
+    EXPECT_EQ(signed_distance.computeNarrowBandDistances(&umesh,
+                                                         band_width,
+                                                         phi.data()),
+              1);
+    for(double value : phi)
+    {
+      EXPECT_EQ(value, -band_width);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, narrow_band_test)
+{
+  run_narrow_band_sphere_test<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+TEST(quest_signed_distance, narrow_band_omp_test)
+{
+  run_narrow_band_sphere_test<axom::OMP_EXEC>();
+}
+#endif  // AXOM_USE_OPENMP
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
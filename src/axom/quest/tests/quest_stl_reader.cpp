@@ -20,6 +20,8 @@
 namespace mint = axom::mint;
 namespace quest = axom::quest;
 
+using TriangleMesh = mint::UnstructuredMesh<mint::SINGLE_SHAPE>;
+
 //------------------------------------------------------------------------------
 // HELPER METHODS
 //------------------------------------------------------------------------------
@@ -50,6 +52,68 @@ void generate_stl_file(const std::string& file)
   ofs.close();
 }
 
+/*!
+ * \brief Generates a binary STL file with the given number of triangles
+ * \param [in] file the name of the file to generate.
+ * \param [in] numTris the number of triangles in the file.
+ *
+ * \note The jth coordinate of the ith vertex is set to 10*i + j
+ * \pre file.empty() == false
+ */
+void generate_binary_stl_file(const std::string& file, axom::uint32 numTris)
+{
+  EXPECT_FALSE(file.empty());
+  EXPECT_TRUE(axom::utilities::isLittleEndian());
+
+  std::ofstream ofs(file.c_str(), std::ios::out | std::ios::binary);
+  EXPECT_TRUE(ofs.is_open());
+
+  const char header[80] = "binary test file";
+  ofs.write(header, 80);
+  ofs.write(reinterpret_cast<const char*>(&numTris), sizeof(numTris));
+
+  const float normal[3] = {0.f, 0.f, 1.f};
+  const axom::uint16 attr = 0;
+  for(axom::uint32 i = 0; i < numTris; ++i)
+  {
+    float verts[9];
+    for(int j = 0; j < 9; ++j)
+    {
+      verts[j] = static_cast<float>(10 * (3 * i + j / 3) + j % 3);
+    }
+    ofs.write(reinterpret_cast<const char*>(normal), sizeof(normal));
+    ofs.write(reinterpret_cast<const char*>(verts), sizeof(verts));
+    ofs.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+  }
+
+  ofs.close();
+}
+
+/*!
+ * \brief Checks that the mesh holds the triangles of generate_binary_stl_file()
+ */
+void check_binary_stl_mesh(const TriangleMesh& mesh, axom::IndexType numTris)
+{
+  EXPECT_EQ(mesh.getNumberOfCells(), numTris);
+  EXPECT_EQ(mesh.getNumberOfNodes(), 3 * numTris);
+
+  const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = mesh.getCoordinateArray(mint::Z_COORDINATE);
+  for(axom::IndexType inode = 0; inode < mesh.getNumberOfNodes(); ++inode)
+  {
+    EXPECT_DOUBLE_EQ(x[inode], 10. * inode);
+    EXPECT_DOUBLE_EQ(y[inode], 10. * inode + 1.);
+    EXPECT_DOUBLE_EQ(z[inode], 10. * inode + 2.);
+  }
+
+  const axom::IndexType* conn = mesh.getCellNodesArray();
+  for(axom::IndexType i = 0; i < 3 * numTris; ++i)
+  {
+    EXPECT_EQ(conn[i], i);
+  }
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -205,6 +269,69 @@ TEST(quest_stl_reader, read_stl_external)
   std::remove(filename.c_str());
 }
 
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, read_binary_stl)
+{
+  constexpr axom::IndexType N_TRIS = 1000;
+  const std::string filename = "binary_triangles.stl";
+
+  // STEP 0: generate a temporary binary STL file for testing
+  generate_binary_stl_file(filename, N_TRIS);
+
+  // STEP 1: read the mesh data and copy it into a mint::Mesh
+  quest::STLReader reader;
+  reader.setFileName(filename);
+  int status = reader.read();
+  EXPECT_EQ(status, 0);
+  EXPECT_EQ(reader.getNumFaces(), N_TRIS);
+  EXPECT_EQ(reader.getNumNodes(), 3 * N_TRIS);
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  reader.getMesh(&mesh);
+  check_binary_stl_mesh(mesh, N_TRIS);
+
+  // STEP 2: read the mesh data directly into a mint::Mesh
+  quest::STLReader direct_reader;
+  direct_reader.setFileName(filename);
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> direct_mesh(3, mint::TRIANGLE);
+  status = direct_reader.readMesh(&direct_mesh);
+  EXPECT_EQ(status, 0);
+  EXPECT_EQ(direct_reader.getNumFaces(), N_TRIS);
+  check_binary_stl_mesh(direct_mesh, N_TRIS);
+
+  // STEP 3: remove temporary STL file
+  std::remove(filename.c_str());
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, read_mesh_ascii)
+{
+  const std::string filename = "triangle.stl";
+
+  // STEP 0: generate a temporary STL file for testing
+  generate_stl_file(filename);
+
+  // STEP 1: read the ascii STL data directly into a mint::Mesh
+  quest::STLReader reader;
+  reader.setFileName(filename);
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  int status = reader.readMesh(&mesh);
+  EXPECT_EQ(status, 0);
+
+  EXPECT_EQ(mesh.getNumberOfCells(), 1);
+  EXPECT_EQ(mesh.getNumberOfNodes(), 3);
+  EXPECT_DOUBLE_EQ(mesh.getCoordinateArray(mint::X_COORDINATE)[1], 1.0);
+  EXPECT_DOUBLE_EQ(mesh.getCoordinateArray(mint::Y_COORDINATE)[2], 1.0);
+
+  // STEP 2: reading a missing file fails
+  quest::STLReader missing_reader;
+  missing_reader.setFileName("foo.stl");
+  EXPECT_TRUE(missing_reader.readMesh(&mesh) != 0);
+
+  // STEP 3: remove temporary STL file
+  std::remove(filename.c_str());
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -11,6 +11,8 @@
 #include "axom/quest/MeshTester.hpp"
 #include "quest_test_utilities.hpp"
 
+#include <random>
+
 namespace
 {
 static const int DIM = 3;
@@ -32,6 +34,105 @@ void insertTriangle(UMesh* mesh, int v1, int v2, int v3)
   mesh->appendCell(indices);
 }
 
+/*!
+ * Creates a soup of triangles over a jittered grid of points in the plane,
+ * in which each triangle has its own copies of its vertices
+ */
+UMesh* make_jittered_triangle_soup(int res, double jitter)
+{
+  UMesh* mesh = new UMesh(DIM, axom::mint::TRIANGLE);
+
+  // use a local generator so that repeated calls create the same mesh
+  std::mt19937_64 gen(7);
+  std::uniform_real_distribution<double> dist(-jitter, jitter);
+  auto vertex = [&](int i, int j) {
+    const double dx = jitter > 0. ? dist(gen) : 0.;
+    const double dy = jitter > 0. ? dist(gen) : 0.;
+    insertVertex(mesh, i + dx, j + dy, (i * j) % 3);
+  };
+
+  for(int i = 0; i < res; ++i)
+  {
+    for(int j = 0; j < res; ++j)
+    {
+      const int v = mesh->getNumberOfNodes();
+      vertex(i, j);
+      vertex(i + 1, j);
+      vertex(i + 1, j + 1);
+      insertTriangle(mesh, v, v + 1, v + 2);
+      vertex(i, j);
+      vertex(i + 1, j + 1);
+      vertex(i, j + 1);
+      insertTriangle(mesh, v + 3, v + 4, v + 5);
+    }
+  }
+
+  // add a degenerate triangle
+  const int v = mesh->getNumberOfNodes();
+  vertex(0, 0);
+  vertex(0, 0);
+  vertex(1, 0);
+  insertTriangle(mesh, v, v + 1, v + 2);
+
+  return mesh;
+}
+
+/*!
+ * Checks that the parallel welding in ExecSpace matches the serial welding
+ */
+template <typename ExecSpace>
+void check_parallel_weld(double eps, double jitter)
+{
+  UMesh* expected = make_jittered_triangle_soup(20, jitter);
+  UMesh* mesh = make_jittered_triangle_soup(20, jitter);
+  const UMesh* orig = make_jittered_triangle_soup(20, jitter);
+  const axom::IndexType numOrigVerts = orig->getNumberOfNodes();
+
+  axom::quest::weldTriMeshVertices(&expected, eps);
+
+  axom::Array<axom::IndexType> vertexMap;
+  axom::quest::weldTriMeshVertices<ExecSpace>(&mesh, eps, vertexMap);
+
+  ASSERT_EQ(expected->getNumberOfNodes(), mesh->getNumberOfNodes());
+  ASSERT_EQ(expected->getNumberOfCells(), mesh->getNumberOfCells());
+  ASSERT_EQ(numOrigVerts, vertexMap.size());
+
+  for(int d = 0; d < DIM; ++d)
+  {
+    const double* exp_coords = expected->getCoordinateArray(d);
+    const double* coords = mesh->getCoordinateArray(d);
+    for(axom::IndexType i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+      EXPECT_EQ(exp_coords[i], coords[i]);
+    }
+  }
+
+  const axom::IndexType numConn = 3 * mesh->getNumberOfCells();
+  const axom::IndexType* exp_conn = expected->getCellNodesArray();
+  const axom::IndexType* conn = mesh->getCellNodesArray();
+  for(axom::IndexType i = 0; i < numConn; ++i)
+  {
+    EXPECT_EQ(exp_conn[i], conn[i]);
+  }
+
+  // welded vertices are within 1.5 * eps of the original ones (max norm)
+  for(axom::IndexType i = 0; i < numOrigVerts; ++i)
+  {
+    const axom::IndexType j = vertexMap[i];
+    ASSERT_TRUE(j >= 0 && j < mesh->getNumberOfNodes());
+    for(int d = 0; d < DIM; ++d)
+    {
+      const double diff = orig->getCoordinateArray(d)[i] -
+        mesh->getCoordinateArray(d)[j];
+      EXPECT_LE(std::abs(diff), 1.5 * eps);
+    }
+  }
+
+  delete expected;
+  delete mesh;
+  delete orig;
+}
+
 }  // namespace
 
 //------------------------------------------------------------------------------
@@ -303,6 +404,37 @@ TEST(quest_vertex_weld, indexedOctahedron)
   mesh = nullptr;
 }
 
+//------------------------------------------------------------------------------
+TEST(quest_vertex_weld, parallelWeldSequential)
+{
+  SLIC_INFO("*** Tests parallel welding function against the serial one");
+
+  check_parallel_weld<axom::SEQ_EXEC>(EPS, 0.);
+  check_parallel_weld<axom::SEQ_EXEC>(1e-3, 1e-4);
+  check_parallel_weld<axom::SEQ_EXEC>(0.1, 0.05);
+
+  // empty mesh
+  UMesh* mesh = new UMesh(DIM, axom::mint::TRIANGLE);
+  axom::Array<axom::IndexType> vertexMap;
+  axom::quest::weldTriMeshVertices<axom::SEQ_EXEC>(&mesh, EPS, vertexMap);
+  EXPECT_EQ(0, mesh->getNumberOfNodes());
+  EXPECT_EQ(0, mesh->getNumberOfCells());
+  EXPECT_EQ(0, vertexMap.size());
+  delete mesh;
+}
+
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+//------------------------------------------------------------------------------
+TEST(quest_vertex_weld, parallelWeldOpenMP)
+{
+  SLIC_INFO("*** Tests OpenMP welding function against the serial one");
+
+  check_parallel_weld<axom::OMP_EXEC>(EPS, 0.);
+  check_parallel_weld<axom::OMP_EXEC>(1e-3, 1e-4);
+  check_parallel_weld<axom::OMP_EXEC>(0.1, 0.05);
+}
+#endif
+
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
 int main(int argc, char* argv[])
@@ -0,0 +1,603 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Associated header file
+#include "BinaryIO.hpp"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#ifdef WIN32
+  #include <iterator>  // for std::istreambuf_iterator
+#else
+  #include <fcntl.h>     // for open
+  #include <sys/mman.h>  // for mmap, munmap
+  #include <sys/stat.h>  // for fstat
+  #include <unistd.h>    // for close
+#endif
+
+namespace
+{
+using axom::sidre::Node;
+using axom::sidre::Schema;
+
+const char MAGIC[8] = {'S', 'I', 'D', 'R', 'E', 'B', 'I', 'N'};
+const std::uint32_t VERSION = 1;
+const std::uint32_t CODEC_NONE = 0;
+const std::uint32_t CODEC_LZ4 = 1;
+
+// magic, version, codec, schema size, data size, block size, number of blocks
+const std::size_t HEADER_SIZE = 48;
+const std::size_t LEAF_ALIGNMENT = 8;
+const std::size_t BLOCK_ALIGNMENT = 64;
+
+// Parameters of the LZ4 block format
+const std::size_t MIN_MATCH = 4;
+const std::size_t LAST_LITERALS = 5;
+const std::size_t MF_LIMIT = 12;
+const std::size_t MAX_OFFSET = 65535;
+const int HASH_BITS = 16;
+const std::size_t NO_POSITION = std::numeric_limits<std::size_t>::max();
+
+std::size_t alignUp(std::size_t value, std::size_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/// Appends an unsigned integer in little-endian byte order
+void putUInt(std::vector<char>& out, std::uint64_t value, int num_bytes)
+{
+  for(int i = 0; i < num_bytes; ++i)
+  {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+/// Reads an unsigned integer in little-endian byte order
+std::uint64_t getUInt(const char* in, int num_bytes)
+{
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+  std::uint64_t value = 0;
+  for(int i = 0; i < num_bytes; ++i)
+  {
+    value |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+  }
+  return value;
+}
+
+/*!
+ * \brief Describes the given Node in schema, with the data of each leaf
+ *  at an aligned offset of the data stream.
+ */
+void layoutSchema(const Node& node, Schema& schema, std::size_t& offset)
+{
+  const conduit::DataType& dtype = node.dtype();
+  if(dtype.is_object() || dtype.is_list())
+  {
+    schema.set(dtype.is_object() ? conduit::DataType::object()
+                                 : conduit::DataType::list());
+    conduit::NodeConstIterator itr = node.children();
+    while(itr.has_next())
+    {
+      const Node& child = itr.next();
+      Schema& child_schema =
+        dtype.is_object() ? schema[itr.name()] : schema.append();
+      layoutSchema(child, child_schema, offset);
+    }
+  }
+  else if(dtype.is_empty())
+  {
+    schema.set(conduit::DataType::empty());
+  }
+  else
+  {
+    offset = alignUp(offset, LEAF_ALIGNMENT);
+    schema.set(conduit::DataType(dtype.id(),
+                                 dtype.number_of_elements(),
+                                 offset,
+                                 dtype.element_bytes(),
+                                 dtype.element_bytes(),
+                                 dtype.endianness()));
+    offset += dtype.number_of_elements() * dtype.element_bytes();
+  }
+}
+
+/// Copies the leaves of node to the offsets given by layoutSchema()
+void copyLeaves(const Node& node, const Schema& schema, char* data)
+{
+  const conduit::DataType& dtype = node.dtype();
+  if(dtype.is_object() || dtype.is_list())
+  {
+    for(conduit::index_t i = 0; i < node.number_of_children(); ++i)
+    {
+      copyLeaves(node.child(i), schema.child(i), data);
+    }
+  }
+  else if(!dtype.is_empty() && dtype.number_of_elements() > 0)
+  {
+    node.compact_elements_to(
+      reinterpret_cast<conduit::uint8*>(data + schema.dtype().offset()));
+  }
+}
+
+/// Returns whether the leaves described by schema fit in data_size bytes
+bool fitsInData(const Schema& schema, std::uint64_t data_size)
+{
+  const conduit::DataType& dtype = schema.dtype();
+  if(dtype.is_object() || dtype.is_list())
+  {
+    for(conduit::index_t i = 0; i < schema.number_of_children(); ++i)
+    {
+      if(!fitsInData(schema.child(i), data_size))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  if(dtype.is_empty() || dtype.number_of_elements() == 0)
+  {
+    return true;
+  }
+  return dtype.offset() >= 0 && dtype.stride() == dtype.element_bytes() &&
+    static_cast<std::uint64_t>(dtype.offset() + dtype.strided_bytes()) <=
+    data_size;
+}
+
+std::uint32_t read32(const char* in)
+{
+  std::uint32_t value;
+  std::memcpy(&value, in, sizeof(value));
+  return value;
+}
+
+std::uint32_t hash4(std::uint32_t sequence)
+{
+  return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/// Appends the part of an LZ4 length that does not fit in the token
+void putLength(std::vector<char>& dst, std::size_t length)
+{
+  for(; length >= 255; length -= 255)
+  {
+    dst.push_back(static_cast<char>(255));
+  }
+  dst.push_back(static_cast<char>(length));
+}
+
+/// Reads the part of an LZ4 length that does not fit in the token
+bool getLength(const unsigned char* src,
+               std::size_t src_size,
+               std::size_t& pos,
+               std::size_t& length)
+{
+  unsigned char byte = 255;
+  while(byte == 255)
+  {
+    if(pos >= src_size)
+    {
+      return false;
+    }
+    byte = src[pos++];
+    length += byte;
+  }
+  return true;
+}
+
+/// Appends an LZ4 sequence of literals, followed by a match if match_length > 0
+void putSequence(std::vector<char>& dst,
+                 const char* literals,
+                 std::size_t num_literals,
+                 std::size_t offset,
+                 std::size_t match_length)
+{
+  const std::size_t extra_match =
+    match_length > 0 ? match_length - MIN_MATCH : 0;
+  const std::size_t literal_token = std::min<std::size_t>(num_literals, 15);
+  const std::size_t match_token = std::min<std::size_t>(extra_match, 15);
+  dst.push_back(static_cast<char>((literal_token << 4) | match_token));
+  if(num_literals >= 15)
+  {
+    putLength(dst, num_literals - 15);
+  }
+  dst.insert(dst.end(), literals, literals + num_literals);
+
+  if(match_length > 0)
+  {
+    putUInt(dst, offset, 2);
+    if(extra_match >= 15)
+    {
+      putLength(dst, extra_match - 15);
+    }
+  }
+}
+
+}  // end anonymous namespace
+
+namespace axom
+{
+namespace sidre
+{
+namespace binary_io
+{
+/*
+ *************************************************************************
+ *
+ * Compress a block with a greedy LZ4 block encoder.
+ *
+ *************************************************************************
+ */
+void compressBlock(const char* src,
+                   std::size_t src_size,
+                   std::vector<char>& dst)
+{
+  dst.clear();
+  dst.reserve(src_size + src_size / 255 + 16);
+
+  std::size_t anchor = 0;
+  if(src_size > MF_LIMIT)
+  {
+    std::vector<std::size_t> table(std::size_t(1) << HASH_BITS, NO_POSITION);
+
+    // The last match starts MF_LIMIT bytes before the end and leaves the
+    // last LAST_LITERALS bytes as literals
+    const std::size_t match_start_limit = src_size - MF_LIMIT;
+    const std::size_t match_end_limit = src_size - LAST_LITERALS;
+
+    std::size_t pos = 0;
+    std::size_t misses = 0;
+    while(pos < match_start_limit)
+    {
+      const std::uint32_t sequence = read32(src + pos);
+      const std::uint32_t hash = hash4(sequence);
+      const std::size_t ref = table[hash];
+      table[hash] = pos;
+
+      if(ref != NO_POSITION && pos - ref <= MAX_OFFSET &&
+         read32(src + ref) == sequence)
+      {
+        std::size_t length = MIN_MATCH;
+        while(pos + length < match_end_limit &&
+              src[ref + length] == src[pos + length])
+        {
+          ++length;
+        }
+
+        putSequence(dst, src + anchor, pos - anchor, pos - ref, length);
+        pos += length;
+        anchor = pos;
+        misses = 0;
+      }
+      else
+      {
+        // Skip faster through data that does not compress
+        pos += 1 + (misses++ >> 6);
+      }
+    }
+  }
+
+  putSequence(dst, src + anchor, src_size - anchor, 0, 0);
+}
+
+/*
+ *************************************************************************
+ *
+ * Decompress an LZ4 block, checking all bounds.
+ *
+ *************************************************************************
+ */
+bool decompressBlock(const char* src,
+                     std::size_t src_size,
+                     char* dst,
+                     std::size_t dst_size)
+{
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(src);
+  std::size_t in_pos = 0;
+  std::size_t out_pos = 0;
+  while(in_pos < src_size)
+  {
+    const unsigned token = in[in_pos++];
+
+    std::size_t num_literals = token >> 4;
+    if(num_literals == 15 && !getLength(in, src_size, in_pos, num_literals))
+    {
+      return false;
+    }
+    if(num_literals > src_size - in_pos || num_literals > dst_size - out_pos)
+    {
+      return false;
+    }
+    std::memcpy(dst + out_pos, src + in_pos, num_literals);
+    in_pos += num_literals;
+    out_pos += num_literals;
+
+    // The last sequence only holds literals
+    if(in_pos == src_size)
+    {
+      break;
+    }
+
+    if(src_size - in_pos < 2)
+    {
+      return false;
+    }
+    const std::size_t offset = getUInt(src + in_pos, 2);
+    in_pos += 2;
+    if(offset == 0 || offset > out_pos)
+    {
+      return false;
+    }
+
+    std::size_t length = token & 15;
+    if(length == 15 && !getLength(in, src_size, in_pos, length))
+    {
+      return false;
+    }
+    length += MIN_MATCH;
+    if(length > dst_size - out_pos)
+    {
+      return false;
+    }
+
+    // Matches may overlap their own output
+    char* out = dst + out_pos;
+    const char* match = out - offset;
+    if(offset >= length)
+    {
+      std::memcpy(out, match, length);
+    }
+    else
+    {
+      for(std::size_t i = 0; i < length; ++i)
+      {
+        out[i] = match[i];
+      }
+    }
+    out_pos += length;
+  }
+
+  return out_pos == dst_size;
+}
+
+/*
+ *************************************************************************
+ *
+ * Write a Node to a sidre_bin file.
+ *
+ *************************************************************************
+ */
+bool save(const Node& node, const std::string& path, bool compress)
+{
+  Schema schema;
+  std::size_t data_size = 0;
+  layoutSchema(node, schema, data_size);
+
+  std::vector<char> data(data_size);
+  copyLeaves(node, schema, data.data());
+
+  const std::string schema_json = schema.to_json();
+
+  const std::size_t num_blocks = (data_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  std::vector<std::vector<char>> compressed(compress ? num_blocks : 0);
+  std::vector<std::size_t> stored_sizes(num_blocks);
+  for(std::size_t b = 0; b < num_blocks; ++b)
+  {
+    const std::size_t raw_size =
+      std::min(BLOCK_SIZE, data_size - b * BLOCK_SIZE);
+    stored_sizes[b] = raw_size;
+    if(compress)
+    {
+      compressBlock(data.data() + b * BLOCK_SIZE, raw_size, compressed[b]);
+      if(compressed[b].size() < raw_size)
+      {
+        stored_sizes[b] = compressed[b].size();
+      }
+    }
+  }
+
+  std::vector<char> header(MAGIC, MAGIC + sizeof(MAGIC));
+  putUInt(header, VERSION, 4);
+  putUInt(header, compress ? CODEC_LZ4 : CODEC_NONE, 4);
+  putUInt(header, schema_json.size(), 8);
+  putUInt(header, data_size, 8);
+  putUInt(header, BLOCK_SIZE, 8);
+  putUInt(header, num_blocks, 8);
+  header.insert(header.end(), schema_json.begin(), schema_json.end());
+  for(std::size_t stored_size : stored_sizes)
+  {
+    putUInt(header, stored_size, 8);
+  }
+
+  std::ofstream ofs(path.c_str(), std::ios::out | std::ios::binary);
+  if(!ofs.is_open())
+  {
+    return false;
+  }
+  ofs.write(header.data(), header.size());
+
+  const char padding[BLOCK_ALIGNMENT] = {};
+  std::size_t pos = header.size();
+  for(std::size_t b = 0; b < num_blocks; ++b)
+  {
+    const std::size_t block_pos = alignUp(pos, BLOCK_ALIGNMENT);
+    ofs.write(padding, block_pos - pos);
+
+    const bool is_raw = !compress || compressed[b].size() >= stored_sizes[b];
+    const char* block =
+      is_raw ? data.data() + b * BLOCK_SIZE : compressed[b].data();
+    ofs.write(block, stored_sizes[b]);
+    pos = block_pos + stored_sizes[b];
+  }
+
+  return ofs.good();
+}
+
+bool isBinaryFile(const std::string& path)
+{
+  std::ifstream ifs(path.c_str(), std::ios::in | std::ios::binary);
+  char magic[sizeof(MAGIC)];
+  return ifs.read(magic, sizeof(magic)) &&
+    std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+/*
+ *************************************************************************
+ *
+ * Map a sidre_bin file and describe its data with a Node.
+ *
+ *************************************************************************
+ */
+bool Reader::open(const std::string& path)
+{
+  close();
+
+#ifdef WIN32
+  std::ifstream ifs(path.c_str(), std::ios::in | std::ios::binary);
+  if(!ifs.is_open())
+  {
+    return false;
+  }
+  m_buffer.assign(std::istreambuf_iterator<char>(ifs),
+                  std::istreambuf_iterator<char>());
+  m_data = m_buffer.data();
+  m_size = m_buffer.size();
+#else
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    return false;
+  }
+
+  struct stat sb;
+  if(fstat(fd, &sb) != 0 || sb.st_size == 0)
+  {
+    ::close(fd);
+    return false;
+  }
+
+  const std::size_t file_size = static_cast<std::size_t>(sb.st_size);
+  void* addr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);  // the mapping remains valid after closing the descriptor
+  if(addr == MAP_FAILED)
+  {
+    return false;
+  }
+  m_data = static_cast<const char*>(addr);
+  m_size = file_size;
+#endif
+
+  if(m_size < HEADER_SIZE || std::memcmp(m_data, MAGIC, sizeof(MAGIC)) != 0 ||
+     getUInt(m_data + 8, 4) != VERSION || getUInt(m_data + 12, 4) > CODEC_LZ4)
+  {
+    close();
+    return false;
+  }
+
+  const std::uint64_t schema_size = getUInt(m_data + 16, 8);
+  const std::uint64_t data_size = getUInt(m_data + 24, 8);
+  const std::uint64_t block_size = getUInt(m_data + 32, 8);
+  const std::uint64_t num_blocks = getUInt(m_data + 40, 8);
+  const bool valid_blocks = block_size > 0 &&
+    block_size % BLOCK_ALIGNMENT == 0 &&
+    num_blocks == data_size / block_size + (data_size % block_size != 0);
+
+  // The schema and the block table must fit in the file after the header
+  if(!valid_blocks || schema_size > m_size - HEADER_SIZE ||
+     num_blocks > (m_size - HEADER_SIZE - schema_size) / 8)
+  {
+    close();
+    return false;
+  }
+
+  const char* table = m_data + HEADER_SIZE + schema_size;
+  std::vector<std::size_t> block_positions(num_blocks);
+  bool is_raw = true;
+  std::size_t pos = (table - m_data) + num_blocks * 8;
+  for(std::size_t b = 0; b < num_blocks; ++b)
+  {
+    const std::size_t raw_size =
+      std::min<std::size_t>(block_size, data_size - b * block_size);
+    const std::size_t stored_size = getUInt(table + 8 * b, 8);
+    pos = alignUp(pos, BLOCK_ALIGNMENT);
+
+    // Each block must lie in the file, and an LZ4 block decompresses to
+    // less than 256 times its size
+    if(stored_size > raw_size || raw_size / 256 > stored_size || pos > m_size ||
+       stored_size > m_size - pos)
+    {
+      close();
+      return false;
+    }
+    is_raw = is_raw && stored_size == raw_size;
+    block_positions[b] = pos;
+    pos += stored_size;
+  }
+
+  Schema schema(std::string(m_data + HEADER_SIZE, schema_size));
+  if(!fitsInData(schema, data_size))
+  {
+    close();
+    return false;
+  }
+
+  // Raw blocks are contiguous, since the block size is aligned
+  const char* stream = nullptr;
+  if(is_raw)
+  {
+    stream = num_blocks > 0 ? m_data + block_positions[0] : nullptr;
+    m_is_zero_copy = true;
+  }
+  else
+  {
+    m_decompressed.resize(data_size);
+    for(std::size_t b = 0; b < num_blocks; ++b)
+    {
+      const std::size_t raw_size =
+        std::min<std::size_t>(block_size, data_size - b * block_size);
+      const std::size_t stored_size = getUInt(table + 8 * b, 8);
+      char* out = m_decompressed.data() + b * block_size;
+      const char* in = m_data + block_positions[b];
+      if(stored_size == raw_size)
+      {
+        std::memcpy(out, in, raw_size);
+      }
+      else if(!decompressBlock(in, stored_size, out, raw_size))
+      {
+        close();
+        return false;
+      }
+    }
+    stream = m_decompressed.data();
+  }
+
+  m_node.set_external(schema, const_cast<char*>(stream));
+  return true;
+}
+
+void Reader::close()
+{
+  m_node.reset();
+  m_decompressed.clear();
+  m_is_zero_copy = false;
+#ifdef WIN32
+  m_buffer.clear();
+#else
+  if(m_data != nullptr)
+  {
+    munmap(const_cast<char*>(m_data), m_size);
+  }
+#endif
+  m_data = nullptr;
+  m_size = 0;
+}
+
+} /* end namespace binary_io */
+} /* end namespace sidre */
+} /* end namespace axom */
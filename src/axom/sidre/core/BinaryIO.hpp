@@ -0,0 +1,148 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ ******************************************************************************
+ *
+ * \file BinaryIO.hpp
+ *
+ * \brief   Functions that read and write Conduit Nodes in the binary format
+ *          of the sidre_bin and sidre_bin_lz4 protocols.
+ *
+ ******************************************************************************
+ */
+
+#ifndef SIDRE_BINARYIO_HPP_
+#define SIDRE_BINARYIO_HPP_
+
+// Standard C++ headers
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Sidre project headers
+#include "SidreTypes.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+/*!
+ * \brief Functions for the binary file format of the sidre_bin protocols.
+ *
+ * A file starts with a fixed-size header, followed by the JSON schema of
+ * the Node and a table holding the stored size of each data block. The data
+ * of the Node's leaves is laid out in a single stream, with each leaf aligned
+ * to 8 bytes, and the stream is split into blocks of BLOCK_SIZE bytes. Each
+ * block starts at a 64-byte aligned offset in the file and is stored either
+ * raw or compressed with an LZ4 block codec, whichever is smaller.
+ *
+ * When no block is compressed, the data stream is contiguous in the file, and
+ * the Node loaded by Reader refers directly to the memory-mapped file.
+ *
+ * \note Files are read on machines with the byte order of the writer.
+ */
+namespace binary_io
+{
+/// Number of bytes of the data stream in each block
+constexpr std::size_t BLOCK_SIZE = std::size_t(1) << 20;
+
+/*!
+ * \brief Writes the given Node to a file in the sidre_bin format.
+ *
+ * \param node      Node to write
+ * \param path      file path
+ * \param compress  Whether to compress the data blocks
+ *
+ * \return True if the file was written, false otherwise.
+ */
+bool save(const Node& node, const std::string& path, bool compress);
+
+/*!
+ * \brief Returns whether the given file starts with the sidre_bin header.
+ */
+bool isBinaryFile(const std::string& path);
+
+/*!
+ * \brief Compresses a block of bytes with an LZ4 block codec.
+ *
+ * \param src       bytes to compress
+ * \param src_size  number of bytes to compress
+ * \param dst       output, resized to the compressed bytes
+ */
+void compressBlock(const char* src,
+                   std::size_t src_size,
+                   std::vector<char>& dst);
+
+/*!
+ * \brief Decompresses a block written by compressBlock().
+ *
+ * \param src       compressed bytes
+ * \param src_size  number of compressed bytes
+ * \param dst       output, with room for exactly dst_size bytes
+ * \param dst_size  number of decompressed bytes
+ *
+ * \return True if the block is valid and decompresses to dst_size bytes.
+ */
+bool decompressBlock(const char* src,
+                     std::size_t src_size,
+                     char* dst,
+                     std::size_t dst_size);
+
+/*!
+ * \class Reader
+ *
+ * \brief Reader gives access to a Node stored in a sidre_bin file.
+ *
+ * The file is memory-mapped where supported. The data of an uncompressed
+ * file is not copied: the Node refers to the mapped file, which stays
+ * mapped until the Reader is closed or destroyed. Compressed blocks are
+ * decompressed into memory owned by the Reader.
+ */
+class Reader
+{
+public:
+  Reader() = default;
+  ~Reader() { close(); }
+
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+
+  /*!
+   * \brief Opens the given file.
+   *
+   * \return False if the file cannot be read or is not a valid sidre_bin
+   *  file.
+   */
+  bool open(const std::string& path);
+
+  /// Releases the file and the Node
+  void close();
+
+  /*!
+   * \brief Returns the Node held by the file.
+   *
+   * The data of the Node must not be modified, and is only valid until the
+   * Reader is closed.
+   */
+  Node& node() { return m_node; }
+
+  /// Returns whether the data of the Node refers directly to the file
+  bool isZeroCopy() const { return m_is_zero_copy; }
+
+private:
+  const char* m_data {nullptr};
+  std::size_t m_size {0};
+  std::vector<char> m_buffer;  // file contents, if not memory-mapped
+  std::vector<char> m_decompressed;
+  Node m_node;
+  bool m_is_zero_copy {false};
+};
+
+} /* end namespace binary_io */
+} /* end namespace sidre */
+} /* end namespace axom */
+
+#endif /* SIDRE_BINARYIO_HPP_ */
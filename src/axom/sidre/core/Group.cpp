@@ -18,6 +18,7 @@
 // Sidre headers
 #include "ListCollection.hpp"
 #include "MapCollection.hpp"
+#include "BinaryIO.hpp"
 #include "Buffer.hpp"
 #include "DataStore.hpp"
 
@@ -1461,55 +1462,71 @@ void Group::save(const std::string& path,
                  const std::string& protocol,
                  const Attribute* attr) const
 {
-  const DataStore* ds = getDataStore();
-
-  if(protocol == "sidre_hdf5")
+  if(protocol == "sidre_bin" || protocol == "sidre_bin_lz4")
   {
     Node n;
-    exportTo(n["sidre"], attr);
-    ds->saveAttributeLayout(n["sidre/attribute"]);
-    createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
-    conduit::relay::io::save(n, path, "hdf5");
+    createSaveLayout(n, protocol, attr);
+    bool is_saved = binary_io::save(n, path, protocol == "sidre_bin_lz4");
+    SLIC_WARNING_IF(!is_saved,
+                    SIDRE_GROUP_LOG_PREPEND << "Unable to save to file '"
+                                            << path << "'.");
+    return;
   }
-  else if(protocol == "sidre_conduit_json")
+
+  std::string relay_protocol;
+  if(protocol == "sidre_hdf5" || protocol == "conduit_hdf5")
   {
-    Node n;
-    exportTo(n["sidre"], attr);
-    ds->saveAttributeLayout(n["sidre/attribute"]);
-    createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
-    conduit::relay::io::save(n, path, "conduit_json");
+    relay_protocol = "hdf5";
   }
-  else if(protocol == "sidre_json")
+  else if(protocol == "sidre_conduit_json")
   {
-    Node n;
-    exportTo(n["sidre"], attr);
-    ds->saveAttributeLayout(n["sidre/attribute"]);
-    createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
-    conduit::relay::io::save(n, path, "json");
+    relay_protocol = "conduit_json";
   }
-  else if(protocol == "conduit_hdf5")
+  else if(protocol == "sidre_json")
   {
-    Node n;
-    createNativeLayout(n, attr);
-    n["sidre_group_name"] = m_name;
-    conduit::relay::io::save(n, path, "hdf5");
+    relay_protocol = "json";
   }
   else if(protocol == "conduit_bin" || protocol == "conduit_json" ||
           protocol == "json")
   {
-    Node n;
-    createNativeLayout(n, attr);
-    n["sidre_group_name"] = m_name;
-    conduit::relay::io::save(n, path, protocol);
+    relay_protocol = protocol;
   }
   else
   {
     SLIC_ERROR(SIDRE_GROUP_LOG_PREPEND << "Invalid protocol '" << protocol
                                        << "' for file save.");
+    return;
+  }
+
+  Node n;
+  createSaveLayout(n, protocol, attr);
+  conduit::relay::io::save(n, path, relay_protocol);
+}
+
+/*
+ *************************************************************************
+ *
+ * Copy the layout written by save() to a Conduit node
+ *
+ *************************************************************************
+ */
+void Group::createSaveLayout(Node& n,
+                             const std::string& protocol,
+                             const Attribute* attr) const
+{
+  if(protocol == "sidre_hdf5" || protocol == "sidre_conduit_json" ||
+     protocol == "sidre_json" || protocol == "sidre_bin" ||
+     protocol == "sidre_bin_lz4")
+  {
+    exportTo(n["sidre"], attr);
+    getDataStore()->saveAttributeLayout(n["sidre/attribute"]);
+    createExternalLayout(n["sidre/external"], attr);
+  }
+  else
+  {
+    createNativeLayout(n, attr);
   }
+  n["sidre_group_name"] = m_name;
 }
 
 /*************************************************************************/
@@ -1576,6 +1593,27 @@ void Group::load(const std::string& path,
       name_from_file = n["sidre_group_name"].as_string();
     }
   }
+  else if(protocol == "sidre_bin" || protocol == "sidre_bin_lz4")
+  {
+    // The data of uncompressed files is imported from the mapped file
+    binary_io::Reader reader;
+    if(!reader.open(path))
+    {
+      SLIC_WARNING(SIDRE_GROUP_LOG_PREPEND
+                   << "Unable to load '" << path << "' as a sidre_bin file.");
+      return;
+    }
+    Node& n = reader.node();
+    SLIC_ASSERT_MSG(n.has_path("sidre"),
+                    SIDRE_GROUP_LOG_PREPEND
+                      << "Conduit Node " << n.path() << " does not have sidre "
+                      << "data for Group " << getPathName() << ".");
+    importFrom(n["sidre"], preserve_contents);
+    if(n.has_path("sidre_group_name"))
+    {
+      name_from_file = n["sidre_group_name"].as_string();
+    }
+  }
   else if(protocol == "conduit_hdf5")
   {
     Node n;
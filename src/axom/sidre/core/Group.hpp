@@ -1182,6 +1182,23 @@ public:
    */
   bool createExternalLayout(Node& n, const Attribute* attr = nullptr) const;
 
+  /*!
+   * \brief Copy the layout that save() writes to a file for the given
+   *  protocol to the given Conduit node.
+   *
+   * For the sidre_{zzz} protocols, this holds the Group hierarchy, the
+   * Buffers used by its Views and the external layout. For the other
+   * protocols, it is the native layout. As with createNativeLayout(), the
+   * data of the Node refers to the data held by the Views.
+   *
+   * \param n         Conduit node to fill
+   * \param protocol  I/O protocol, as in save()
+   * \param attr      Only include Views that have Attribute set.
+   */
+  void createSaveLayout(Node& n,
+                        const std::string& protocol,
+                        const Attribute* attr = nullptr) const;
+
   /*!
    * \brief Return true if this Group is equivalent to given Group; else false.
    *
@@ -1218,6 +1235,8 @@ public:
  *    sidre_hdf5 (default when Axom is configured with hdf5)
  *    sidre_conduit_json (default otherwise)
  *    sidre_json
+ *    sidre_bin
+ *    sidre_bin_lz4
  *
  *    conduit_hdf5
  *    conduit_bin
@@ -1227,6 +1246,12 @@ public:
  *   \note The sidre_hdf5 and conduit_hdf5 protocols are only available
  *   when Axom is configured with hdf5.
  *
+ *   The sidre_bin protocols write a single binary file holding the schema of
+ *   the tree and the raw data of its Buffers, which sidre_bin_lz4 compresses
+ *   in blocks. Loading maps the file into memory, so that the data of
+ *   uncompressed files is copied directly from the file into the Buffers.
+ *   \see binary_io
+ *
  *   There are two overloaded versions for each of save, load, and
  *   loadExternalData.  The first of each takes a file path and is intended
  *   for use in a serial context and can be called directly using any
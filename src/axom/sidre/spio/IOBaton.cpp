@@ -80,6 +80,28 @@ IOBaton::IOBaton(MPI_Comm comm, int num_files, int num_groups)
   }
 }
 
+/*
+ *************************************************************************
+ *
+ * Set id of a rank, matching the sets assigned by the constructor.
+ *
+ *************************************************************************
+ */
+int IOBaton::getSetIdForRank(int rank, int num_files, int num_ranks)
+{
+  SLIC_ASSERT(num_files > 0);
+  SLIC_ASSERT(rank >= 0 && rank < num_ranks);
+
+  const int num_larger_sets = num_ranks % num_files;
+  const int set_size = num_ranks / num_files;
+  const int first_regular_set_rank = (set_size + 1) * num_larger_sets;
+  if(rank < first_regular_set_rank)
+  {
+    return rank / (set_size + 1);
+  }
+  return num_larger_sets + (rank - first_regular_set_rank) / set_size;
+}
+
 /*
  *************************************************************************
  *
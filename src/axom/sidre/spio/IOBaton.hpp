@@ -95,6 +95,26 @@ public:
    */
   int getNumFiles() const { return m_num_files; }
 
+  /*!
+   * \brief Get the id of the set of ranks sharing a file with the local rank.
+   *
+   * This is the value returned by wait().
+   */
+  int getSetId() const { return m_set_id; }
+
+  /*!
+   * \brief Get the id of the set that a rank joins when num_ranks ranks
+   *  share num_files files.
+   *
+   * This is the set id that wait() returns on that rank, so it identifies
+   * the file written by each rank of an earlier job.
+   *
+   * \param rank       rank whose set id is computed
+   * \param num_files  Number of files involved in the I/O operation
+   * \param num_ranks  Number of ranks providing data
+   */
+  static int getSetIdForRank(int rank, int num_files, int num_ranks);
+
 private:
   DISABLE_COPY_AND_ASSIGNMENT(IOBaton);
 
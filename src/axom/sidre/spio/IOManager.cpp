@@ -13,6 +13,7 @@
 #include "axom/core/utilities/StringUtilities.hpp"
 
 // SiDRe project headers
+#include "axom/sidre/core/BinaryIO.hpp"
 #include "axom/sidre/core/Buffer.hpp"
 #include "axom/sidre/core/Group.hpp"
 #include "axom/sidre/core/DataStore.hpp"
@@ -32,6 +33,12 @@
   #include "scr.h"
 #endif
 
+// C/C++ headers
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <utility>
+
 namespace
 {
 /*!
@@ -82,6 +89,9 @@ IOManager::IOManager(MPI_Comm comm, bool use_scr)
   , m_baton(nullptr)
   , m_mpi_comm(comm)
   , m_use_scr(use_scr)
+  , m_write_behind(false)
+  , m_write_behind_comm(MPI_COMM_NULL)
+  , m_write_behind_failed(false)
 {
   MPI_Comm_size(comm, &m_comm_size);
   MPI_Comm_rank(comm, &m_my_rank);
@@ -105,10 +115,22 @@ IOManager::IOManager(MPI_Comm comm, bool use_scr)
  */
 IOManager::~IOManager()
 {
+  finishWriteBehind();
+
   if(m_baton)
   {
     delete m_baton;
   }
+
+  if(m_write_behind_comm != MPI_COMM_NULL)
+  {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if(!finalized)
+    {
+      MPI_Comm_free(&m_write_behind_comm);
+    }
+  }
 }
 
 /*
@@ -135,6 +157,11 @@ std::string IOManager::correspondingRelayProtocol(const std::string& sidre_proto
   {
     return "json";
   }
+  else if(sidre_protocol == "sidre_bin" || sidre_protocol == "sidre_bin_lz4")
+  {
+    // Only the data files are binary, the root file is json
+    return "json";
+  }
   else if(sidre_protocol == "sidre_conduit_json" ||
           sidre_protocol == "conduit_json")
   {
@@ -158,6 +185,8 @@ void IOManager::write(sidre::Group* datagroup,
                       const std::string& protocol,
                       const std::string& tree_pattern)
 {
+  finishWriteBehind();
+
   if(m_baton)
   {
     if(m_baton->getNumFiles() != num_files)
@@ -188,6 +217,12 @@ void IOManager::write(sidre::Group* datagroup,
 
   std::string root_name = output_base + ".root";
 
+  if(m_write_behind && canWriteBehind(num_files))
+  {
+    startWriteBehind(datagroup, num_files, file_base, root_name, protocol);
+    return;
+  }
+
   if(protocol == "sidre_hdf5")
   {
 #ifdef AXOM_USE_HDF5
@@ -260,6 +295,241 @@ void IOManager::write(sidre::Group* datagroup,
   MPI_Barrier(m_mpi_comm);
 }
 
+/*
+ *************************************************************************
+ *
+ * Enable or disable write-behind mode.
+ *
+ *************************************************************************
+ */
+void IOManager::setWriteBehind(bool write_behind)
+{
+  if(!write_behind)
+  {
+    finishWriteBehind();
+  }
+  m_write_behind = write_behind;
+
+  int thread_level = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&thread_level);
+  SLIC_WARNING_IF(
+    m_write_behind && thread_level != MPI_THREAD_MULTIPLE,
+    "IOManager write-behind mode requires MPI_THREAD_MULTIPLE when "
+      << "writing fewer files than ranks. Those writes will be blocking.");
+}
+
+/*
+ *************************************************************************
+ *
+ * Wait for the write-behind files of all ranks.
+ *
+ *************************************************************************
+ */
+bool IOManager::waitForCompletion()
+{
+  const bool is_written = finishWriteBehind();
+  MPI_Barrier(m_mpi_comm);
+  return is_written;
+}
+
+bool IOManager::canWriteBehind(int num_files) const
+{
+  if(m_use_scr)
+  {
+    return false;
+  }
+
+  // With a file per rank, the IOBaton does not communicate
+  if(num_files == m_comm_size)
+  {
+    return true;
+  }
+
+  int thread_level = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&thread_level);
+  return thread_level == MPI_THREAD_MULTIPLE;
+}
+
+void IOManager::startWriteBehind(sidre::Group* datagroup,
+                                 int num_files,
+                                 const std::string& file_base,
+                                 const std::string& root_name,
+                                 const std::string& protocol)
+{
+  // The threads pass the baton through their own communicator, so that it
+  // cannot be mistaken for messages of the calling code
+  if(m_write_behind_comm == MPI_COMM_NULL)
+  {
+    MPI_Comm_dup(m_mpi_comm, &m_write_behind_comm);
+  }
+
+  std::string file_pattern;
+  if(protocol == "sidre_hdf5")
+  {
+#ifdef AXOM_USE_HDF5
+    file_pattern = getHDF5FilePattern(root_name);
+#else
+    SLIC_WARNING("'sidre_hdf5' protocol only available "
+                 << "when axom is configured with hdf5");
+    return;
+#endif /* AXOM_USE_HDF5 */
+  }
+
+  std::unique_ptr<IOBaton> baton(
+    new IOBaton(m_write_behind_comm, num_files, m_comm_size));
+
+  // sidre_hdf5 data files hold a group per rank of their set
+  const bool is_sidre_hdf5 = (protocol == "sidre_hdf5");
+  std::string file_name;
+  std::string relay_protocol;
+  if(is_sidre_hdf5)
+  {
+    file_name = getFileNameForRank(file_pattern, root_name, baton->getSetId());
+    relay_protocol = "hdf5";
+  }
+  else
+  {
+    file_name = fmt::sprintf("%s_%07d", file_base, baton->getSetId()) + "." +
+      protocol;
+    relay_protocol = (protocol == "conduit_bin")
+      ? protocol
+      : correspondingRelayProtocol(protocol);
+  }
+
+  std::string group_name = "datagroup";
+  if(m_comm_size != num_files)
+  {
+    group_name = fmt::sprintf("datagroup_%07d", m_my_rank);
+  }
+
+  // Snapshot the layout written by Group::save() into contiguous memory
+  std::unique_ptr<conduit::Node> staged(new conduit::Node);
+  {
+    conduit::Node layout;
+    datagroup->createSaveLayout(layout, protocol);
+    layout.compact_to(*staged);
+  }
+
+  m_write_behind_failed = false;
+  m_write_behind_error.clear();
+
+  // Errors are recorded for finishWriteBehind(), since an exception escaping
+  // the thread would terminate the program. The baton is passed regardless,
+  // so that the other ranks of the set are not blocked.
+  m_write_behind_thread = std::thread(
+    [this, is_sidre_hdf5, file_name, protocol, relay_protocol, group_name](
+      std::unique_ptr<conduit::Node> node,
+      std::unique_ptr<IOBaton> set_baton) {
+      (void)set_baton->wait();
+
+      std::string error;
+      try
+      {
+        if(is_sidre_hdf5)
+        {
+#ifdef AXOM_USE_HDF5
+          hid_t h5_file_id;
+          if(set_baton->isFirstInGroup())
+          {
+            std::string dir_name;
+            utilities::filesystem::getDirName(dir_name, file_name);
+            if(!dir_name.empty())
+            {
+              utilities::filesystem::makeDirsForPath(dir_name);
+            }
+            h5_file_id = conduit::relay::io::hdf5_create_file(file_name);
+          }
+          else
+          {
+            h5_file_id =
+              conduit::relay::io::hdf5_open_file_for_read_write(file_name);
+          }
+
+          if(h5_file_id < 0)
+          {
+            error = "Unable to open HDF5 file";
+          }
+          else
+          {
+            hid_t h5_group_id = H5Gcreate(h5_file_id,
+                                          group_name.c_str(),
+                                          H5P_DEFAULT,
+                                          H5P_DEFAULT,
+                                          H5P_DEFAULT);
+            if(h5_group_id < 0)
+            {
+              error = "Unable to create HDF5 group '" + group_name + "'";
+            }
+            else
+            {
+              conduit::relay::io::hdf5_write(*node, h5_group_id);
+              if(H5Gclose(h5_group_id) < 0)
+              {
+                error = "Unable to close HDF5 group '" + group_name + "'";
+              }
+            }
+
+            if(H5Fflush(h5_file_id, H5F_SCOPE_LOCAL) < 0 ||
+               H5Fclose(h5_file_id) < 0)
+            {
+              error = "Unable to close HDF5 file";
+            }
+          }
+#else
+          AXOM_UNUSED_VAR(group_name);
+#endif /* AXOM_USE_HDF5 */
+        }
+        else if(protocol == "sidre_bin" || protocol == "sidre_bin_lz4")
+        {
+          if(!binary_io::save(*node, file_name, protocol == "sidre_bin_lz4"))
+          {
+            error = "Unable to save file";
+          }
+        }
+        else
+        {
+          conduit::relay::io::save(*node, file_name, relay_protocol);
+        }
+      }
+      catch(const std::exception& e)
+      {
+        error = e.what();
+      }
+      catch(...)
+      {
+        error = "Unknown error";
+      }
+
+      if(!error.empty())
+      {
+        m_write_behind_failed = true;
+        m_write_behind_error = error + " while writing '" + file_name + "'.";
+      }
+
+      (void)set_baton->pass();
+    },
+    std::move(staged),
+    std::move(baton));
+}
+
+bool IOManager::finishWriteBehind()
+{
+  if(m_write_behind_thread.joinable())
+  {
+    m_write_behind_thread.join();
+  }
+
+  if(m_write_behind_failed)
+  {
+    SLIC_WARNING("IOManager write-behind write() failed: "
+                 << m_write_behind_error);
+    m_write_behind_failed = false;
+    m_write_behind_error.clear();
+    return false;
+  }
+  return true;
+}
+
 /*
  *************************************************************************
  *
@@ -272,6 +542,7 @@ void IOManager::read(sidre::Group* datagroup,
                      const std::string& protocol,
                      bool preserve_contents)
 {
+  finishWriteBehind();
   MPI_Barrier(m_mpi_comm);
 
   if(protocol == "sidre_hdf5")
@@ -322,11 +593,140 @@ void IOManager::read(sidre::Group* datagroup,
                      const std::string& root_file,
                      bool preserve_contents)
 {
+  finishWriteBehind();
   MPI_Barrier(m_mpi_comm);
   std::string protocol = getProtocol(root_file);
   read(datagroup, root_file, protocol, preserve_contents);
 }
 
+/*
+ *************************************************************************
+ *
+ * Read the groups of a contiguous range of writing ranks, without the
+ * baton.
+ *
+ *************************************************************************
+ */
+void IOManager::readRedistributed(sidre::Group* datagroup,
+                                  const std::string& root_file,
+                                  const std::string& list_name)
+{
+  finishWriteBehind();
+  MPI_Barrier(m_mpi_comm);
+
+  std::string protocol = getProtocol(root_file);
+
+  int num_files = 0;
+  int num_groups = 0;
+  std::string file_pattern;
+  getRootFileLayout(root_file, protocol, num_files, num_groups, file_pattern);
+  SLIC_ERROR_IF(
+    protocol != "sidre_hdf5" && num_files != num_groups,
+    "IOManager::readRedistributed() can only read files written with the '"
+      << protocol << "' protocol when they were written with one file "
+      << "per rank.");
+
+  int begin = 0;
+  int end = 0;
+  getRedistributedRange(m_my_rank, m_comm_size, num_groups, begin, end);
+  std::vector<int> rank_to_file = getRankToFileMap(num_files, num_groups);
+
+  Group* domains = datagroup->createGroup(list_name, true);
+  SLIC_ERROR_IF(domains == nullptr,
+                "IOManager::readRedistributed() could not create list group '"
+                  << list_name << "' in group '" << datagroup->getPathName()
+                  << "'.");
+
+  View* input_ranks_view =
+    datagroup->createViewAndAllocate(list_name + "_input_ranks",
+                                     INT_ID,
+                                     end - begin);
+  int* input_ranks = input_ranks_view->getData();
+
+  if(protocol == "sidre_hdf5")
+  {
+#ifdef AXOM_USE_HDF5
+    herr_t errv;
+    AXOM_UNUSED_VAR(errv);
+
+    // Consecutive writing ranks mostly share a file, which is kept open
+    hid_t h5_file_id = -1;
+    int open_file_id = -1;
+    for(int input_rank = begin; input_rank < end; ++input_rank)
+    {
+      const int file_id = rank_to_file[input_rank];
+      if(file_id != open_file_id)
+      {
+        if(open_file_id >= 0)
+        {
+          errv = H5Fclose(h5_file_id);
+          SLIC_ASSERT(errv >= 0);
+        }
+
+        std::string hdf5_name =
+          getFileNameForRank(file_pattern, root_file, file_id);
+        hdf5_name = getSCRPath(hdf5_name);
+
+        h5_file_id = conduit::relay::io::hdf5_open_file_for_read(hdf5_name);
+        SLIC_ASSERT(h5_file_id >= 0);
+        open_file_id = file_id;
+      }
+
+      std::string group_name = "datagroup";
+      if(H5Lexists(h5_file_id, group_name.c_str(), 0) <= 0)
+      {
+        group_name = fmt::sprintf("datagroup_%07d", input_rank);
+      }
+      hid_t h5_group_id = H5Gopen(h5_file_id, group_name.c_str(), 0);
+      SLIC_ASSERT(h5_group_id >= 0);
+
+      input_ranks[input_rank - begin] = input_rank;
+      domains->createUnnamedGroup()->load(h5_group_id, "sidre_hdf5", false);
+
+      errv = H5Gclose(h5_group_id);
+      SLIC_ASSERT(errv >= 0);
+    }
+
+    if(open_file_id >= 0)
+    {
+      errv = H5Fclose(h5_file_id);
+      SLIC_ASSERT(errv >= 0);
+    }
+#else
+    SLIC_WARNING("'sidre_hdf5' protocol only available "
+                 << "when axom is configured with hdf5");
+#endif /* AXOM_USE_HDF5 */
+  }
+  else
+  {
+    for(int input_rank = begin; input_rank < end; ++input_rank)
+    {
+      std::string file_name =
+        getFileNameForRank(file_pattern, root_file, rank_to_file[input_rank]);
+
+      input_ranks[input_rank - begin] = input_rank;
+      domains->createUnnamedGroup()->load(file_name, protocol);
+    }
+  }
+
+  MPI_Barrier(m_mpi_comm);
+}
+
+void IOManager::getRedistributedRange(int reader_rank,
+                                      int num_readers,
+                                      int num_groups,
+                                      int& begin,
+                                      int& end)
+{
+  SLIC_ASSERT(num_readers > 0);
+  SLIC_ASSERT(reader_rank >= 0 && reader_rank < num_readers);
+
+  // 64-bit products avoid overflow for large rank counts
+  const std::int64_t groups = num_groups;
+  begin = static_cast<int>(groups * reader_rank / num_readers);
+  end = static_cast<int>(groups * (reader_rank + 1) / num_readers);
+}
+
 std::string IOManager::getSCRPath(const std::string& path)
 {
 #ifdef AXOM_USE_SCR
@@ -362,6 +762,8 @@ std::string IOManager::getSCRPath(const std::string& path)
 void IOManager::loadExternalData(sidre::Group* datagroup,
                                  const std::string& root_file)
 {
+  finishWriteBehind();
+
   int num_files = getNumFilesFromRoot(root_file);
   int num_groups = getNumGroupsFromRoot(root_file);
   SLIC_ASSERT(num_files > 0);
@@ -845,6 +1247,51 @@ void IOManager::getRankToFileMap(View* rank_to_file_map, int num_files)
   rank_to_file_map->importArrayNode(map_global);
 }
 
+std::vector<int> IOManager::getRankToFileMap(int num_files, int num_groups)
+{
+  std::vector<int> map_vec(num_groups);
+  for(int rank = 0; rank < num_groups; ++rank)
+  {
+    map_vec[rank] = IOBaton::getSetIdForRank(rank, num_files, num_groups);
+  }
+  return map_vec;
+}
+
+/*
+ *************************************************************************
+ *
+ * Read the layout of the data files from the root file.
+ *
+ *************************************************************************
+ */
+void IOManager::getRootFileLayout(const std::string& root_name,
+                                  const std::string& protocol,
+                                  int& num_files,
+                                  int& num_groups,
+                                  std::string& file_pattern)
+{
+  int counts[2] = {0, 0};
+  if(m_my_rank == 0)
+  {
+    std::string root_path = getSCRPath(root_name);
+
+    conduit::Node n;
+    std::string relay_protocol = correspondingRelayProtocol(protocol);
+    conduit::relay::io::load(root_path, relay_protocol, n);
+    counts[0] = n["number_of_files"].to_int();
+    counts[1] = n["number_of_trees"].to_int();
+    file_pattern = n["file_pattern"].as_string();
+  }
+
+  MPI_Bcast(counts, 2, MPI_INT, 0, m_mpi_comm);
+  num_files = counts[0];
+  num_groups = counts[1];
+  SLIC_ASSERT(num_files > 0);
+  SLIC_ASSERT(num_groups > 0);
+
+  file_pattern = broadcastString(file_pattern, m_mpi_comm, m_my_rank);
+}
+
 /*
  *************************************************************************
  *
@@ -854,6 +1301,8 @@ void IOManager::getRankToFileMap(View* rank_to_file_map, int num_files)
  */
 int IOManager::getNumFilesFromRoot(const std::string& root_file)
 {
+  finishWriteBehind();
+
   /*
    * Read num_files from rootfile on rank 0.
    */
@@ -880,6 +1329,8 @@ int IOManager::getNumFilesFromRoot(const std::string& root_file)
 
 int IOManager::getNumGroupsFromRoot(const std::string& root_file)
 {
+  finishWriteBehind();
+
   /*
    * Read number_of_trees from rootfile on rank 0.
    */
@@ -915,6 +1366,8 @@ int IOManager::getNumGroupsFromRoot(const std::string& root_file)
 void IOManager::writeGroupToRootFile(sidre::Group* group,
                                      const std::string& file_name)
 {
+  finishWriteBehind();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -969,6 +1422,8 @@ void IOManager::writeGroupToRootFileAtPath(sidre::Group* group,
                                            const std::string& file_name,
                                            const std::string& group_path)
 {
+  finishWriteBehind();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -1028,6 +1483,8 @@ void IOManager::writeViewToRootFileAtPath(sidre::View* view,
                                           const std::string& file_name,
                                           const std::string& group_path)
 {
+  finishWriteBehind();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -1069,6 +1526,8 @@ void IOManager::writeBlueprintIndexToRootFile(DataStore* datastore,
                                               const std::string& file_name,
                                               const std::string& mesh_path)
 {
+  finishWriteBehind();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -27,6 +27,11 @@
 
 #include "mpi.h"
 
+// C/C++ headers
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace axom
 {
 namespace sidre
@@ -40,6 +45,9 @@ namespace sidre
  * before calling Group's I/O methods.  It uses IOBaton to control the
  * parallel I/O operations, such that one rank at a time interacts with any
  * particular output file.
+ *
+ * In write-behind mode, write() copies the Group's data to a staging area
+ * and returns, while a background thread writes the data files.
  */
 class IOManager
 {
@@ -73,6 +81,8 @@ public:
    *    sidre_hdf5
    *    sidre_conduit_json
    *    sidre_json
+   *    sidre_bin
+   *    sidre_bin_lz4
    *
    *    conduit_hdf5
    *    conduit_bin
@@ -109,6 +119,50 @@ public:
              const std::string& protocol,
              const std::string& tree_pattern = "datagroup");
 
+  /*!
+   * \brief Enables or disables write-behind mode for write()
+   *
+   * In write-behind mode, write() creates the root file and copies the
+   * Group's data, including the data of external Views, into a staging
+   * area. It then returns, while a background thread writes the data files.
+   * The Group may be modified or destroyed as soon as write() returns. The
+   * files are identical to those of a blocking write(), except that the
+   * sidre_hdf5 data files also hold the Attribute layout, as Group::save()
+   * does.
+   *
+   * Only one write-behind write() is pending at a time: the next call to
+   * write(), read() or any other method that accesses files first waits for
+   * the previous one to be written on this rank.
+   *
+   * When the number of files is smaller than the number of ranks, the ranks
+   * sharing a file pass the IOBaton from their background threads, which
+   * requires MPI to be initialized with MPI_THREAD_MULTIPLE. Otherwise, as
+   * well as when using SCR, write() falls back to a blocking write.
+   *
+   * \note Unless HDF5 is built thread-safe, the calling code must not use
+   * HDF5 while a write-behind write() is pending.
+   *
+   * \param write_behind  Whether write() writes the data files in the
+   *                      background
+   */
+  void setWriteBehind(bool write_behind);
+
+  /*!
+   * \brief Returns whether write() writes the data files in the background
+   */
+  bool isWriteBehind() const { return m_write_behind; }
+
+  /*!
+   * \brief Waits until all data files of a write-behind write() are complete
+   *
+   * This is an MPI collective call. When it returns, the files written by
+   * all ranks are complete and may be read.
+   *
+   * \return true if the data files of this rank were written successfully;
+   *  otherwise the error is also reported with a warning.
+   */
+  bool waitForCompletion();
+
   /*!
    * \brief write additional group to existing root file
    *
@@ -273,6 +327,56 @@ public:
             const std::string& root_file,
             bool preserve_contents = false);
 
+  /*!
+   * \brief read files written by any number of ranks, redistributing the
+   *  written groups over the ranks of this communicator
+   *
+   * Each rank is assigned a contiguous range of the ranks that wrote the
+   * files, as given by getRedistributedRange(). It loads the group written
+   * by each rank of its range into a new unnamed child of a list group
+   * named list_name, in the order of the writing ranks, and creates an
+   * array View named list_name + "_input_ranks" holding those writing ranks.
+   * Ranks without any assigned group create an empty list.
+   *
+   * The writer of each group and the file holding it are found with the
+   * same rank to file map as getRankToFileMap() when writing. Unlike read(),
+   * the files are read concurrently, without passing the IOBaton, so a
+   * restart on fewer ranks than were written reads at the speed of the
+   * reading ranks.
+   *
+   * This is an MPI collective call on all ranks in the communicator used
+   * to construct this object.
+   *
+   * \note Files written with protocols other than sidre_hdf5 hold one group,
+   *  so they can only be read this way when written with one file per rank.
+   *
+   * \param group      Group to hold the list of loaded groups
+   * \param root_file  root file containing input data
+   * \param list_name  name of the list group created in group
+   */
+  void readRedistributed(sidre::Group* group,
+                         const std::string& root_file,
+                         const std::string& list_name = "domains");
+
+  /*!
+   * \brief Gets the contiguous range of writing ranks assigned to a rank
+   *  by readRedistributed()
+   *
+   * The num_groups writing ranks are split evenly over the num_readers
+   * reading ranks, and the range sizes differ by at most one.
+   *
+   * \param reader_rank  rank of the reader
+   * \param num_readers  number of reading ranks
+   * \param num_groups   number of groups in the files (writing ranks)
+   * \param begin        first assigned writing rank
+   * \param end          one past the last assigned writing rank
+   */
+  static void getRedistributedRange(int reader_rank,
+                                    int num_readers,
+                                    int num_groups,
+                                    int& begin,
+                                    int& end);
+
   /**
    * \brief Finds conduit relay protocol corresponding to a sidre protocol
    *
@@ -360,6 +464,27 @@ private:
    */
   void getRankToFileMap(View* rank_to_file_map, int num_files);
 
+  /*!
+   * \brief Get the map of ranks to file ID numbers of an earlier write().
+   *
+   * The map is the one that getRankToFileMap() produced for num_groups
+   * writing ranks and num_files files, and is computed without
+   * communication.
+   */
+  static std::vector<int> getRankToFileMap(int num_files, int num_groups);
+
+  /*!
+   * Collective operation to read the number of files, the number of groups
+   * and the file pattern from the root file. They are read on rank 0 and
+   * broadcast to the other ranks.
+   * \note Works for all sidre protocols.
+   */
+  void getRootFileLayout(const std::string& root_name,
+                         const std::string& protocol,
+                         int& num_files,
+                         int& num_groups,
+                         std::string& file_pattern);
+
   /*!
    * \brief If needed, get a file path created by SCR.
    *
@@ -379,6 +504,32 @@ private:
    */
   std::string getSCRPath(const std::string& path);
 
+  /*!
+   * \brief Returns whether write() can write the given number of files in
+   *  the background.
+   */
+  bool canWriteBehind(int num_files) const;
+
+  /*!
+   * \brief Copies the Group's data to a staging area and starts writing
+   *  the data files for this rank in a background thread.
+   *
+   * The root file must have been created beforehand.
+   */
+  void startWriteBehind(sidre::Group* group,
+                        int num_files,
+                        const std::string& file_base,
+                        const std::string& root_name,
+                        const std::string& protocol);
+
+  /*!
+   * \brief Waits until the background thread of a write-behind write() on
+   *  this rank has finished, and warns if it failed.
+   *
+   * \return false if the background thread failed to write the data files
+   */
+  bool finishWriteBehind();
+
   int m_comm_size;  // num procs in the MPI communicator
   int m_my_rank;    // rank of this proc
 
@@ -387,6 +538,12 @@ private:
   MPI_Comm m_mpi_comm;
 
   bool m_use_scr;
+
+  bool m_write_behind;
+  MPI_Comm m_write_behind_comm;  // duplicate of m_mpi_comm for the threads
+  std::thread m_write_behind_thread;
+  bool m_write_behind_failed;        // set by the thread if its write failed
+  std::string m_write_behind_error;  // and the reason for the failure
 };
 
 } /* end namespace sidre */
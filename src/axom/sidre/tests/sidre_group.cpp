@@ -6,10 +6,13 @@
 #include "axom/config.hpp"  // for AXOM_USE_HDF5
 #include "axom/core.hpp"
 #include "axom/sidre.hpp"
+#include "axom/sidre/core/BinaryIO.hpp"
 
 #include "gtest/gtest.h"
 
 #include <cstring>
+#include <fstream>
+#include <iterator>
 #include <vector>
 
 using axom::sidre::Buffer;
@@ -46,6 +49,8 @@ std::vector<std::string> getAvailableSidreProtocols()
 #endif
   protocols.push_back("sidre_json");
   protocols.push_back("sidre_conduit_json");
+  protocols.push_back("sidre_bin");
+  protocols.push_back("sidre_bin_lz4");
 
 #ifdef AXOM_USE_HDF5
   protocols.push_back("conduit_hdf5");
@@ -2619,6 +2624,151 @@ TEST(sidre_group, save_load_all_protocols)
   DataStore::setConduitDefaultMessageHandlers();
 }
 
+//------------------------------------------------------------------------------
+TEST(sidre_group, binary_io_compress_block)
+{
+  namespace binary_io = axom::sidre::binary_io;
+
+  // Mesh-like data, with runs of nearly equal values
+  const int ndata = 50000;
+  std::vector<double> values(ndata);
+  for(int i = 0; i < ndata; ++i)
+  {
+    values[i] = 0.25 * (i / 16);
+  }
+  const char* src = reinterpret_cast<const char*>(values.data());
+  const std::size_t src_size = values.size() * sizeof(double);
+
+  std::vector<char> compressed;
+  binary_io::compressBlock(src, src_size, compressed);
+  EXPECT_LT(compressed.size(), src_size / 2);
+
+  std::vector<char> decompressed(src_size);
+  EXPECT_TRUE(binary_io::decompressBlock(compressed.data(),
+                                         compressed.size(),
+                                         decompressed.data(),
+                                         src_size));
+  EXPECT_EQ(std::memcmp(src, decompressed.data(), src_size), 0);
+
+  // Truncated blocks and wrong sizes are rejected
+  EXPECT_FALSE(binary_io::decompressBlock(compressed.data(),
+                                          compressed.size() - 1,
+                                          decompressed.data(),
+                                          src_size));
+  EXPECT_FALSE(binary_io::decompressBlock(compressed.data(),
+                                          compressed.size(),
+                                          decompressed.data(),
+                                          src_size - 1));
+}
+
+//------------------------------------------------------------------------------
+TEST(sidre_group, binary_io_reader)
+{
+  namespace binary_io = axom::sidre::binary_io;
+
+  DataStore ds;
+  Group* root = ds.getRoot();
+  const int ndata = 3 * static_cast<int>(binary_io::BLOCK_SIZE / 8);
+  root->createViewScalar<conduit::int32>("i0", 7);
+  root->createViewAndAllocate("vals", DataType::float64(ndata));
+  conduit::float64* vals = root->getView("vals")->getArray();
+  for(int i = 0; i < ndata; ++i)
+  {
+    vals[i] = 0.5 * (i / 4);
+  }
+
+  const std::string protocols[] = {"sidre_bin", "sidre_bin_lz4"};
+  for(const std::string& protocol : protocols)
+  {
+    const std::string file_path = "sidre_binary_io_reader." + protocol;
+    root->save(file_path, protocol);
+    EXPECT_TRUE(binary_io::isBinaryFile(file_path));
+
+    // Only uncompressed files are read without copying the data
+    binary_io::Reader reader;
+    ASSERT_TRUE(reader.open(file_path));
+    EXPECT_EQ(reader.isZeroCopy(), protocol == "sidre_bin");
+    EXPECT_TRUE(reader.node().has_path("sidre"));
+    reader.close();
+
+    DataStore ds_load;
+    ds_load.getRoot()->load(file_path, protocol);
+    EXPECT_TRUE(root->isEquivalentTo(ds_load.getRoot()));
+
+    View* view = ds_load.getRoot()->getView("vals");
+    ASSERT_NE(view, nullptr);
+    ASSERT_EQ(view->getNumElements(), ndata);
+    const conduit::float64* load_vals = view->getArray();
+    EXPECT_EQ(std::memcmp(vals, load_vals, ndata * sizeof(double)), 0);
+  }
+
+  EXPECT_FALSE(binary_io::isBinaryFile("sidre_binary_io_reader.missing"));
+}
+
+//------------------------------------------------------------------------------
+TEST(sidre_group, binary_io_reader_corrupt_header)
+{
+  namespace binary_io = axom::sidre::binary_io;
+
+  DataStore ds;
+  Group* root = ds.getRoot();
+  root->createViewScalar<conduit::int32>("i0", 7);
+  root->createViewString("s0", "hello");
+
+  const std::string file_path = "sidre_binary_io_corrupt.sidre_bin";
+  root->save(file_path, "sidre_bin");
+
+  std::vector<char> bytes;
+  {
+    std::ifstream ifs(file_path.c_str(), std::ios::in | std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(ifs),
+                 std::istreambuf_iterator<char>());
+  }
+  ASSERT_GT(bytes.size(), 48u);
+
+  // Writes the given file after setting the little-endian header field
+  // at the given offset
+  auto write_corrupt = [&](std::size_t offset, std::uint64_t value) {
+    std::vector<char> corrupt(bytes);
+    for(int i = 0; i < 8; ++i)
+    {
+      corrupt[offset + i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    const std::string corrupt_path = "sidre_binary_io_corrupt.bad";
+    std::ofstream ofs(corrupt_path.c_str(), std::ios::out | std::ios::binary);
+    ofs.write(corrupt.data(), corrupt.size());
+    return corrupt_path;
+  };
+
+  binary_io::Reader reader;
+  ASSERT_TRUE(reader.open(file_path));
+  reader.close();
+
+  // Schema sizes that reach past the end of the file
+  const std::size_t file_size = bytes.size();
+  const std::size_t schema_offset = 16;
+  EXPECT_FALSE(reader.open(write_corrupt(schema_offset, file_size - 8)));
+  EXPECT_FALSE(reader.open(write_corrupt(schema_offset, file_size)));
+  EXPECT_FALSE(reader.open(write_corrupt(schema_offset, ~std::uint64_t(0))));
+
+  // Data sizes and block counts that don't match the blocks in the file
+  const std::size_t data_offset = 24;
+  const std::size_t num_blocks_offset = 40;
+  EXPECT_FALSE(reader.open(write_corrupt(data_offset, ~std::uint64_t(0))));
+  EXPECT_FALSE(reader.open(write_corrupt(data_offset, 1000 * file_size)));
+  EXPECT_FALSE(reader.open(write_corrupt(num_blocks_offset, 1000)));
+
+  // Truncated files
+  for(std::size_t size : {std::size_t(0), std::size_t(40), file_size - 1})
+  {
+    const std::string truncated_path = "sidre_binary_io_corrupt.short";
+    std::ofstream ofs(truncated_path.c_str(), std::ios::out | std::ios::binary);
+    ofs.write(bytes.data(), size);
+    ofs.close();
+    EXPECT_FALSE(reader.open(truncated_path));
+  }
+}
+
 //------------------------------------------------------------------------------
 TEST(sidre_group, save_load_preserve_contents)
 {
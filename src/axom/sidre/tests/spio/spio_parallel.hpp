@@ -35,6 +35,8 @@
 #include "mpi.h"
 // _parallel_io_headers_end
 
+#include "axom/core/utilities/FileUtilities.hpp"
+
 using axom::sidre::DataStore;
 using axom::sidre::DataType;
 using axom::sidre::Group;
@@ -282,6 +284,97 @@ TEST(spio_parallel, write_read_write)
   writer_b.write(ds_r.getRoot(), num_files, filename, PROTOCOL);
 }
 
+//----------------------------------------------------------------------
+TEST(spio_parallel, write_behind)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const int num_vals = 10;
+  const int num_output = numOutputFiles(num_ranks);
+
+  // Try a file per rank, which is always written behind, and the shared files
+  // used by the other tests, which may fall back to a blocking write
+  for(int num_files : {num_ranks, num_output})
+  {
+    std::stringstream sstr;
+    sstr << "out_spio_write_behind_" << num_ranks << "_" << num_files;
+    const std::string filename = sstr.str();
+
+    DataStore ds;
+    Group* root = ds.getRoot();
+    root->createViewScalar("grp/i", 101 * my_rank);
+    View* vals_view =
+      root->createViewAndAllocate("grp/vals", DataType::c_int(num_vals));
+    int* vals = vals_view->getData();
+    for(int i = 0; i < num_vals; ++i)
+    {
+      vals[i] = (i + 10) * (404 - my_rank - i);
+    }
+
+    IOManager writer(MPI_COMM_WORLD);
+    writer.setWriteBehind(true);
+    EXPECT_TRUE(writer.isWriteBehind());
+    writer.write(root, num_files, filename, PROTOCOL);
+
+    // The written data was staged, so modifying the group does not change it
+    for(int i = 0; i < num_vals; ++i)
+    {
+      vals[i] = -1;
+    }
+    root->getView("grp/i")->setScalar(-1);
+
+    writer.waitForCompletion();
+
+    DataStore ds_r;
+    IOManager reader(MPI_COMM_WORLD);
+    reader.read(ds_r.getRoot(), filename + ROOT_EXT);
+
+    EXPECT_EQ(ds_r.getRoot()->getView("grp/i")->getData<int>(), 101 * my_rank);
+    View* vals_view_r = ds_r.getRoot()->getView("grp/vals");
+    EXPECT_EQ(vals_view_r->getNumElements(), num_vals);
+    if(vals_view_r->getNumElements() == num_vals)
+    {
+      int* vals_r = vals_view_r->getData();
+      for(int i = 0; i < num_vals; ++i)
+      {
+        EXPECT_EQ(vals_r[i], (i + 10) * (404 - my_rank - i));
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(spio_parallel, write_behind_unwritable)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  // With a file per rank, the data file of each rank is named after its rank.
+  // A directory in its place makes the background write fail.
+  const std::string protocol = "sidre_bin";
+  const std::string filename =
+    axom::fmt::format("out_spio_write_behind_unwritable_{}", num_ranks);
+  axom::utilities::filesystem::makeDirsForPath(
+    axom::fmt::sprintf("%s_%07d.%s", filename, my_rank, protocol));
+
+  DataStore ds;
+  ds.getRoot()->createViewScalar("grp/i", 101 * my_rank);
+
+  IOManager writer(MPI_COMM_WORLD);
+  writer.setWriteBehind(true);
+  writer.write(ds.getRoot(), num_ranks, filename, protocol);
+
+  // The failure is reported, and the baton was passed regardless
+  EXPECT_FALSE(writer.waitForCompletion());
+
+  // A subsequent write to a writable path succeeds
+  writer.write(ds.getRoot(), num_ranks, filename + "_ok", protocol);
+  EXPECT_TRUE(writer.waitForCompletion());
+}
+
 //------------------------------------------------------------------------------
 TEST(spio_parallel, external_writeread)
 {
@@ -961,6 +1054,102 @@ TEST(spio_parallel, parallel_decrease_procs)
 #endif  // AXOM_USE_HDF5
 }
 
+//------------------------------------------------------------------------------
+TEST(spio_parallel, redistributed_read)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const int num_vals = 10;
+  const std::string filename = "out_spio_redistributed_read";
+
+  DataStore ds;
+  Group* root = ds.getRoot();
+  root->createViewScalar("grp/i", 101 * my_rank);
+  View* vals_view =
+    root->createViewAndAllocate("grp/vals", DataType::c_int(num_vals));
+  int* vals = vals_view->getData();
+  for(int i = 0; i < num_vals; ++i)
+  {
+    vals[i] = (i + 10) * (404 - my_rank - i);
+  }
+
+  IOManager writer(MPI_COMM_WORLD);
+  writer.write(root, numOutputFiles(num_ranks), filename, PROTOCOL);
+
+  // Restart on half of the ranks, each reading a range of the written groups
+  const int num_readers = std::max(num_ranks / 2, 1);
+  MPI_Comm read_comm;
+  MPI_Comm_split(MPI_COMM_WORLD,
+                 my_rank < num_readers ? 0 : MPI_UNDEFINED,
+                 my_rank,
+                 &read_comm);
+
+  if(read_comm != MPI_COMM_NULL)
+  {
+    // The ranges are contiguous and balanced
+    int begin = 0;
+    int end = 0;
+    IOManager::getRedistributedRange(my_rank,
+                                     num_readers,
+                                     num_ranks,
+                                     begin,
+                                     end);
+    EXPECT_GE(end - begin, num_ranks / num_readers);
+    EXPECT_LE(end - begin, num_ranks / num_readers + 1);
+    if(my_rank + 1 < num_readers)
+    {
+      int next_begin = 0;
+      int next_end = 0;
+      IOManager::getRedistributedRange(my_rank + 1,
+                                       num_readers,
+                                       num_ranks,
+                                       next_begin,
+                                       next_end);
+      EXPECT_EQ(next_begin, end);
+    }
+    else
+    {
+      EXPECT_EQ(end, num_ranks);
+    }
+
+    DataStore ds_r;
+    IOManager reader(read_comm);
+    reader.readRedistributed(ds_r.getRoot(), filename + ROOT_EXT);
+
+    Group* domains = ds_r.getRoot()->getGroup("domains");
+    EXPECT_TRUE(domains->isUsingList());
+    EXPECT_EQ(domains->getNumGroups(), end - begin);
+
+    View* input_ranks_view = ds_r.getRoot()->getView("domains_input_ranks");
+    EXPECT_EQ(input_ranks_view->getNumElements(), end - begin);
+    const int* input_ranks = input_ranks_view->getData();
+
+    int index = 0;
+    for(auto& domain : domains->groups())
+    {
+      const int input_rank = begin + index;
+      EXPECT_EQ(input_ranks[index], input_rank);
+      EXPECT_EQ(domain.getView("grp/i")->getData<int>(), 101 * input_rank);
+
+      View* vals_view_r = domain.getView("grp/vals");
+      EXPECT_EQ(vals_view_r->getNumElements(), num_vals);
+      if(vals_view_r->getNumElements() == num_vals)
+      {
+        int* vals_r = vals_view_r->getData();
+        for(int i = 0; i < num_vals; ++i)
+        {
+          EXPECT_EQ(vals_r[i], (i + 10) * (404 - input_rank - i));
+        }
+      }
+      ++index;
+    }
+
+    MPI_Comm_free(&read_comm);
+  }
+}
+
 TEST(spio_parallel, sidre_simple_blueprint_example)
 {
   int my_rank;
@@ -11,8 +11,8 @@
 #include "axom/slic/core/LogStream.hpp"
 
 // C/C++ includes
+#include <cstring>
 #include <ctime>
-#include <sstream>
 
 namespace axom
 {
@@ -20,29 +20,69 @@ namespace slic
 {
 //------------------------------------------------------------------------------
 LogStream::LogStream()
-  : m_formatString("*****\n[<LEVEL>]\n\n <MESSAGE> \n\n <FILE>\n<LINE>\n****\n")
-{ }
+{
+  this->setFormatString(
+    "*****\n[<LEVEL>]\n\n <MESSAGE> \n\n <FILE>\n<LINE>\n****\n");
+}
 
 //------------------------------------------------------------------------------
 LogStream::~LogStream() { }
 
 //------------------------------------------------------------------------------
-void LogStream::replaceKey(std::string& msg,
-                           const std::string& key,
-                           const std::string& value,
-                           std::size_t pos)
+void LogStream::setFormatString(const std::string& format)
 {
-  if(pos == std::string::npos)
+  struct Keyword
+  {
+    const char* name;
+    FormatField field;
+  };
+
+  static const Keyword keywords[] = {{"<LEVEL>", FormatField::Level},
+                                     {"<MESSAGE>", FormatField::Message},
+                                     {"<TAG>", FormatField::Tag},
+                                     {"<FILE>", FormatField::File},
+                                     {"<LINE>", FormatField::Line},
+                                     {"<RANK>", FormatField::Rank},
+                                     {"<TIMESTAMP>", FormatField::Timestamp}};
+
+  m_formatTokens.clear();
+
+  // split the format string into literal text and keywords
+  std::size_t textStart = 0;
+  std::size_t pos = format.find('<');
+  while(pos != std::string::npos)
   {
-    pos = msg.find(key);
+    const Keyword* match = nullptr;
+    for(const Keyword& keyword : keywords)
+    {
+      if(format.compare(pos, std::strlen(keyword.name), keyword.name) == 0)
+      {
+        match = &keyword;
+        break;
+      }
+    }
+
+    if(match == nullptr)
+    {
+      pos = format.find('<', pos + 1);
+      continue;
+    }
+
+    if(pos > textStart)
+    {
+      m_formatTokens.push_back(
+        {FormatField::Text, format.substr(textStart, pos - textStart)});
+    }
+    m_formatTokens.push_back({match->field, std::string()});
+
+    textStart = pos + std::strlen(match->name);
+    pos = format.find('<', textStart);
   }
 
-  if(pos != std::string::npos)
+  if(textStart < format.size())
   {
-    msg = msg.substr(0, pos) + value +
-      msg.substr(pos + key.length(), msg.length() - 1);
-
-  }  // END if
+    m_formatTokens.push_back({FormatField::Text, format.substr(textStart)});
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -72,33 +112,43 @@ std::string LogStream::getFormatedMessage(const std::string& msgLevel,
                                           const std::string& fileName,
                                           int line)
 {
-  std::string msg = m_formatString;
-
-  this->replaceKey(msg, "<LEVEL>", msgLevel);
-  this->replaceKey(msg, "<MESSAGE>", message);
-  this->replaceKey(msg, "<TAG>", tagName);
-  this->replaceKey(msg, "<FILE>", fileName);
-  this->replaceKey(msg, "<RANK>", rank);
-
-  if(line != MSG_IGNORE_LINE)
-  {
-    std::ostringstream oss;
-    oss << line;
-
-    this->replaceKey(msg, "<LINE>", oss.str());
-  }
-  else
-  {
-    this->replaceKey(msg, "<LINE>", "");
-  }
+  std::string msg;
 
-  std::size_t pos = msg.find("<TIMESTAMP>");
-  if(pos != std::string::npos)
+  for(const FormatToken& token : m_formatTokens)
   {
-    this->replaceKey(msg, "<TIMESTAMP>", this->getTimeStamp(), pos);
+    switch(token.field)
+    {
+    case FormatField::Text:
+      msg += token.text;
+      break;
+    case FormatField::Level:
+      msg += msgLevel;
+      break;
+    case FormatField::Message:
+      msg += message;
+      break;
+    case FormatField::Tag:
+      msg += tagName;
+      break;
+    case FormatField::File:
+      msg += fileName;
+      break;
+    case FormatField::Line:
+      if(line != MSG_IGNORE_LINE)
+      {
+        msg += std::to_string(line);
+      }
+      break;
+    case FormatField::Rank:
+      msg += rank;
+      break;
+    case FormatField::Timestamp:
+      msg += this->getTimeStamp();
+      break;
+    }
   }
 
-  return (msg);
+  return msg;
 }
 
 } /* namespace slic */
@@ -25,6 +25,7 @@
 
 // C/C++ includes
 #include <string>  // For STL string
+#include <vector>  // For STL vector
 
 namespace axom
 {
@@ -75,8 +76,11 @@ public:
    *         std::string( "* RANK=<RANK>\n" ) +
    *         std::string( "***********************************\n" );
    * \endcode
+   *
+   * \note The format string is parsed once, when it is set, so that the
+   *  keywords are not searched for each time a message is formatted.
    */
-  void setFormatString(const std::string& format) { m_formatString = format; }
+  void setFormatString(const std::string& format);
 
   /*!
    * \brief Appends the given message to the stream.
@@ -143,6 +147,8 @@ protected:
   /*!
    * \brief Returns the formatted message as a single string.
    *
+   * The message is assembled from the parsed format string.
+   *
    * \param [in] msgLevel the level of the given message.
    * \param [in] message the user-supplied message.
    * \param [in] tagName user-supplied tag, may be MSG_IGNORE_TAG
@@ -169,19 +175,32 @@ protected:
   std::string getTimeStamp();
 
 private:
-  std::string m_formatString;
+  /*!
+   * \brief Enumerates the fields that may appear in a format string.
+   */
+  enum class FormatField
+  {
+    Text,
+    Level,
+    Message,
+    Tag,
+    File,
+    Line,
+    Rank,
+    Timestamp
+  };
 
   /*!
-   * \brief Replaces the given key in the message string with the given value.
-   *
-   * \param [in,out] msg the message string that will be modified.
-   * \param [in] key the key in the message that will be replace.
-   * \param [in] value the value to replace it with.
+   * \brief A piece of a parsed format string, either literal text or a
+   *  keyword that is substituted when a message is formatted.
    */
-  void replaceKey(std::string& msg,
-                  const std::string& key,
-                  const std::string& value,
-                  std::size_t pos = std::string::npos);
+  struct FormatToken
+  {
+    FormatField field;
+    std::string text;
+  };
+
+  std::vector<FormatToken> m_formatTokens;
 
   DISABLE_COPY_AND_ASSIGNMENT(LogStream);
   DISABLE_MOVE_AND_ASSIGNMENT(LogStream);
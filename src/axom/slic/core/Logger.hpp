@@ -66,6 +66,22 @@ public:
    */
   void setLoggingMsgLevel(message::Level level);
 
+  /*!
+   * \brief Checks whether a message at the given level would be logged, i.e.,
+   *  whether the level is enabled and has at least one registered stream.
+   *
+   * \param [in] level the level in query.
+   *
+   * \return status true if messages at the given level are logged.
+   *
+   * \note This check is cheap and is intended to be called before a message
+   *  is formatted, so that messages at disabled levels cost only a branch.
+   */
+  bool isLevelEnabled(message::Level level) const
+  {
+    return m_isEnabled[level] && !m_logStreams[level].empty();
+  }
+
   /*!
    * \brief Toggles the abort behavior for error messages. Default is true.
    *
@@ -88,6 +88,13 @@ message::Level getLoggingMsgLevel()
   return Logger::getActiveLogger()->getLoggingMsgLevel();
 }
 
+//------------------------------------------------------------------------------
+bool isLevelEnabled(message::Level level)
+{
+  ensureInitialized();
+  return Logger::getActiveLogger()->isLevelEnabled(level);
+}
+
 //------------------------------------------------------------------------------
 void abort()
 {
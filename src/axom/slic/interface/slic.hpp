@@ -113,6 +113,19 @@ void setLoggingMsgLevel(message::Level level);
  */
 message::Level getLoggingMsgLevel();
 
+/*!
+ * \brief Checks whether messages at the given level are logged by the
+ *  current active logger.
+ *
+ * \param [in] level the level in query.
+ *
+ * \return status true if the level is enabled and has at least one stream.
+ *
+ * \note The logging macros call this before formatting a message, so that
+ *  messages at disabled levels are never formatted.
+ */
+bool isLevelEnabled(message::Level level);
+
 /*!
  * \brief Toggles the abort behavior for errors on the current active logger.
  *
@@ -516,6 +516,7 @@
  * \param [in] msg user-supplied message
  *
  * \note The SLIC_INFO macro is always active.
+ * \note The message is only formatted if the Info level is enabled.
  *
  * Usage:
  * \code
@@ -523,15 +524,18 @@
  * \endcode
  *
  */
-#define SLIC_INFO(msg)                                \
-  do                                                  \
-  {                                                   \
-    std::ostringstream __oss;                         \
-    __oss << msg;                                     \
-    axom::slic::logMessage(axom::slic::message::Info, \
-                           __oss.str(),               \
-                           __FILE__,                  \
-                           __LINE__);                 \
+#define SLIC_INFO(msg)                                        \
+  do                                                          \
+  {                                                           \
+    if(axom::slic::isLevelEnabled(axom::slic::message::Info)) \
+    {                                                         \
+      std::ostringstream __oss;                               \
+      __oss << msg;                                           \
+      axom::slic::logMessage(axom::slic::message::Info,       \
+                             __oss.str(),                     \
+                             __FILE__,                        \
+                             __LINE__);                       \
+    }                                                         \
   } while(axom::slic::detail::false_value)
 
 /*!
@@ -549,18 +553,18 @@
  * \endcode
  *
  */
-#define SLIC_INFO_IF(EXP, msg)                          \
-  do                                                    \
-  {                                                     \
-    if(EXP)                                             \
-    {                                                   \
-      std::ostringstream __oss;                         \
-      __oss << msg;                                     \
-      axom::slic::logMessage(axom::slic::message::Info, \
-                             __oss.str(),               \
-                             __FILE__,                  \
-                             __LINE__);                 \
-    }                                                   \
+#define SLIC_INFO_IF(EXP, msg)                                         \
+  do                                                                   \
+  {                                                                    \
+    if((EXP) && axom::slic::isLevelEnabled(axom::slic::message::Info)) \
+    {                                                                  \
+      std::ostringstream __oss;                                        \
+      __oss << msg;                                                    \
+      axom::slic::logMessage(axom::slic::message::Info,                \
+                             __oss.str(),                              \
+                             __FILE__,                                 \
+                             __LINE__);                                \
+    }                                                                  \
   } while(axom::slic::detail::false_value)
 
 /*!
@@ -606,6 +610,7 @@
  * \param [in] msg user-supplied message
  *
  * \note The SLIC_Debug macro is active when AXOM_DEBUG is defined.
+ * \note The message is only formatted if the Debug level is enabled.
  *
  * Usage:
  * \code
@@ -613,15 +618,18 @@
  * \endcode
  *
  */
-  #define SLIC_DEBUG(msg)                                \
-    do                                                   \
-    {                                                    \
-      std::ostringstream __oss;                          \
-      __oss << msg;                                      \
-      axom::slic::logMessage(axom::slic::message::Debug, \
-                             __oss.str(),                \
-                             __FILE__,                   \
-                             __LINE__);                  \
+  #define SLIC_DEBUG(msg)                                        \
+    do                                                           \
+    {                                                            \
+      if(axom::slic::isLevelEnabled(axom::slic::message::Debug)) \
+      {                                                          \
+        std::ostringstream __oss;                                \
+        __oss << msg;                                            \
+        axom::slic::logMessage(axom::slic::message::Debug,       \
+                               __oss.str(),                      \
+                               __FILE__,                         \
+                               __LINE__);                        \
+      }                                                          \
     } while(axom::slic::detail::false_value)
 
   /*!
@@ -639,18 +647,18 @@
  * \endcode
  *
  */
-  #define SLIC_DEBUG_IF(EXP, msg)                          \
-    do                                                     \
-    {                                                      \
-      if(EXP)                                              \
-      {                                                    \
-        std::ostringstream __oss;                          \
-        __oss << msg;                                      \
-        axom::slic::logMessage(axom::slic::message::Debug, \
-                               __oss.str(),                \
-                               __FILE__,                   \
-                               __LINE__);                  \
-      }                                                    \
+  #define SLIC_DEBUG_IF(EXP, msg)                                         \
+    do                                                                    \
+    {                                                                     \
+      if((EXP) && axom::slic::isLevelEnabled(axom::slic::message::Debug)) \
+      {                                                                   \
+        std::ostringstream __oss;                                         \
+        __oss << msg;                                                     \
+        axom::slic::logMessage(axom::slic::message::Debug,                \
+                               __oss.str(),                               \
+                               __FILE__,                                  \
+                               __LINE__);                                 \
+      }                                                                   \
     } while(axom::slic::detail::false_value)
 
   /*!
@@ -60,6 +60,11 @@ LumberjackStream::LumberjackStream(std::ostream* stream,
 //------------------------------------------------------------------------------
 LumberjackStream::~LumberjackStream()
 {
+  if(m_isNonBlocking)
+  {
+    this->finishPushes();
+  }
+
   if(m_isLJOwnedBySLIC)
   {
     this->finalizeLumberjack();
@@ -108,6 +113,14 @@ void LumberjackStream::flush()
     return;
   }
 
+  if(m_isNonBlocking)
+  {
+    // Non-collective push of messages, writing those that have arrived
+    m_lj->pushMessagesNonBlocking();
+    this->write();
+    return;
+  }
+
   // Collective push of messages to output node followed by write to console
   m_lj->pushMessagesFully();
   this->write();
@@ -122,9 +135,39 @@ void LumberjackStream::push()
     return;
   }
 
+  if(m_isNonBlocking)
+  {
+    m_lj->pushMessagesNonBlocking();
+    return;
+  }
+
   m_lj->pushMessagesOnce();
 }
 
+//------------------------------------------------------------------------------
+void LumberjackStream::setNonBlocking(bool nonBlocking)
+{
+  if(m_isNonBlocking && !nonBlocking)
+  {
+    this->finishPushes();
+  }
+  m_isNonBlocking = nonBlocking;
+}
+
+//------------------------------------------------------------------------------
+void LumberjackStream::finishPushes()
+{
+  if(m_lj == nullptr)
+  {
+    std::cerr << "ERROR: NULL Lumberjack instance in "
+              << "LumberjackStream::finishPushes!\n";
+    return;
+  }
+
+  m_lj->finishPushingMessages();
+  this->write();
+}
+
 //------------------------------------------------------------------------------
 void LumberjackStream::write(bool local)
 {
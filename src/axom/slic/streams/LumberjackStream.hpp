@@ -123,6 +123,35 @@ public:
    */
   virtual void write(bool local = false);
 
+  /*!
+   * \brief Sets whether flush() and push() wait for the other ranks.
+   *
+   * \param [in] nonBlocking If true, flush() and push() start pushing the
+   *  messages of this rank to the output node and make progress on earlier
+   *  pushes without waiting for other ranks, and flush() writes the messages
+   *  that have reached the output node so far. Default is false.
+   *
+   * \note When enabled, the remaining messages are pushed to the output node
+   *  and written by finishPushes(), which is also called by the destructor.
+   *  Destroying the stream, e.g., in slic::finalize(), and disabling the
+   *  non-blocking mode are then collective operations.
+   */
+  void setNonBlocking(bool nonBlocking);
+
+  /*!
+   * \brief Returns whether flush() and push() are non-blocking.
+   */
+  bool isNonBlocking() const { return m_isNonBlocking; }
+
+  /*!
+   * \brief Waits until the messages pushed by all ranks have reached the
+   *  output node, then writes them to the console.
+   *
+   * \collective
+   * \note This method is a collective operation.
+   */
+  void finishPushes();
+
 private:
   void initializeLumberjack(MPI_Comm comm, int ranksLimit);
   void finalizeLumberjack();
@@ -133,6 +162,7 @@ private:
   axom::lumberjack::Lumberjack* m_lj;
   axom::lumberjack::Communicator* m_ljComm;
   bool m_isLJOwnedBySLIC;
+  bool m_isNonBlocking {false};
   std::ostream* m_stream;
   /// @}
 
@@ -103,6 +103,15 @@ void check_line(const std::string& msg, int expected_line)
   EXPECT_EQ(line, expected_line);
 }
 
+//------------------------------------------------------------------------------
+int num_formatted = 0;
+
+std::string count_formatting()
+{
+  ++num_formatted;
+  return "formatted message";
+}
+
 }  // end anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -303,6 +312,69 @@ TEST(slic_macros, test_debug_macros)
   EXPECT_TRUE(slic::internal::is_stream_empty());
 }
 
+//------------------------------------------------------------------------------
+TEST(slic_macros, test_disabled_levels_skip_formatting)
+{
+  EXPECT_TRUE(slic::internal::is_stream_empty());
+  num_formatted = 0;
+
+  // messages at disabled levels are neither formatted nor logged
+  slic::setLoggingMsgLevel(slic::message::Warning);
+  EXPECT_FALSE(slic::isLevelEnabled(slic::message::Info));
+  EXPECT_FALSE(slic::isLevelEnabled(slic::message::Debug));
+  EXPECT_TRUE(slic::isLevelEnabled(slic::message::Warning));
+
+  SLIC_INFO(count_formatting());
+  SLIC_INFO_IF(true, count_formatting());
+  SLIC_DEBUG(count_formatting());
+  SLIC_DEBUG_IF(true, count_formatting());
+  EXPECT_EQ(num_formatted, 0);
+  EXPECT_TRUE(slic::internal::is_stream_empty());
+
+  // messages at enabled levels are formatted once
+  slic::setLoggingMsgLevel(slic::message::Debug);
+  EXPECT_TRUE(slic::isLevelEnabled(slic::message::Info));
+
+  SLIC_INFO(count_formatting());
+  EXPECT_EQ(num_formatted, 1);
+  check_level(slic::internal::test_stream.str(), "INFO");
+  check_msg(slic::internal::test_stream.str(), "formatted message");
+  slic::internal::clear();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_macros, test_format_string)
+{
+  std::ostringstream oss;
+  slic::GenericOutputStream stream(&oss,
+                                   "<LEVEL>|<TAG>|<MESSAGE>|<FILE>:<LINE>|"
+                                   "<RANK><unknown>|<LEVEL>\n");
+
+  stream.append(slic::message::Info,
+                "msg <FILE>",
+                "tag",
+                "file.cpp",
+                42,
+                false);
+  EXPECT_EQ(oss.str(), "INFO|tag|msg <FILE>|file.cpp:42|<unknown>|INFO\n");
+  oss.str("");
+
+  // ignored lines are left blank
+  stream.append(slic::message::Warning,
+                "msg",
+                MSG_IGNORE_TAG,
+                MSG_IGNORE_FILE,
+                MSG_IGNORE_LINE,
+                false);
+  EXPECT_EQ(oss.str(), "WARNING||msg|:|<unknown>|WARNING\n");
+  oss.str("");
+
+  // the format string can be changed after construction
+  stream.setFormatString("<<MESSAGE>>");
+  stream.append(slic::message::Info, "msg", "", "", 1, false);
+  EXPECT_EQ(oss.str(), "<msg>");
+}
+
 //------------------------------------------------------------------------------
 TEST(slic_macros, test_assert_macros)
 {
@@ -930,6 +930,85 @@ INSTANTIATE_TEST_SUITE_P(core_memory_management,
                          SlicMacrosParallel,
                          ::testing::ValuesIn(parallel_streams));
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Sums the counts of the given message in lines formatted as
+// "<MESSAGE>@<RANK>", where the rank string starts with the count
+int count_rank_messages(const std::string& output, const std::string& message)
+{
+  int count = 0;
+  std::istringstream lines(output);
+  std::string line;
+  while(std::getline(lines, line))
+  {
+    if(line.compare(0, message.size() + 1, message + "@") == 0)
+    {
+      count += std::stoi(line.substr(message.size() + 1));
+    }
+  }
+  return count;
+}
+}  // end anonymous namespace
+
+TEST(slic_macros_parallel, lumberjack_non_blocking)
+{
+  int rank = -1;
+  int nranks = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Debug);
+  slic::internal::clear_streams();
+
+  auto* stream = new slic::LumberjackStream(&slic::internal::test_stream,
+                                            MPI_COMM_WORLD,
+                                            nranks,
+                                            "<MESSAGE>@<RANK>\n");
+  stream->setNonBlocking(true);
+  EXPECT_TRUE(stream->isNonBlocking());
+  slic::addStreamToAllMsgLevels(stream);
+
+  // Flushing does not wait for other ranks, and only writes the messages that
+  // have reached the output node
+  SLIC_INFO("first message");
+  slic::flushStreams();
+  if(rank != 0)
+  {
+    EXPECT_TRUE(slic::internal::is_stream_empty());
+  }
+
+  stream->finishPushes();
+  if(rank == 0)
+  {
+    EXPECT_EQ(count_rank_messages(slic::internal::test_stream.str(),
+                                  "first message"),
+              nranks);
+  }
+  else
+  {
+    EXPECT_TRUE(slic::internal::is_stream_empty());
+  }
+  slic::internal::clear_streams();
+
+  // Finalizing finishes the remaining pushes
+  SLIC_INFO("second message");
+  slic::flushStreams();
+  slic::finalize();
+  if(rank == 0)
+  {
+    EXPECT_EQ(count_rank_messages(slic::internal::test_stream.str(),
+                                  "second message"),
+              nranks);
+  }
+  else
+  {
+    EXPECT_TRUE(slic::internal::is_stream_empty());
+  }
+  slic::internal::clear_streams();
+}
+
 int main(int argc, char* argv[])
 {
   int result = 0;
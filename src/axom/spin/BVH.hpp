@@ -21,6 +21,7 @@
 #include "axom/primal/operators/intersect.hpp"  // for detail::intersect_ray()
 
 #include "axom/spin/policy/LinearBVH.hpp"
+#include "axom/spin/policy/BinnedSAHBVH.hpp"
 
 // slic includes
 #include "axom/slic/interface/slic.hpp"  // for SLIC macros
@@ -28,6 +29,7 @@
 // C/C++ includes
 #include <type_traits>  // for std::is_floating_point(), std::is_same()
 #include <memory>
+#include <cmath>  // for sqrt()
 
 namespace axom
 {
@@ -42,9 +44,13 @@ enum BVHReturnCodes
   BVH_BUILD_OK,           //!< indicates that the BVH was generated successfully
 };
 
+/*!
+ * \brief Enumerates the available BVH construction policies.
+ */
 enum class BVHType
 {
-  LinearBVH
+  LinearBVH,  //!< parallel radix-tree build from Morton codes (default)
+  BinnedSAH   //!< top-down build with a binned surface area heuristic
 };
 
 template <typename FloatType, int NDIMS, typename ExecType, BVHType Policy>
@@ -56,6 +62,12 @@ struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::LinearBVH>
   using ImplType = policy::LinearBVH<FloatType, NDIMS, ExecType>;
 };
 
+template <typename FloatType, int NDIMS, typename ExecType>
+struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::BinnedSAH>
+{
+  using ImplType = policy::BinnedSAHBVH<FloatType, NDIMS, ExecType>;
+};
+
 /*!
  * \class BVH
  *
@@ -73,9 +85,14 @@ struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::LinearBVH>
  * \tparam NDIMS the number of dimensions, e.g., 2 or 3.
  * \tparam ExecSpace the execution space to use, e.g. SEQ_EXEC, CUDA_EXEC, etc.
  * \tparam FloatType floating precision, e.g., `double` or `float`. Optional.
+ * \tparam BVHImpl the construction policy for the BVH. Optional.
  *
- * \note The last template parameter is optional. Defaults to double precision
- *  if not specified.
+ * \note The last two template parameters are optional. Defaults to double
+ *  precision and the BVHType::LinearBVH policy if not specified.
+ *
+ * \note The BVHType::BinnedSAH policy generally produces a tighter tree,
+ *  which speeds up queries, in exchange for a slower build that runs on the
+ *  host. It is only available for host execution spaces.
  *
  * \pre The spin::BVH class requires RAJA and Umpire with CUDA_EXEC.
  *
@@ -222,6 +239,63 @@ public:
 
   bool isInitialized() const { return m_bvh != nullptr; }
 
+  /*!
+   * \brief Updates the bounding boxes of an initialized BVH, keeping the tree
+   *  topology from the last call to initialize().
+   *
+   * Refitting recomputes the bounding boxes of the BVH bins bottom-up and
+   * skips the Morton code sort and the construction of the tree, which makes
+   * it considerably cheaper than a full rebuild. This is well-suited to
+   * geometry that moves or deforms slightly between queries. However, the
+   * quality of the tree degrades as the entities move away from the spatial
+   * ordering of the initial build. Callers can monitor this with
+   * getSurfaceAreaRatio() and call initialize() again when needed.
+   *
+   * \param [in] boxes buffer consisting of the updated bounding boxes for
+   *  each entity, in the same order as supplied to initialize().
+   * \param [in] numItems the total number of items stored in the BVH.
+   *
+   * \return status set to BVH_BUILD_OK on success, or BVH_BUILD_FAILED if
+   *  the BVH has not been initialized or numItems does not match the number
+   *  of items supplied to initialize().
+   *
+   * \note The scale factor used is the current scale factor, which may
+   *  differ from the one used in the call to initialize().
+   *
+   * \pre boxes != nullptr
+   */
+  template <typename BoxIndexable>
+  int refit(const BoxIndexable boxes, IndexType numItems);
+
+  /*!
+   * \brief Returns a measure of the quality of the BVH, given by the ratio
+   *  of the summed surface areas of the internal bins to the surface area of
+   *  the root bin.
+   *
+   * \return ratio the surface area ratio, which is at least 1, or 0 if the
+   *  BVH has not been initialized.
+   *
+   * \note Smaller values indicate tighter bins and faster queries. The ratio
+   *  is mostly useful relative to its value right after initialize(); e.g., a
+   *  caller might choose to rebuild the BVH once the ratio of a refitted BVH
+   *  grows by more than some threshold over that of the initial build.
+   */
+  double getSurfaceAreaRatio() const
+  {
+    return m_bvh ? m_bvh->getSurfaceAreaRatioImpl() : 0.;
+  }
+
+  /*!
+   * \brief Returns the depth of the BVH, i.e., the largest number of
+   *  internal bins on a path from the root bin to a leaf.
+   *
+   * \return depth the depth of the BVH, or 0 if the BVH has not been
+   *  initialized.
+   *
+   * \note The depth is less than 64, the size of the traversal stack.
+   */
+  int getDepth() const { return m_bvh ? m_bvh->getDepthImpl() : 0; }
+
   /*!
    * \brief Sets the ID of the allocator used by the BVH.
    * \param [in] allocatorID the ID of the allocator to use in BVH construction
@@ -371,6 +445,93 @@ public:
                          IndexType numBoxes,
                          BoxIndexable boxes) const;
 
+  /// \name Batched Queries
+  ///
+  /// \brief Variants of findPoints(), findRays() and findBoundingBoxes()
+  ///  that bound the memory used for the output candidates.
+  ///
+  /// Rather than returning all candidates in one array, the queries are
+  /// processed in batches of at most batchSize (query, candidate) pairs.
+  /// After each batch is generated, the supplied functor is invoked on the
+  /// host with two views of equal size:
+  ///
+  /// \code
+  ///   onBatch(axom::ArrayView<const IndexType> queryIds,
+  ///           axom::ArrayView<const IndexType> candidateIds);
+  /// \endcode
+  ///
+  /// where the ith pair is (queryIds[ i ], candidateIds[ i ]). The views
+  /// are allocated with the BVH's allocator and are only valid for the
+  /// duration of the call. The pairs of a query are never split across
+  /// batches, so a query with more than batchSize candidates forms a batch
+  /// of its own. Batches without any candidates are skipped.
+  ///
+  /// \note Peak memory is O( numQueries + max(batchSize, max count) ),
+  ///  rather than O( total number of candidates ), at the cost of an extra
+  ///  traversal pass to count the candidates of each query.
+  ///
+  /// \pre batchSize > 0
+  ///
+  /// @{
+
+  template <typename PointIndexable, typename BatchFunc>
+  void findPointsBatched(IndexType numPts,
+                         PointIndexable points,
+                         IndexType batchSize,
+                         BatchFunc&& onBatch) const;
+
+  template <typename RayIndexable, typename BatchFunc>
+  void findRaysBatched(IndexType numRays,
+                       RayIndexable rays,
+                       IndexType batchSize,
+                       BatchFunc&& onBatch) const;
+
+  template <typename BoxIndexable, typename BatchFunc>
+  void findBoundingBoxesBatched(IndexType numBoxes,
+                                BoxIndexable boxes,
+                                IndexType batchSize,
+                                BatchFunc&& onBatch) const;
+
+  /// @}
+
+  /*!
+   * \brief Finds the k nearest bins to each of the given query points.
+   *
+   * \param [in]  k the number of nearest neighbors to find per query point
+   * \param [out] offsets offset to the candidates array for each query point
+   * \param [out] counts stores the number of neighbors found per query point
+   * \param [out] candidates array of the neighbor IDs for each query point
+   * \param [out] distances array of distances to each neighbor
+   * \param [in]  numPts the total number of query points supplied
+   * \param [in]  points array of points to query against the BVH
+   *
+   * \note The distance to a neighbor is measured to its (scaled) bounding box,
+   *  so it is exact for point data and a lower bound for extended entities.
+   *  Unlike findPoints(), the traversal is best-first and prunes all bins
+   *  that are farther than the current k-th nearest neighbor.
+   *
+   * \note Upon completion, the ith query point has:
+   *  * counts[ i ] neighbors, with counts[ i ] < k only if the BVH holds
+   *    fewer than k entities
+   *  * Stored in the candidates and distances arrays, sorted by increasing
+   *    distance, in the range [ offsets[ i ], offsets[ i ]+counts[ i ] ]
+   *  * The candidates and distances arrays have k * numPts entries; unused
+   *    slots are set to -1 and to the maximum floating point value.
+   *
+   * \pre k > 0
+   * \pre offsets.size() == numPts
+   * \pre counts.size()  == numPts
+   * \pre points != nullptr
+   */
+  template <typename PointIndexable>
+  void findNearestNeighbors(int k,
+                            axom::ArrayView<IndexType> offsets,
+                            axom::ArrayView<IndexType> counts,
+                            axom::Array<IndexType>& candidates,
+                            axom::Array<FloatType>& distances,
+                            IndexType numPts,
+                            PointIndexable points) const;
+
   /*!
    * \brief Writes the BVH to the specified VTK file for visualization.
    * \param [in] fileName the name of VTK file.
@@ -379,6 +540,16 @@ public:
   void writeVtkFile(const std::string& fileName) const;
 
 private:
+  /*!
+   * \brief Copies the boxes into a padded buffer of two boxes when fewer than
+   *  two boxes are supplied, since the BVH requires at least two leaves.
+   *
+   * \return a buffer allocated with the BVH's allocator that the caller must
+   *  deallocate, or nullptr if numBoxes > 1 and no padding is needed.
+   */
+  template <typename BoxIndexable>
+  BoxType* padBoxes(const BoxIndexable boxes, IndexType numBoxes) const;
+
   /// \name Private Members
   /// @{
   static constexpr FloatType DEFAULT_SCALE_FACTOR = 1.000123;
@@ -386,6 +557,7 @@ private:
     axom::numerics::floating_point_limits<FloatType>::epsilon();
 
   int m_AllocatorID;
+  IndexType m_numItems {0};
   FloatType m_tolerance {DEFAULT_TOLERANCE};
   FloatType m_scaleFactor {DEFAULT_SCALE_FACTOR};
   std::unique_ptr<ImplType> m_bvh {};
@@ -414,44 +586,93 @@ int BVH<NDIMS, ExecSpace, FloatType, Impl>::initialize(const BoxIndexable boxes,
   // STEP 1: Allocate a BVH, potentially deleting the existing BVH if it exists
   m_bvh.reset(new ImplType);
 
-  // STEP 1: Handle case when user supplied 0 or 1 bounding boxes.
-  BoxType* boxesptr = nullptr;
-  if(numBoxes <= 1)
+  // STEP 2: Handle case when user supplied 0 or 1 bounding boxes.
+  BoxType* boxesptr = padBoxes(boxes, numBoxes);
+  if(boxesptr)
   {
-    const bool copyFirst = numBoxes == 1;
-    numBoxes = 2;
-    boxesptr = axom::allocate<BoxType>(numBoxes, m_AllocatorID);
-
-    // copy first box and add a fake 2nd box
-    for_all<ExecSpace>(
-      2,
-      AXOM_LAMBDA(IndexType i) {
-        if(copyFirst && i == 0)
-        {
-          boxesptr[i] = boxes[i];
-        }
-        else
-        {
-          BoxType empty_box;
-          // Make the box invalid.
-          empty_box.clear();
-          boxesptr[i] = empty_box;
-        }
-      });
-    m_bvh->buildImpl(boxesptr, numBoxes, m_scaleFactor, m_AllocatorID);
+    m_bvh->buildImpl(boxesptr, 2, m_scaleFactor, m_AllocatorID);
+
+    // STEP 3: deallocate boxesptr if user supplied a single box
+    axom::deallocate(boxesptr);
   }
   else
   {
     m_bvh->buildImpl(boxes, numBoxes, m_scaleFactor, m_AllocatorID);
   }
 
-  // STEP 5: deallocate boxesptr if user supplied a single box
+  m_numItems = numBoxes;
+
+  return BVH_BUILD_OK;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename BoxIndexable>
+int BVH<NDIMS, ExecSpace, FloatType, Impl>::refit(const BoxIndexable boxes,
+                                                  IndexType numBoxes)
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::refit");
+
+  using IterBase = typename IteratorTraits<BoxIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::BoundingBox.
+  static_assert(
+    std::is_convertible<IterBase, BoxType>::value,
+    "Iterator must return objects convertible to primal::BoundingBox.");
+
+  if(m_bvh == nullptr || numBoxes != m_numItems)
+  {
+    return BVH_BUILD_FAILED;
+  }
+
+  bool refitOK = false;
+  BoxType* boxesptr = padBoxes(boxes, numBoxes);
   if(boxesptr)
   {
-    SLIC_ASSERT(boxesptr != nullptr);
+    refitOK = m_bvh->refitImpl(boxesptr, 2, m_scaleFactor, m_AllocatorID);
     axom::deallocate(boxesptr);
   }
-  return BVH_BUILD_OK;
+  else
+  {
+    refitOK = m_bvh->refitImpl(boxes, numBoxes, m_scaleFactor, m_AllocatorID);
+  }
+
+  return refitOK ? BVH_BUILD_OK : BVH_BUILD_FAILED;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename BoxIndexable>
+typename BVH<NDIMS, ExecSpace, FloatType, Impl>::BoxType*
+BVH<NDIMS, ExecSpace, FloatType, Impl>::padBoxes(const BoxIndexable boxes,
+                                                 IndexType numBoxes) const
+{
+  if(numBoxes > 1)
+  {
+    return nullptr;
+  }
+
+  const bool copyFirst = numBoxes == 1;
+  BoxType* boxesptr = axom::allocate<BoxType>(2, m_AllocatorID);
+
+  // copy first box and add a fake 2nd box
+  for_all<ExecSpace>(
+    2,
+    AXOM_LAMBDA(IndexType i) {
+      if(copyFirst && i == 0)
+      {
+        boxesptr[i] = boxes[i];
+      }
+      else
+      {
+        BoxType empty_box;
+        // Make the box invalid.
+        empty_box.clear();
+        boxesptr[i] = empty_box;
+      }
+    });
+
+  return boxesptr;
 }
 
 //------------------------------------------------------------------------------
@@ -560,6 +781,161 @@ void BVH<NDIMS, ExecSpace, FloatType, Impl>::findBoundingBoxes(
                                                            m_AllocatorID);
 }
 
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename PointIndexable, typename BatchFunc>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::findPointsBatched(
+  IndexType numPts,
+  PointIndexable pts,
+  IndexType batchSize,
+  BatchFunc&& onBatch) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::findPointsBatched");
+
+  using IterBase = typename IteratorTraits<PointIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::Point.
+  static_assert(std::is_convertible<IterBase, PointType>::value,
+                "Iterator must return objects convertible to primal::Point.");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+
+  // Define traversal predicates
+  auto predicate = [=] AXOM_HOST_DEVICE(const PointType& p,
+                                        const BoxType& bb) -> bool {
+    return bb.contains(p);
+  };
+
+  m_bvh->template findCandidatesBatchedImpl<PointType>(
+    predicate,
+    numPts,
+    pts,
+    batchSize,
+    std::forward<BatchFunc>(onBatch),
+    m_AllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename RayIndexable, typename BatchFunc>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::findRaysBatched(
+  IndexType numRays,
+  RayIndexable rays,
+  IndexType batchSize,
+  BatchFunc&& onBatch) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::findRaysBatched");
+
+  using IterBase = typename IteratorTraits<RayIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::Ray.
+  static_assert(std::is_convertible<IterBase, RayType>::value,
+                "Iterator must return objects convertible to primal::Ray.");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+
+  const FloatType TOL = m_tolerance;
+
+  // Define traversal predicates
+  auto predicate = [=] AXOM_HOST_DEVICE(const RayType& r,
+                                        const BoxType& bb) -> bool {
+    primal::Point<FloatType, NDIMS> tmp;
+    return primal::detail::intersect_ray(r, bb, tmp, TOL);
+  };
+
+  m_bvh->template findCandidatesBatchedImpl<RayType>(
+    predicate,
+    numRays,
+    rays,
+    batchSize,
+    std::forward<BatchFunc>(onBatch),
+    m_AllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename BoxIndexable, typename BatchFunc>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::findBoundingBoxesBatched(
+  IndexType numBoxes,
+  BoxIndexable boxes,
+  IndexType batchSize,
+  BatchFunc&& onBatch) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::findBoundingBoxesBatched");
+
+  using IterBase = typename IteratorTraits<BoxIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::BoundingBox.
+  static_assert(
+    std::is_convertible<IterBase, BoxType>::value,
+    "Iterator must return objects convertible to primal::BoundingBox.");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+
+  // Define traversal predicates
+  auto predicate = [=] AXOM_HOST_DEVICE(const BoxType& bb1,
+                                        const BoxType& bb2) -> bool {
+    return bb1.intersectsWith(bb2);
+  };
+
+  m_bvh->template findCandidatesBatchedImpl<BoxType>(
+    predicate,
+    numBoxes,
+    boxes,
+    batchSize,
+    std::forward<BatchFunc>(onBatch),
+    m_AllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename PointIndexable>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::findNearestNeighbors(
+  int k,
+  axom::ArrayView<IndexType> offsets,
+  axom::ArrayView<IndexType> counts,
+  axom::Array<IndexType>& candidates,
+  axom::Array<FloatType>& distances,
+  IndexType numPts,
+  PointIndexable pts) const
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::findNearestNeighbors");
+
+  using IterBase = typename IteratorTraits<PointIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::Point.
+  static_assert(std::is_convertible<IterBase, PointType>::value,
+                "Iterator must return objects convertible to primal::Point.");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+  SLIC_ERROR_IF(k <= 0, "number of nearest neighbors must be positive");
+
+  const IndexType totalSize = k * numPts;
+  candidates = axom::Array<IndexType>(totalSize, totalSize, m_AllocatorID);
+  distances = axom::Array<FloatType>(totalSize, totalSize, m_AllocatorID);
+
+  const auto distances_v = distances.view();
+  m_bvh->template findNearestNeighborsImpl<PointType>(k,
+                                                      offsets,
+                                                      counts,
+                                                      candidates.view(),
+                                                      distances_v,
+                                                      numPts,
+                                                      pts);
+
+  // traversal works with squared distances; convert them in place
+  constexpr FloatType MAX_DIST =
+    axom::numerics::floating_point_limits<FloatType>::max();
+  for_all<ExecSpace>(
+    totalSize,
+    AXOM_LAMBDA(IndexType i) {
+      if(distances_v[i] < MAX_DIST)
+      {
+        distances_v[i] = sqrt(distances_v[i]);
+      }
+    });
+}
+
 //------------------------------------------------------------------------------
 template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
 void BVH<NDIMS, ExecSpace, FloatType, Impl>::writeVtkFile(
@@ -337,12 +337,12 @@ public:
   /** \brief Const access to data associated with the entire brood */
   const BroodData& getBroodData(const GridPt& pt) const
   {
-    SLIC_ASSERT_MSG(hasBlock(pt),
-                    "(" << pt << ", " << this->m_level
-                        << ") was not a block in the tree at level.");
-
     // Note: Using find() method on hashmap since operator[] is non-const
     ConstMapIter blockIt = m_map.find(BroodTraits::convertPoint(pt));
+    SLIC_ASSERT_MSG(blockIt != m_map.end(),
+                    "The children of (" << pt << ", " << this->m_level - 1
+                                        << ") are not blocks in the tree.");
+
     return blockIt->second;
   }
 
@@ -0,0 +1,237 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*! \file spin_bvh_sah_benchmark.cpp
+ *  \brief This example compares the construction policies of the BVH class
+ *   in Axom's spin component.
+ *
+ *  The bounding boxes of the triangles of an STL mesh are inserted into a BVH
+ *  built with the default LinearBVH policy and with the BinnedSAH policy.
+ *  For each policy, the example reports the build time, the surface area
+ *  ratio of the tree and the time and number of visited bins for a batch of
+ *  random ray queries through the mesh.
+ */
+
+// Axom includes
+#include "axom/core.hpp"
+#include "axom/mint.hpp"
+#include "axom/primal.hpp"
+#include "axom/spin.hpp"
+#include "axom/slic.hpp"
+#include "axom/quest.hpp"
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+
+namespace mint = axom::mint;
+namespace primal = axom::primal;
+namespace spin = axom::spin;
+namespace slic = axom::slic;
+
+using IndexType = axom::IndexType;
+using UMesh = mint::UnstructuredMesh<mint::SINGLE_SHAPE>;
+
+using PointType = primal::Point<double, 3>;
+using VectorType = primal::Vector<double, 3>;
+using BoxType = primal::BoundingBox<double, 3>;
+using RayType = primal::Ray<double, 3>;
+
+//------------------------------------------------------------------------------
+void initialize_logger()
+{
+  // initialize logger
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+
+  // setup the logstreams
+  std::string fmt = "";
+  slic::LogStream* logStream = nullptr;
+
+  fmt = "[<LEVEL>]: <MESSAGE>\n";
+  logStream = new slic::GenericOutputStream(&std::cout, fmt);
+
+  // register stream objects with the logger
+  slic::addStreamToAllMsgLevels(logStream);
+}
+
+//------------------------------------------------------------------------------
+void finalize_logger()
+{
+  slic::flushStreams();
+  slic::finalize();
+}
+
+/*!
+ * \brief Generates rays from random points on a sphere around the given
+ *  bounding box towards random points inside the box.
+ */
+axom::Array<RayType> generate_rays(const BoxType& bounds, IndexType numRays)
+{
+  constexpr unsigned int SEED = 42;
+
+  const PointType center = bounds.getCentroid();
+  const double radius = bounds.range().norm();
+
+  axom::Array<RayType> rays(numRays);
+  for(IndexType i = 0; i < numRays; ++i)
+  {
+    PointType origin, target;
+    VectorType dir;
+    for(int d = 0; d < 3; ++d)
+    {
+      dir[d] = axom::utilities::random_real(-1., 1., SEED);
+      target[d] = axom::utilities::random_real(bounds.getMin()[d],
+                                               bounds.getMax()[d],
+                                               SEED);
+    }
+    dir = dir.unitVector();
+    for(int d = 0; d < 3; ++d)
+    {
+      origin[d] = center[d] + radius * dir[d];
+    }
+    rays[i] = RayType(origin, VectorType(origin, target));
+  }
+  return rays;
+}
+
+/*!
+ * \brief Builds a BVH with the given policy over the supplied boxes and runs
+ *  the ray queries through its traverser, logging the timings and the
+ *  number of bins that were visited.
+ */
+template <spin::BVHType BVHImpl>
+void run_benchmark(const std::string& name,
+                   const axom::Array<BoxType>& boxes,
+                   const axom::Array<RayType>& rays)
+{
+  spin::BVH<3, axom::SEQ_EXEC, double, BVHImpl> bvh;
+
+  axom::utilities::Timer timer(true);
+  bvh.initialize(boxes.view(), boxes.size());
+  timer.stop();
+  const double buildTime = timer.elapsed();
+
+  const auto traverser = bvh.getTraverser();
+
+  IndexType numVisited = 0;
+  IndexType numCandidates = 0;
+
+  // Count each bin that is tested against the ray, and each leaf reached
+  auto rayIsect = [&](const RayType& ray, const BoxType& bin) -> bool {
+    ++numVisited;
+    PointType ip;
+    return primal::intersect(ray, bin, ip);
+  };
+  auto countCandidates = [&](axom::int32 currentNode,
+                             const axom::int32* leafNodes) {
+    AXOM_UNUSED_VAR(currentNode);
+    AXOM_UNUSED_VAR(leafNodes);
+    ++numCandidates;
+  };
+
+  timer.start();
+  for(const RayType& ray : rays)
+  {
+    traverser.traverse_tree(ray, countCandidates, rayIsect);
+  }
+  timer.stop();
+  const double queryTime = timer.elapsed();
+
+  SLIC_INFO(axom::fmt::format(
+    "{:>10}: build {:.4f}s, SA ratio {:.2f}, query {:.4f}s, "
+    "{:.1f} bins and {:.1f} candidates per ray",
+    name,
+    buildTime,
+    bvh.getSurfaceAreaRatio(),
+    queryTime,
+    static_cast<double>(numVisited) / rays.size(),
+    static_cast<double>(numCandidates) / rays.size()));
+}
+
+struct Arguments
+{
+  std::string file_name;
+  IndexType num_rays {100000};
+
+  void parse(int argc, char** argv, axom::CLI::App& app)
+  {
+    app
+      .add_option("-f,--file", this->file_name, "specifies the input mesh file")
+      ->check(axom::CLI::ExistingFile)
+      ->required();
+
+    app.add_option("-r,--rays", this->num_rays, "number of ray queries")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.get_formatter()->column_width(40);
+
+    // could throw an exception
+    app.parse(argc, argv);
+
+    slic::flushStreams();
+  }
+};
+
+int main(int argc, char** argv)
+{
+  initialize_logger();
+  Arguments args;
+  axom::CLI::App app {"Compares the LinearBVH and BinnedSAH BVH policies"};
+
+  try
+  {
+    args.parse(argc, argv, app);
+  }
+  catch(const axom::CLI::ParseError& e)
+  {
+    int retval = -1;
+    retval = app.exit(e);
+    finalize_logger();
+    return retval;
+  }
+
+  std::unique_ptr<UMesh> surface_mesh;
+
+  // Read file
+  SLIC_INFO("Reading file: '" << args.file_name << "'...\n");
+  {
+    axom::quest::STLReader reader;
+    reader.setFileName(args.file_name);
+    reader.read();
+
+    // Get surface mesh
+    surface_mesh.reset(new UMesh(3, mint::TRIANGLE));
+    reader.getMesh(surface_mesh.get());
+  }
+
+  const IndexType ncells = surface_mesh->getNumberOfCells();
+  SLIC_INFO("Mesh has " << surface_mesh->getNumberOfNodes() << " vertices and "
+                        << ncells << " triangles.");
+
+  // Generate the bounding box of each triangle
+  BoxType meshBounds;
+  axom::Array<BoxType> boxes(ncells);
+  for(IndexType icell = 0; icell < ncells; ++icell)
+  {
+    IndexType nodeIds[3];
+    surface_mesh->getCellNodeIDs(icell, nodeIds);
+    for(int inode = 0; inode < 3; ++inode)
+    {
+      PointType vtx;
+      surface_mesh->getNode(nodeIds[inode], vtx.data());
+      boxes[icell].addPoint(vtx);
+    }
+    meshBounds.addBox(boxes[icell]);
+  }
+
+  axom::Array<RayType> rays = generate_rays(meshBounds, args.num_rays);
+
+  run_benchmark<spin::BVHType::LinearBVH>("LinearBVH", boxes, rays);
+  run_benchmark<spin::BVHType::BinnedSAH>("BinnedSAH", boxes, rays);
+
+  finalize_logger();
+  return 0;
+}
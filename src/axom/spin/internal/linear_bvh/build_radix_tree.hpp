@@ -626,6 +626,51 @@ void build_radix_tree(const BoxIndexable boxes,
   propagate_aabbs<ExecSpace>(radix_tree, allocatorID);
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename BoxIndexable, typename FloatType, int NDIMS>
+void refit_radix_tree(const BoxIndexable boxes,
+                      int size,
+                      const ArrayView<const int32> leafs,
+                      primal::BoundingBox<FloatType, NDIMS>& bounds,
+                      RadixTree<FloatType, NDIMS>& radix_tree,
+                      FloatType scale_factor,
+                      int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("refit_radix_tree");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  // sanity checks
+  SLIC_ASSERT(size == radix_tree.m_size);
+  SLIC_ASSERT(leafs.size() == size);
+
+  const int32 inner_size = radix_tree.m_inner_size;
+  radix_tree.m_leaf_aabbs =
+    axom::Array<BoxType>(ArrayOptions::Uninitialized {}, size, size, allocatorID);
+  radix_tree.m_inner_aabbs = axom::Array<BoxType>(ArrayOptions::Uninitialized {},
+                                                  inner_size,
+                                                  inner_size,
+                                                  allocatorID);
+
+  // gather the boxes in the morton order from the original build
+  const auto leaf_aabbs = radix_tree.m_leaf_aabbs.view();
+  for_all<ExecSpace>(
+    size,
+    AXOM_LAMBDA(int32 i) {
+      BoxType aabb = boxes[leafs[i]];
+
+      aabb.scale(scale_factor);
+
+      leaf_aabbs[i] = aabb;
+    });
+
+  // evaluate global bounds
+  bounds = reduce<ExecSpace, FloatType, NDIMS>(radix_tree.m_leaf_aabbs, size);
+
+  // the topology is unchanged, so only the internal aabbs need updating
+  propagate_aabbs<ExecSpace>(radix_tree, allocatorID);
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
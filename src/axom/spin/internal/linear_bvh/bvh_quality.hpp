@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BVH_QUALITY_HPP_
+#define AXOM_SPIN_BVH_QUALITY_HPP_
+
+#include "axom/config.hpp"  // for axom compile-time definitions
+
+#include "axom/core/Array.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"  // for leaf_node()
+
+// C/C++ includes
+#include <utility>  // for std::pair
+#include <vector>   // for std::vector
+
+#if defined(AXOM_USE_RAJA)
+  // RAJA includes
+  #include "RAJA/RAJA.hpp"
+#endif
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Returns the surface area of the given box, or zero if it is invalid.
+ *
+ * \note In 2D, this is the perimeter of the box.
+ */
+template <typename FloatType, int NDIMS>
+AXOM_HOST_DEVICE inline double surface_area(
+  const primal::BoundingBox<FloatType, NDIMS>& box)
+{
+  if(!box.isValid())
+  {
+    return 0.;
+  }
+
+  const auto range = box.range();
+  if(NDIMS == 2)
+  {
+    return 2. * (range[0] + range[1]);
+  }
+
+  double area = 0.;
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    const int j = (i + 1) % NDIMS;
+    area += 2. * range[i] * range[j];
+  }
+  return area;
+}
+
+/*!
+ * \brief Computes the ratio of the summed surface areas of all internal
+ *  nodes of a BVH to the surface area of its root.
+ *
+ * \param [in] inner_nodes the bounding boxes of the child nodes of each
+ *  internal node, in the layout used by bvh_traverse()
+ * \param [in] inner_node_children the child indices of each internal node
+ * \param [in] bounds the bounding box of the root node
+ *
+ * \return ratio the surface area ratio, which is at least 1. This is the
+ *  expected number of internal nodes visited by a random ray, up to a
+ *  constant, under the surface area heuristic (SAH); smaller is better.
+ *
+ * \note Leaf boxes are not included since they do not depend on the tree
+ *  topology. The ratio is typically used to compare a BVH against itself,
+ *  e.g., to detect the degradation of a refitted tree relative to a rebuild.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+double surface_area_ratio(
+  ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  ArrayView<const int32> inner_node_children,
+  const primal::BoundingBox<FloatType, NDIMS>& bounds)
+{
+  AXOM_PERF_MARK_FUNCTION("surface_area_ratio");
+
+  const double root_area = surface_area(bounds);
+  if(root_area <= 0.)
+  {
+    return 1.;
+  }
+
+  const IndexType size = inner_nodes.size();
+
+#ifdef AXOM_USE_RAJA
+  using reduce_policy = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_policy, double> sum_areas(0.);
+
+  for_all<ExecSpace>(
+    size,
+    AXOM_LAMBDA(IndexType i) {
+      if(!leaf_node(inner_node_children[i]))
+      {
+        sum_areas += surface_area(inner_nodes[i]);
+      }
+    });
+
+  return 1. + sum_areas.get() / root_area;
+#else
+  static_assert(std::is_same<ExecSpace, SEQ_EXEC>::value,
+                "Only SEQ_EXEC supported without RAJA");
+
+  double sum_areas = 0.;
+  for_all<ExecSpace>(size, [&](IndexType i) {
+    if(!leaf_node(inner_node_children[i]))
+    {
+      sum_areas += surface_area(inner_nodes[i]);
+    }
+  });
+
+  return 1. + sum_areas / root_area;
+#endif
+}
+
+/*!
+ * \brief Computes the depth of a BVH, i.e., the largest number of internal
+ *  nodes on a path from the root to a leaf.
+ *
+ * \param [in] inner_node_children the child indices of each internal node,
+ *  in the layout used by bvh_traverse()
+ *
+ * \note The traversal routines use a fixed-size stack, which requires the
+ *  depth of the BVH to be less than 64.
+ */
+template <typename ExecSpace>
+int tree_depth(const axom::Array<int32>& inner_node_children)
+{
+  AXOM_PERF_MARK_FUNCTION("tree_depth");
+
+  if(inner_node_children.empty())
+  {
+    return 0;
+  }
+
+  // The children are inspected on the host
+  axom::Array<int32> host_children;
+  axom::ArrayView<const int32> children = inner_node_children.view();
+  if(axom::execution_space<ExecSpace>::onDevice())
+  {
+    const int hostAllocatorID =
+      axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+    host_children = axom::Array<int32>(inner_node_children, hostAllocatorID);
+    children = host_children.view();
+  }
+
+  int max_depth = 0;
+  std::vector<std::pair<int32, int>> todo {{0, 1}};
+  while(!todo.empty())
+  {
+    const int32 node = todo.back().first;
+    const int depth = todo.back().second;
+    todo.pop_back();
+
+    max_depth = axom::utilities::max(max_depth, depth);
+    for(int side = 0; side < 2; ++side)
+    {
+      const int32 child = children[node + side];
+      if(!leaf_node(child))
+      {
+        todo.emplace_back(child, depth + 1);
+      }
+    }
+  }
+  return max_depth;
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BVH_QUALITY_HPP_ */
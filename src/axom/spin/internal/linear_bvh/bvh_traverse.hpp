@@ -11,6 +11,8 @@
 #include "axom/core/Types.hpp"   // for axom types
 #include "axom/slic.hpp"         // for SLIC macros
 
+#include <utility>  // for std::declval
+
 namespace axom
 {
 namespace spin
@@ -158,6 +160,268 @@ AXOM_HOST_DEVICE inline void bvh_traverse(
   }  // END while
 }
 
+/*!
+ * \brief BVH traversal routine for nearest-neighbor style searches.
+ *
+ * Unlike bvh_traverse(), which descends into every bin that satisfies a
+ * boolean predicate, this routine computes a (squared) distance from the
+ * query primitive to each bin and visits the bins in near-to-far order,
+ * pruning every bin whose distance is not strictly less than the current
+ * search radius.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] p the primitive in query, e.g., a point.
+ * \param [in] D functor that computes the distance to a bin
+ * \param [in] A functor that defines the leaf action
+ * \param [in] R functor that returns the current search radius
+ *
+ * \note The supplied functor `D` is expected to take the primitive, p, and a
+ *  primal::BoundingBox< FloatType, NDIMS > of the BVH bin and return a
+ *  lower bound of the distance from p to any entity within the bin.
+ *
+ * \note The supplied functor `A` is expected to take the following three
+ *  arguments:
+ *    (1) The index of the leaf node
+ *    (2) A pointer to the leaf node IDs
+ *    (3) The distance to the leaf bin, as computed by `D`
+ *  It is only invoked for leaves whose distance is less than the current
+ *  search radius and will typically shrink the radius returned by `R`.
+ *
+ * \note The search radius functor `R` takes no arguments and is re-evaluated
+ *  each time a bin is considered, allowing the leaf action to tighten the
+ *  bound as the traversal proceeds.
+ *
+ * \note Functors D, A and R may access only memory available in the
+ *  execution space.
+ */
+template <int NDIMS,
+          typename FloatType,
+          typename PrimitiveType,
+          typename DistanceFunc,
+          typename LeafAction,
+          typename RadiusFunc>
+AXOM_HOST_DEVICE inline void bvh_traverse_nearest(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  axom::ArrayView<const int32> inner_node_children,
+  axom::ArrayView<const int32> leaf_nodes,
+  const PrimitiveType& p,
+  DistanceFunc&& D,
+  LeafAction&& A,
+  RadiusFunc&& R)
+{
+  using BBoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using DistType = decltype(D(p, std::declval<const BBoxType&>()));
+
+  // setup stack of inner nodes along with their distance to the query
+  constexpr int32 STACK_SIZE = 64;
+  int32 todo[STACK_SIZE];
+  DistType todo_dist[STACK_SIZE];
+  int32 stackptr = 0;
+
+  todo[stackptr] = 0;
+  todo_dist[stackptr] = DistType {0};
+  stackptr++;
+
+  while(stackptr > 0)
+  {
+    stackptr--;
+    const int32 current_node = todo[stackptr];
+    if(!(todo_dist[stackptr] < R()))
+    {
+      // bin was pushed before the search radius shrank past it
+      continue;
+    }
+
+    int32 child[2];
+    DistType dist[2];
+    bool valid[2];
+    for(int32 j = 0; j < 2; ++j)
+    {
+      const BBoxType& bin = inner_nodes[current_node + j];
+      child[j] = inner_node_children[current_node + j];
+      valid[j] = bin.isValid();
+      dist[j] = valid[j] ? D(p, bin) : DistType {0};
+    }
+
+    // visit the nearer child first
+    const int32 near = (valid[1] && (!valid[0] || dist[1] < dist[0])) ? 1 : 0;
+    const int32 far = 1 - near;
+
+    // process leaves right away, in near-to-far order
+    if(valid[near] && leaf_node(child[near]) && dist[near] < R())
+    {
+      A(-child[near] - 1, leaf_nodes.data(), dist[near]);
+    }
+    if(valid[far] && leaf_node(child[far]) && dist[far] < R())
+    {
+      A(-child[far] - 1, leaf_nodes.data(), dist[far]);
+    }
+
+    // push inner nodes, far first, so that the near child is popped next
+    if(valid[far] && !leaf_node(child[far]) && dist[far] < R())
+    {
+      todo[stackptr] = child[far];
+      todo_dist[stackptr] = dist[far];
+      stackptr++;
+    }
+    if(valid[near] && !leaf_node(child[near]) && dist[near] < R())
+    {
+      todo[stackptr] = child[near];
+      todo_dist[stackptr] = dist[near];
+      stackptr++;
+    }
+  }  // END while
+}
+
+/*!
+ * \brief BVH traversal routine for hierarchical approximations, e.g., in
+ *  the style of Barnes-Hut.
+ *
+ * Visits the bins of the BVH depth-first. Each valid bin is first passed to
+ * the functor `V`, which may account for all of the bin's contents at once,
+ * e.g., with a far-field approximation, and return true to skip them.
+ * Otherwise, the traversal descends into the bin, or invokes the leaf action
+ * `A` if the bin is a leaf.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] p the primitive in query, e.g., a point.
+ * \param [in] V functor that visits each bin before its contents
+ * \param [in] A functor that defines the leaf action
+ *
+ * \note The supplied functor `V` is expected to take the following three
+ *  arguments:
+ *    (1) The supplied primitive, p
+ *    (2) a primal::BoundingBox< FloatType, NDIMS > of the BVH bin
+ *    (3) The index of the bin, in [0, inner_nodes.size())
+ *  and to return true if the contents of the bin should be skipped.
+ *
+ * \note The supplied functor `A` takes the same arguments as the leaf action
+ *  of bvh_traverse().
+ *
+ * \note Functors V and A may access only memory available in the execution
+ *  space.
+ */
+template <int NDIMS,
+          typename FloatType,
+          typename PrimitiveType,
+          typename BinVisitor,
+          typename LeafAction>
+AXOM_HOST_DEVICE inline void bvh_traverse_approximate(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  axom::ArrayView<const int32> inner_node_children,
+  axom::ArrayView<const int32> leaf_nodes,
+  const PrimitiveType& p,
+  BinVisitor&& V,
+  LeafAction&& A)
+{
+  using BBoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  // setup stack of inner nodes
+  constexpr int32 STACK_SIZE = 64;
+  int32 todo[STACK_SIZE];
+  int32 stackptr = 0;
+
+  todo[stackptr] = 0;
+  stackptr++;
+
+  while(stackptr > 0)
+  {
+    stackptr--;
+    const int32 current_node = todo[stackptr];
+
+    for(int32 j = 0; j < 2; ++j)
+    {
+      const int32 bin = current_node + j;
+      const BBoxType& bbox = inner_nodes[bin];
+      if(!bbox.isValid() || V(p, bbox, bin))
+      {
+        continue;
+      }
+
+      const int32 child = inner_node_children[bin];
+      if(leaf_node(child))
+      {
+        A(-child - 1, leaf_nodes.data());
+      }
+      else
+      {
+        SLIC_ASSERT(stackptr < STACK_SIZE);
+        todo[stackptr] = child;
+        stackptr++;
+      }
+    }
+  }  // END while
+}
+
+/*!
+ * \brief Invokes the leaf action on every leaf contained in a bin of the BVH.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] bin the index of the bin, in [0, inner_nodes.size())
+ * \param [in] A functor that defines the leaf action, which takes the same
+ *  arguments as the leaf action of bvh_traverse().
+ */
+template <int NDIMS, typename FloatType, typename LeafAction>
+AXOM_HOST_DEVICE inline void bvh_traverse_bin_leaves(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  axom::ArrayView<const int32> inner_node_children,
+  axom::ArrayView<const int32> leaf_nodes,
+  int32 bin,
+  LeafAction&& A)
+{
+  if(!inner_nodes[bin].isValid())
+  {
+    return;
+  }
+
+  const int32 child = inner_node_children[bin];
+  if(leaf_node(child))
+  {
+    A(-child - 1, leaf_nodes.data());
+    return;
+  }
+
+  // the bin is an inner node; visit its subtree
+  constexpr int32 STACK_SIZE = 64;
+  int32 todo[STACK_SIZE];
+  int32 stackptr = 0;
+
+  todo[stackptr] = child;
+  stackptr++;
+
+  while(stackptr > 0)
+  {
+    stackptr--;
+    const int32 current_node = todo[stackptr];
+
+    for(int32 j = 0; j < 2; ++j)
+    {
+      if(!inner_nodes[current_node + j].isValid())
+      {
+        continue;
+      }
+
+      const int32 grandchild = inner_node_children[current_node + j];
+      if(leaf_node(grandchild))
+      {
+        A(-grandchild - 1, leaf_nodes.data());
+      }
+      else
+      {
+        SLIC_ASSERT(stackptr < STACK_SIZE);
+        todo[stackptr] = grandchild;
+        stackptr++;
+      }
+    }
+  }  // END while
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
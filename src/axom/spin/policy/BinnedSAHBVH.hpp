@@ -0,0 +1,467 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_POLICY_BINNEDSAHBVH_HPP_
+#define AXOM_SPIN_POLICY_BINNEDSAHBVH_HPP_
+
+// axom core includes
+#include "axom/core/Types.hpp"              // for fixed bitwidth types
+#include "axom/core/execution/for_all.hpp"  // for generic for_all()
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+
+#include "axom/spin/policy/LinearBVH.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_quality.hpp"
+
+#include "axom/slic/interface/slic.hpp"  // for SLIC macros
+
+// C/C++ includes
+#include <algorithm>  // for std::partition(), std::nth_element()
+#include <limits>     // for std::numeric_limits
+#include <numeric>    // for std::iota()
+#include <vector>     // for std::vector
+
+namespace axom
+{
+namespace spin
+{
+namespace policy
+{
+/*!
+ * \brief BinnedSAHBVH provides a policy for a BVH implementation which is
+ *  constructed top-down using a binned surface area heuristic (SAH).
+ *
+ * At each node, the centroids of the node's bounding boxes are binned along
+ * each axis and the node is split at the bin boundary that minimizes the SAH
+ * cost, i.e., the sum over both children of the number of entities times the
+ * surface area of the child's bounding box. This generally produces tighter
+ * bins than the Morton-code ordering of the LinearBVH policy, particularly for
+ * skewed or anisotropic inputs, at the expense of a more costly build.
+ *
+ * The resulting tree uses the same data layout as the LinearBVH policy, so
+ * all of the queries and the traverser are shared with it. Since skewed
+ * inputs can lead to long chains of unbalanced SAH splits, nodes are split
+ * at the median once the depth of the tree could otherwise exceed MAX_DEPTH,
+ * which keeps the tree within the traversal stack.
+ *
+ * \note The tree is constructed on the host and therefore this policy only
+ *  supports host execution spaces.
+ */
+template <typename FloatType, int NDIMS, typename ExecSpace>
+class BinnedSAHBVH : public LinearBVH<FloatType, NDIMS, ExecSpace>
+{
+  AXOM_STATIC_ASSERT_MSG(!axom::execution_space<ExecSpace>::onDevice(),
+                         "BinnedSAHBVH only supports host execution spaces.");
+
+  using BaseType = LinearBVH<FloatType, NDIMS, ExecSpace>;
+
+public:
+  using TraverserType = typename BaseType::TraverserType;
+  using BoundingBoxType = typename BaseType::BoundingBoxType;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  /// The number of bins per axis used to evaluate the candidate splits
+  static constexpr int NUM_BINS = 16;
+
+  /// The maximum depth of the tree, below the size of the traversal stack
+  static constexpr int MAX_DEPTH = 48;
+
+  BinnedSAHBVH() = default;
+
+  /*!
+   * \brief Builds a BVH with the given bounding boxes as leaf nodes.
+   *
+   * \param [in] boxes the bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   */
+  template <typename BoxIndexable>
+  void buildImpl(const BoxIndexable boxes,
+                 IndexType numBoxes,
+                 FloatType scaleFactor,
+                 int allocatorID);
+
+  /*!
+   * \brief Refits the BVH to updated bounding boxes, keeping the tree
+   *  topology from the last call to buildImpl().
+   *
+   * \return status true if the BVH was refit, false if numBoxes does not
+   *  match the number of leaves in the BVH.
+   */
+  template <typename BoxIndexable>
+  bool refitImpl(const BoxIndexable boxes,
+                 IndexType numBoxes,
+                 FloatType scaleFactor,
+                 int allocatorID);
+
+private:
+  /*!
+   * \brief Partitions the entities in the range [begin, end) of the
+   *  permutation array according to the best binned SAH split.
+   *
+   * \return mid the index of the first entity of the right child, such that
+   *  begin < mid < end.
+   */
+  int32 partition(int32 begin, int32 end);
+
+  /*!
+   * \brief Partitions the entities in the range [begin, end) of the
+   *  permutation array at the median of their centroids along the axis
+   *  of largest extent.
+   *
+   * \return mid the index of the first entity of the right child, which is
+   *  begin + (end - begin) / 2.
+   */
+  int32 medianPartition(int32 begin, int32 end);
+
+  /*!
+   * \brief Returns the bounding box of the entities in [begin, end).
+   */
+  BoundingBoxType rangeBounds(int32 begin, int32 end) const;
+
+  // temporary build data
+  std::vector<BoundingBoxType> m_aabbs;
+  std::vector<PointType> m_centroids;
+  std::vector<int32> m_prims;
+};
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+constexpr int BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::NUM_BINS;
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+constexpr int BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::MAX_DEPTH;
+
+//------------------------------------------------------------------------------
+//  BinnedSAHBVH implementation
+//------------------------------------------------------------------------------
+template <typename FloatType, int NDIMS, typename ExecSpace>
+template <typename BoxIndexable>
+void BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::buildImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("BinnedSAHBVH::buildImpl");
+
+  SLIC_ASSERT(numBoxes > 1);
+  const int32 size = static_cast<int32>(numBoxes);
+
+  // STEP 1: scale the boxes and compute their centroids
+  m_aabbs.resize(size);
+  m_centroids.resize(size);
+  m_prims.resize(size);
+  std::iota(m_prims.begin(), m_prims.end(), 0);
+
+  BoundingBoxType* aabbs = m_aabbs.data();
+  PointType* centroids = m_centroids.data();
+  for_all<ExecSpace>(size, [=](int32 i) {
+    BoundingBoxType aabb = boxes[i];
+    aabb.scale(scaleFactor);
+    aabbs[i] = aabb;
+    centroids[i] = aabb.getCentroid();
+  });
+
+  this->m_bounds = rangeBounds(0, size);
+  this->allocate(size, allocatorID);
+
+  const auto inner_nodes = this->m_inner_nodes.view();
+  const auto inner_node_children = this->m_inner_node_children.view();
+  const auto leaf_nodes = this->m_leaf_nodes.view();
+
+  // STEP 2: split nodes top-down. Each internal node is assigned its index
+  // when it is created, so children always have larger indices than their
+  // parents, which is relied upon by refitImpl().
+  struct BuildTask
+  {
+    int32 begin;
+    int32 end;
+    int32 node;
+    int depth;
+  };
+
+  // Returns the depth of a tree of median splits over count entities
+  auto medianDepth = [](int32 count) {
+    int depth = 0;
+    for(int64 n = 1; n < count; n *= 2)
+    {
+      ++depth;
+    }
+    return depth;
+  };
+
+  std::vector<BuildTask> todo;
+  todo.push_back(BuildTask {0, size, 0, 1});
+  int32 num_inner = 1;
+  int max_depth = 1;
+
+  while(!todo.empty())
+  {
+    const BuildTask task = todo.back();
+    todo.pop_back();
+    max_depth = axom::utilities::max(max_depth, task.depth);
+
+    // An SAH split may leave all but one entity in a child. Past the depth
+    // where median splits are needed to stay within MAX_DEPTH, split at the
+    // median, which halves the entities at each level.
+    const int32 count = task.end - task.begin;
+    const bool use_sah = task.depth + medianDepth(count) <= MAX_DEPTH;
+    const int32 mid = use_sah ? partition(task.begin, task.end)
+                              : medianPartition(task.begin, task.end);
+    const int32 ranges[2][2] = {{task.begin, mid}, {mid, task.end}};
+
+    for(int side = 0; side < 2; ++side)
+    {
+      const int32 begin = ranges[side][0];
+      const int32 end = ranges[side][1];
+      const int32 slot = 2 * task.node + side;
+
+      inner_nodes[slot] = rangeBounds(begin, end);
+      if(end - begin == 1)
+      {
+        // leaf node, encoded as the ones-complement of its leaf index
+        leaf_nodes[begin] = m_prims[begin];
+        inner_node_children[slot] = -(begin + 1);
+      }
+      else
+      {
+        const int32 child = num_inner++;
+        inner_node_children[slot] = 2 * child;
+        todo.push_back(BuildTask {begin, end, child, task.depth + 1});
+      }
+    }
+  }
+  SLIC_ASSERT(num_inner == size - 1);
+  SLIC_ASSERT(max_depth <= MAX_DEPTH);
+
+  this->m_sa_ratio =
+    internal::linear_bvh::surface_area_ratio<ExecSpace, FloatType, NDIMS>(
+      this->m_inner_nodes,
+      this->m_inner_node_children,
+      this->m_bounds);
+  this->m_depth = max_depth;
+
+  // STEP 3: release the temporary build data
+  m_aabbs = std::vector<BoundingBoxType>();
+  m_centroids = std::vector<PointType>();
+  m_prims = std::vector<int32>();
+
+  this->m_initialized = true;
+}
+
+//------------------------------------------------------------------------------
+template <typename FloatType, int NDIMS, typename ExecSpace>
+template <typename BoxIndexable>
+bool BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::refitImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  int AXOM_UNUSED_PARAM(allocatorID))
+{
+  AXOM_PERF_MARK_FUNCTION("BinnedSAHBVH::refitImpl");
+
+  SLIC_ASSERT(this->m_initialized);
+  if(numBoxes != this->m_leaf_nodes.size())
+  {
+    return false;
+  }
+
+  const auto inner_nodes = this->m_inner_nodes.view();
+  const auto inner_node_children = this->m_inner_node_children.view();
+  const auto leaf_nodes = this->m_leaf_nodes.view();
+
+  // visit the internal nodes in reverse order of creation, so that the
+  // children of each node are updated before the node itself
+  const int32 num_inner = static_cast<int32>(numBoxes) - 1;
+  for(int32 node = num_inner - 1; node >= 0; --node)
+  {
+    for(int side = 0; side < 2; ++side)
+    {
+      const int32 slot = 2 * node + side;
+      const int32 child = inner_node_children[slot];
+
+      BoundingBoxType aabb;
+      if(internal::linear_bvh::leaf_node(child))
+      {
+        aabb = boxes[leaf_nodes[-child - 1]];
+        aabb.scale(scaleFactor);
+      }
+      else
+      {
+        aabb.addBox(inner_nodes[child + 0]);
+        aabb.addBox(inner_nodes[child + 1]);
+      }
+      inner_nodes[slot] = aabb;
+    }
+  }
+
+  this->m_bounds.clear();
+  this->m_bounds.addBox(inner_nodes[0]);
+  this->m_bounds.addBox(inner_nodes[1]);
+
+  this->m_sa_ratio =
+    internal::linear_bvh::surface_area_ratio<ExecSpace, FloatType, NDIMS>(
+      this->m_inner_nodes,
+      this->m_inner_node_children,
+      this->m_bounds);
+
+  return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename FloatType, int NDIMS, typename ExecSpace>
+int32 BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::partition(int32 begin,
+                                                          int32 end)
+{
+  using internal::linear_bvh::surface_area;
+
+  const int32 count = end - begin;
+  SLIC_ASSERT(count > 1);
+
+  // STEP 1: compute the bounds of the centroids of the valid boxes
+  BoundingBoxType centroid_bounds;
+  for(int32 i = begin; i < end; ++i)
+  {
+    const int32 prim = m_prims[i];
+    if(m_aabbs[prim].isValid())
+    {
+      centroid_bounds.addPoint(m_centroids[prim]);
+    }
+  }
+
+  // STEP 2: for each axis, bin the centroids and sweep the bin boundaries
+  // to find the split with the smallest SAH cost
+  double best_cost = std::numeric_limits<double>::max();
+  int best_axis = -1;
+  int best_bin = -1;
+
+  auto binIndex = [&](int32 prim, int axis) -> int {
+    if(!m_aabbs[prim].isValid())
+    {
+      return 0;
+    }
+    const FloatType lo = centroid_bounds.getMin()[axis];
+    const FloatType extent = centroid_bounds.getMax()[axis] - lo;
+    const int bin =
+      static_cast<int>(NUM_BINS * (m_centroids[prim][axis] - lo) / extent);
+    return axom::utilities::clampVal(bin, 0, NUM_BINS - 1);
+  };
+
+  for(int axis = 0; centroid_bounds.isValid() && axis < NDIMS; ++axis)
+  {
+    if(!(centroid_bounds.getMax()[axis] > centroid_bounds.getMin()[axis]))
+    {
+      continue;
+    }
+
+    int32 bin_counts[NUM_BINS] = {0};
+    BoundingBoxType bin_boxes[NUM_BINS];
+    for(int32 i = begin; i < end; ++i)
+    {
+      const int32 prim = m_prims[i];
+      const int bin = binIndex(prim, axis);
+      bin_counts[bin]++;
+      bin_boxes[bin].addBox(m_aabbs[prim]);
+    }
+
+    // sweep from the right to get the cost of the right side of each split
+    double right_cost[NUM_BINS];
+    BoundingBoxType right_box;
+    int32 right_count = 0;
+    for(int bin = NUM_BINS - 1; bin > 0; --bin)
+    {
+      right_box.addBox(bin_boxes[bin]);
+      right_count += bin_counts[bin];
+      right_cost[bin] = right_count * surface_area(right_box);
+    }
+
+    // sweep from the left, splitting after each bin
+    BoundingBoxType left_box;
+    int32 left_count = 0;
+    for(int bin = 0; bin < NUM_BINS - 1; ++bin)
+    {
+      left_box.addBox(bin_boxes[bin]);
+      left_count += bin_counts[bin];
+      if(left_count == 0 || left_count == count)
+      {
+        continue;
+      }
+
+      const double cost =
+        left_count * surface_area(left_box) + right_cost[bin + 1];
+      if(cost < best_cost)
+      {
+        best_cost = cost;
+        best_axis = axis;
+        best_bin = bin;
+      }
+    }
+  }
+
+  // STEP 3: partition the entities, falling back to a median split if
+  // no valid split was found, e.g., if all the centroids coincide
+  if(best_axis < 0)
+  {
+    return begin + count / 2;
+  }
+
+  auto isLeft = [&](int32 prim) {
+    return binIndex(prim, best_axis) <= best_bin;
+  };
+  auto first_right =
+    std::partition(m_prims.begin() + begin, m_prims.begin() + end, isLeft);
+
+  const int32 mid = static_cast<int32>(first_right - m_prims.begin());
+  SLIC_ASSERT(mid > begin && mid < end);
+  return mid;
+}
+
+//------------------------------------------------------------------------------
+template <typename FloatType, int NDIMS, typename ExecSpace>
+int32 BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::medianPartition(int32 begin,
+                                                                int32 end)
+{
+  const int32 mid = begin + (end - begin) / 2;
+
+  BoundingBoxType centroid_bounds;
+  for(int32 i = begin; i < end; ++i)
+  {
+    centroid_bounds.addPoint(m_centroids[m_prims[i]]);
+  }
+  if(!centroid_bounds.isValid())
+  {
+    return mid;
+  }
+
+  const int axis = centroid_bounds.getLongestDimension();
+  std::nth_element(m_prims.begin() + begin,
+                   m_prims.begin() + mid,
+                   m_prims.begin() + end,
+                   [&](int32 a, int32 b) {
+                     return m_centroids[a][axis] < m_centroids[b][axis];
+                   });
+  return mid;
+}
+
+//------------------------------------------------------------------------------
+template <typename FloatType, int NDIMS, typename ExecSpace>
+typename BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::BoundingBoxType
+BinnedSAHBVH<FloatType, NDIMS, ExecSpace>::rangeBounds(int32 begin,
+                                                      int32 end) const
+{
+  BoundingBoxType bounds;
+  for(int32 i = begin; i < end; ++i)
+  {
+    bounds.addBox(m_aabbs[m_prims[i]]);
+  }
+  return bounds;
+}
+
+}  // namespace policy
+}  // namespace spin
+}  // namespace axom
+#endif /* AXOM_SPIN_POLICY_BINNEDSAHBVH_HPP_ */
@@ -12,13 +12,16 @@
 #include "axom/core/memory_management.hpp"  // for alloc()/free()
 
 #include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+#include "axom/core/numerics/floating_point_limits.hpp"  // for max()
 
 #include "axom/primal/geometry/BoundingBox.hpp"
 #include "axom/primal/geometry/Vector.hpp"
+#include "axom/primal/operators/squared_distance.hpp"
 
 // linear bvh includes
 #include "axom/spin/internal/linear_bvh/RadixTree.hpp"
 #include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_quality.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_vtkio.hpp"
 
@@ -119,6 +122,79 @@ public:
                        noTraversePref);
   }
 
+  /*
+   * Traverses the tree in near-to-far order, as measured by the distance
+   * functor \a dist, pruning all bins that are not closer than the search
+   * radius returned by \a radius.
+   *
+   * \see internal::linear_bvh::bvh_traverse_nearest
+   */
+  template <typename Primitive,
+            typename LeafAction,
+            typename DistanceFunc,
+            typename RadiusFunc>
+  AXOM_HOST_DEVICE void traverse_nearest(const Primitive& p,
+                                         LeafAction&& lf,
+                                         DistanceFunc&& dist,
+                                         RadiusFunc&& radius) const
+  {
+    lbvh::bvh_traverse_nearest(m_inner_nodes,
+                               m_inner_node_children,
+                               m_leaf_nodes,
+                               p,
+                               dist,
+                               lf,
+                               radius);
+  }
+
+  /*
+   * Traverses the tree depth-first, passing each bin to \a visit along with
+   * its index before its contents. The contents of the bins for which
+   * \a visit returns true are skipped, which allows hierarchical
+   * approximations in the style of Barnes-Hut.
+   *
+   * \see internal::linear_bvh::bvh_traverse_approximate
+   */
+  template <typename Primitive, typename LeafAction, typename BinVisitor>
+  AXOM_HOST_DEVICE void traverse_approximate(const Primitive& p,
+                                             LeafAction&& lf,
+                                             BinVisitor&& visit) const
+  {
+    lbvh::bvh_traverse_approximate(m_inner_nodes,
+                                   m_inner_node_children,
+                                   m_leaf_nodes,
+                                   p,
+                                   visit,
+                                   lf);
+  }
+
+  /*
+   * Invokes \a lf on every leaf contained in the given bin.
+   *
+   * \see internal::linear_bvh::bvh_traverse_bin_leaves
+   */
+  template <typename LeafAction>
+  AXOM_HOST_DEVICE void traverse_bin_leaves(int32 bin, LeafAction&& lf) const
+  {
+    lbvh::bvh_traverse_bin_leaves(m_inner_nodes,
+                                  m_inner_node_children,
+                                  m_leaf_nodes,
+                                  bin,
+                                  lf);
+  }
+
+  /// Returns the number of bins, the valid ones of which bound BVH nodes
+  AXOM_HOST_DEVICE IndexType getNumBins() const
+  {
+    return m_inner_nodes.size();
+  }
+
+  /// Returns the bounding box of the given bin
+  AXOM_HOST_DEVICE const BoxType& getBin(int32 bin) const
+  {
+    return m_inner_nodes[bin];
+  }
+
 private:
   axom::ArrayView<const BoxType> m_inner_nodes;  // BVH bins including leafs
   axom::ArrayView<const int32> m_inner_node_children;
@@ -157,6 +233,23 @@ public:
                  FloatType scaleFactor,
                  int allocatorID);
 
+  /*!
+   * \brief Refits the linear BVH to updated bounding boxes, keeping the tree
+   *  topology from the last call to buildImpl().
+   *
+   * \param [in] boxes the updated bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   *
+   * \return status true if the BVH was refit, false if numBoxes does not
+   *  match the number of leaves in the BVH.
+   */
+  template <typename BoxIndexable>
+  bool refitImpl(const BoxIndexable boxes,
+                 IndexType numBoxes,
+                 FloatType scaleFactor,
+                 int allocatorID);
+
   /*!
    * \brief Performs a traversal to find the candidates for each query primitive.
    *
@@ -178,10 +271,72 @@ public:
     PrimitiveIndexable objs,
     int allocatorID) const;
 
+  /*!
+   * \brief Performs a traversal to find the candidates for each query
+   *  primitive, handing them to a callback in batches of bounded size.
+   *
+   * \param [in] predicate traversal predicate functor for bin check.
+   * \param [in] numObjs the number of user-supplied query primitives
+   * \param [in] objs array of primitives to query against the BVH
+   * \param [in] batchSize the maximum number of (query, candidate) pairs per batch
+   * \param [in] onBatch host callback that is invoked on each batch
+   * \param [in] allocatorID the allocator for the temporary arrays
+   *
+   * \note The candidates are first counted for all query primitives, then
+   *  consecutive ranges of query primitives whose candidates fit within
+   *  batchSize are traversed again and passed to onBatch. A query primitive
+   *  with more than batchSize candidates forms a batch of its own.
+   */
+  template <typename PrimitiveType,
+            typename Predicate,
+            typename PrimitiveIndexable,
+            typename BatchFunc>
+  void findCandidatesBatchedImpl(Predicate&& predicate,
+                                 IndexType numObjs,
+                                 PrimitiveIndexable objs,
+                                 IndexType batchSize,
+                                 BatchFunc&& onBatch,
+                                 int allocatorID) const;
+
+  /*!
+   * \brief Performs a best-first traversal to find the k nearest leaf
+   *  bounding boxes to each query point.
+   *
+   * \param [in] k the number of neighbors to find for each query point
+   * \param [out] offsets array of offsets into the candidate array for each query point
+   * \param [out] counts array of neighbor counts for each query point
+   * \param [out] candidates array of the nearest neighbors, sorted by distance
+   * \param [out] sqDistances array of the squared distances to each neighbor
+   * \param [in] numObjs the number of user-supplied query points
+   * \param [in] objs array of points to query against the BVH
+   *
+   * \pre candidates.size() == sqDistances.size() == k * numObjs
+   */
+  template <typename PointType, typename PointIndexable>
+  void findNearestNeighborsImpl(int k,
+                                const axom::ArrayView<IndexType> offsets,
+                                const axom::ArrayView<IndexType> counts,
+                                const axom::ArrayView<IndexType> candidates,
+                                const axom::ArrayView<FloatType> sqDistances,
+                                IndexType numObjs,
+                                PointIndexable objs) const;
+
   void writeVtkFileImpl(const std::string& fileName) const;
 
   BoundingBoxType getBoundsImpl() const { return m_bounds; }
 
+  double getSurfaceAreaRatioImpl() const { return m_sa_ratio; }
+
+  int getDepthImpl() const
+  {
+    // the depth is computed on demand, since it requires a host traversal
+    if(m_depth < 0)
+    {
+      m_depth = lbvh::tree_depth<ExecSpace>(m_inner_node_children);
+    }
+    return m_depth;
+  }
+
   TraverserType getTraverserImpl() const
   {
     return TraverserType(m_inner_nodes.view(),
@@ -189,7 +344,7 @@ public:
                          m_leaf_nodes.view());
   }
 
-private:
+protected:
   void allocate(int32 size, int allocID)
   {
     AXOM_PERF_MARK_FUNCTION("LinearBVH::allocate");
@@ -206,11 +361,22 @@ private:
     m_leaf_nodes = axom::Array<int32>(size, size, allocID);
   }
 
+  /*!
+   * \brief Emits the BVH bins and child indices from the radix tree and
+   *  updates the surface area ratio.
+   */
+  void emitBVH(const lbvh::RadixTree<FloatType, NDIMS>& radix_tree);
+
   bool m_initialized {false};
   axom::Array<BoundingBoxType> m_inner_nodes;  // BVH bins including leafs
   axom::Array<int32> m_inner_node_children;
   axom::Array<int32> m_leaf_nodes;  // leaf data
   primal::BoundingBox<FloatType, NDIMS> m_bounds;
+  double m_sa_ratio {1.};
+  mutable int m_depth {-1};  // computed lazily; -1 when not yet known
+
+  // radix tree topology, retained for refitting
+  lbvh::RadixTree<FloatType, NDIMS> m_radix_tree;
 };
 
 template <typename FloatType, int NDIMS, typename ExecSpace>
@@ -236,8 +402,60 @@ void LinearBVH<FloatType, NDIMS, ExecSpace>::buildImpl(const BoxIndexable boxes,
   // STEP 2: emit the BVH data-structure from the radix tree
   m_bounds = global_bounds;
   allocate(numBoxes, allocatorID);
+  emitBVH(radix_tree);
+  m_depth = -1;
+
+  m_leaf_nodes = std::move(radix_tree.m_leafs);
+
+  // STEP 3: retain only the tree topology for subsequent refits
+  radix_tree.m_inner_aabbs = axom::Array<BoundingBoxType>();
+  radix_tree.m_leaf_aabbs = axom::Array<BoundingBoxType>();
+  radix_tree.m_mcodes = axom::Array<uint32>();
+  m_radix_tree = std::move(radix_tree);
+
+  m_initialized = true;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+template <typename BoxIndexable>
+bool LinearBVH<FloatType, NDIMS, ExecSpace>::refitImpl(const BoxIndexable boxes,
+                                                       IndexType numBoxes,
+                                                       FloatType scaleFactor,
+                                                       int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("LinearBVH::refitImpl");
+
+  SLIC_ASSERT(m_initialized);
+  if(numBoxes != m_leaf_nodes.size())
+  {
+    return false;
+  }
+
+  // STEP 1: Recompute the bounding boxes of the radix tree bottom-up, using
+  // the ordering and topology from the initial build.
+  lbvh::refit_radix_tree<ExecSpace>(boxes,
+                                    numBoxes,
+                                    m_leaf_nodes.view(),
+                                    m_bounds,
+                                    m_radix_tree,
+                                    scaleFactor,
+                                    allocatorID);
+
+  // STEP 2: re-emit the BVH bins in place
+  emitBVH(m_radix_tree);
+
+  m_radix_tree.m_inner_aabbs = axom::Array<BoundingBoxType>();
+  m_radix_tree.m_leaf_aabbs = axom::Array<BoundingBoxType>();
+
+  return true;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+void LinearBVH<FloatType, NDIMS, ExecSpace>::emitBVH(
+  const lbvh::RadixTree<FloatType, NDIMS>& radix_tree)
+{
+  AXOM_PERF_MARK_FUNCTION("LinearBVH::emitBVH");
 
-  // STEP 3: emit the BVH
   const int32 size = radix_tree.m_size;
   AXOM_UNUSED_VAR(size);
   const int32 inner_size = radix_tree.m_inner_size;
@@ -292,9 +510,10 @@ void LinearBVH<FloatType, NDIMS, ExecSpace>::buildImpl(const BoxIndexable boxes,
                              bvh_inner_node_children[out_offset + 1] = rchild;
                            }););
 
-  m_leaf_nodes = std::move(radix_tree.m_leafs);
-
-  m_initialized = true;
+  m_sa_ratio = lbvh::surface_area_ratio<ExecSpace, FloatType, NDIMS>(
+    m_inner_nodes,
+    m_inner_node_children,
+    m_bounds);
 }
 
 template <typename FloatType, int NDIMS, typename ExecSpace>
@@ -433,6 +652,244 @@ axom::Array<IndexType> LinearBVH<FloatType, NDIMS, ExecSpace>::findCandidatesImp
 #endif
 }
 
+template <typename FloatType, int NDIMS, typename ExecSpace>
+template <typename PrimitiveType,
+          typename Predicate,
+          typename PrimitiveIndexable,
+          typename BatchFunc>
+void LinearBVH<FloatType, NDIMS, ExecSpace>::findCandidatesBatchedImpl(
+  Predicate&& predicate,
+  IndexType numObjs,
+  PrimitiveIndexable objs,
+  IndexType batchSize,
+  BatchFunc&& onBatch,
+  int allocatorID) const
+{
+  AXOM_PERF_MARK_FUNCTION("LinearBVH::findCandidatesBatchedImpl");
+
+  SLIC_ERROR_IF(batchSize <= 0, "batch size must be positive");
+  SLIC_ASSERT(m_initialized);
+
+  const auto inner_nodes = m_inner_nodes.view();
+  const auto inner_node_children = m_inner_node_children.view();
+  const auto leaf_nodes = m_leaf_nodes.view();
+
+  auto noTraversePref = [] AXOM_HOST_DEVICE(const BoundingBoxType&,
+                                            const BoundingBoxType&,
+                                            const PrimitiveType&) {
+    return false;
+  };
+
+  // STEP 1: count number of candidates for each query primitive
+  axom::Array<IndexType> counts(numObjs, numObjs, allocatorID);
+  axom::Array<IndexType> offsets(numObjs, numObjs, allocatorID);
+  const auto counts_v = counts.view();
+  const auto offsets_v = offsets.view();
+
+  AXOM_PERF_MARK_SECTION(
+    "PASS[1]:count_traversal",
+    for_all<ExecSpace>(
+      numObjs,
+      AXOM_LAMBDA(IndexType i) {
+        int32 count = 0;
+        PrimitiveType primitive {objs[i]};
+
+        auto leafAction = [&count](int32 AXOM_UNUSED_PARAM(current_node),
+                                   const int32* AXOM_UNUSED_PARAM(leaf_nodes)) {
+          count++;
+        };
+
+        lbvh::bvh_traverse(inner_nodes,
+                           inner_node_children,
+                           leaf_nodes,
+                           primitive,
+                           predicate,
+                           leafAction,
+                           noTraversePref);
+
+        counts_v[i] = count;
+      }););
+
+  // STEP 2: exclusive scan to get offsets of each query in the full output
+#if defined(AXOM_USE_RAJA)
+  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  AXOM_PERF_MARK_SECTION(
+    "exclusive_scan",
+    RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), numObjs),
+                                      RAJA::make_span(offsets.data(), numObjs),
+                                      RAJA::operators::plus<IndexType> {}););
+#else
+  IndexType running_offset = 0;
+  for(IndexType i = 0; i < numObjs; ++i)
+  {
+    offsets[i] = running_offset;
+    running_offset += counts[i];
+  }
+#endif
+
+  // STEP 3: the batches are formed on the host
+  axom::Array<IndexType> host_counts, host_offsets;
+  axom::ArrayView<IndexType> counts_h = counts_v;
+  axom::ArrayView<IndexType> offsets_h = offsets_v;
+  if(axom::execution_space<ExecSpace>::onDevice())
+  {
+    const int hostAllocatorID =
+      axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+    host_counts = axom::Array<IndexType>(counts, hostAllocatorID);
+    host_offsets = axom::Array<IndexType>(offsets, hostAllocatorID);
+    counts_h = host_counts.view();
+    offsets_h = host_offsets.view();
+  }
+
+  IndexType max_count = 0;
+  for(IndexType i = 0; i < numObjs; ++i)
+  {
+    max_count = axom::utilities::max(max_count, counts_h[i]);
+  }
+  const IndexType total_candidates =
+    (numObjs > 0) ? offsets_h[numObjs - 1] + counts_h[numObjs - 1] : 0;
+  const IndexType capacity = axom::utilities::min(
+    total_candidates,
+    axom::utilities::max(batchSize, max_count));
+
+  // STEP 4: allocate the pair buffers once, and refill them for each batch
+  axom::Array<IndexType> query_ids(capacity, capacity, allocatorID);
+  axom::Array<IndexType> candidate_ids(capacity, capacity, allocatorID);
+  const auto query_ids_v = query_ids.view();
+  const auto candidate_ids_v = candidate_ids.view();
+
+  IndexType begin = 0;
+  while(begin < numObjs)
+  {
+    const IndexType batch_offset = offsets_h[begin];
+    IndexType end = begin + 1;
+    while(end < numObjs &&
+          offsets_h[end] + counts_h[end] - batch_offset <= batchSize)
+    {
+      ++end;
+    }
+    const IndexType num_pairs =
+      offsets_h[end - 1] + counts_h[end - 1] - batch_offset;
+
+    if(num_pairs > 0)
+    {
+      AXOM_PERF_MARK_SECTION(
+        "PASS[2]:fill_traversal",
+        for_all<ExecSpace>(
+          begin,
+          end,
+          AXOM_LAMBDA(IndexType i) {
+            IndexType offset = offsets_v[i] - batch_offset;
+
+            PrimitiveType obj {objs[i]};
+            auto leafAction = [&offset, i, query_ids_v, candidate_ids_v](
+                                int32 current_node,
+                                const int32* leafs) {
+              query_ids_v[offset] = i;
+              candidate_ids_v[offset] = leafs[current_node];
+              offset++;
+            };
+
+            lbvh::bvh_traverse(inner_nodes,
+                               inner_node_children,
+                               leaf_nodes,
+                               obj,
+                               predicate,
+                               leafAction,
+                               noTraversePref);
+          }););
+
+      onBatch(
+        axom::ArrayView<const IndexType>(query_ids.data(), num_pairs),
+        axom::ArrayView<const IndexType>(candidate_ids.data(), num_pairs));
+    }
+
+    begin = end;
+  }
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+template <typename PointType, typename PointIndexable>
+void LinearBVH<FloatType, NDIMS, ExecSpace>::findNearestNeighborsImpl(
+  int k,
+  const axom::ArrayView<IndexType> offsets,
+  const axom::ArrayView<IndexType> counts,
+  const axom::ArrayView<IndexType> candidates,
+  const axom::ArrayView<FloatType> sqDistances,
+  IndexType numObjs,
+  PointIndexable objs) const
+{
+  AXOM_PERF_MARK_FUNCTION("LinearBVH::findNearestNeighborsImpl");
+
+  SLIC_ERROR_IF(offsets.size() != numObjs,
+                "offsets length not equal to numObjs");
+  SLIC_ERROR_IF(counts.size() != numObjs, "counts length not equal to numObjs");
+  SLIC_ERROR_IF(candidates.size() != k * numObjs,
+                "candidates length not equal to k * numObjs");
+  SLIC_ERROR_IF(sqDistances.size() != k * numObjs,
+                "sqDistances length not equal to k * numObjs");
+  SLIC_ASSERT(m_initialized);
+
+  const auto inner_nodes = m_inner_nodes.view();
+  const auto inner_node_children = m_inner_node_children.view();
+  const auto leaf_nodes = m_leaf_nodes.view();
+
+  constexpr FloatType MAX_DIST =
+    axom::numerics::floating_point_limits<FloatType>::max();
+
+  AXOM_PERF_MARK_SECTION(
+    "knn_traversal",
+    for_all<ExecSpace>(
+      numObjs,
+      AXOM_LAMBDA(IndexType i) {
+        const IndexType offset = i * k;
+        IndexType found = 0;
+
+        PointType point {objs[i]};
+
+        auto sqDistToBin = [](const PointType& p, const BoundingBoxType& bb) {
+          return static_cast<FloatType>(primal::squared_distance(p, bb));
+        };
+
+        // the search radius is the distance to the current k-th neighbor
+        auto searchRadius = [&]() -> FloatType {
+          return (found < k) ? MAX_DIST : sqDistances[offset + k - 1];
+        };
+
+        // insertion sort into the k-nearest list, evicting the farthest
+        auto leafAction = [&](int32 current_node,
+                              const int32* leafs,
+                              FloatType sqDist) {
+          IndexType pos = (found < k) ? found++ : k - 1;
+          for(; pos > 0 && sqDistances[offset + pos - 1] > sqDist; --pos)
+          {
+            sqDistances[offset + pos] = sqDistances[offset + pos - 1];
+            candidates[offset + pos] = candidates[offset + pos - 1];
+          }
+          sqDistances[offset + pos] = sqDist;
+          candidates[offset + pos] = leafs[current_node];
+        };
+
+        lbvh::bvh_traverse_nearest(inner_nodes,
+                                   inner_node_children,
+                                   leaf_nodes,
+                                   point,
+                                   sqDistToBin,
+                                   leafAction,
+                                   searchRadius);
+
+        // pad unused slots when there are fewer than k entities in the BVH
+        for(IndexType j = found; j < k; ++j)
+        {
+          candidates[offset + j] = -1;
+          sqDistances[offset + j] = MAX_DIST;
+        }
+
+        offsets[i] = offset;
+        counts[i] = found;
+      }););
+}
+
 template <typename FloatType, int NDIMS, typename ExecSpace>
 void LinearBVH<FloatType, NDIMS, ExecSpace>::writeVtkFileImpl(
   const std::string& fileName) const
@@ -245,6 +245,11 @@ struct FlatGridStorage
     IndexType end = (gridIdx + 1 < m_binOffsets.size())
       ? m_binOffsets[gridIdx + 1]
       : m_binData.size();
+    // Empty bins at the end of the data have no valid offset in the data
+    if(offset == end)
+    {
+      return {};
+    }
     return m_binData.view().subspan(offset, end - offset);
   }
   ConstBinType getBinContents(IndexType gridIdx) const
@@ -253,6 +258,11 @@ struct FlatGridStorage
     IndexType end = (gridIdx + 1 < m_binOffsets.size())
       ? m_binOffsets[gridIdx + 1]
       : m_binData.size();
+    // Empty bins at the end of the data have no valid offset in the data
+    if(offset == end)
+    {
+      return {};
+    }
     return m_binData.view().subspan(offset, end - offset);
   }
 
@@ -301,6 +311,10 @@ struct FlatGridView
     IndexType end = (gridIdx + 1 < m_binOffsets.size())
       ? m_binOffsets[gridIdx + 1]
       : m_binData.size();
+    if(offset == end)
+    {
+      return {};
+    }
     return m_binData.subspan(offset, end - offset);
   }
 
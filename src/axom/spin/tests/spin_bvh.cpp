@@ -1466,6 +1466,697 @@ void check_0_or_1_bbox_2d()
   axom::setDefaultAllocator(current_allocator);
 }
 
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Tests the k-nearest-neighbor query of the BVH.
+ *
+ *  A random point cloud is inserted into the BVH as degenerate bounding boxes
+ *  and a second random point cloud is queried against it. The returned
+ *  neighbors are checked against a brute-force search. The test also checks
+ *  the case where k exceeds the number of entities in the BVH.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_find_nearest_neighbors()
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  constexpr IndexType NUM_SRC = 200;
+  constexpr IndexType NUM_QUERY = 100;
+  constexpr unsigned int SEED = 42;
+
+  axom::Array<BoxType> boxes(NUM_SRC);
+  axom::Array<PointType> src_pts(NUM_SRC);
+  for(IndexType i = 0; i < NUM_SRC; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      src_pts[i][d] = axom::utilities::random_real<FloatType>(-1., 1., SEED);
+    }
+    boxes[i] = BoxType(src_pts[i]);
+  }
+
+  axom::Array<PointType> query_pts(NUM_QUERY);
+  for(IndexType i = 0; i < NUM_QUERY; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      query_pts[i][d] =
+        axom::utilities::random_real<FloatType>(-1.5, 1.5, SEED);
+    }
+  }
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  bvh.setScaleFactor(1.0);  // i.e., no scaling
+  bvh.initialize(boxes.view(), NUM_SRC);
+
+  axom::Array<IndexType> offsets(NUM_QUERY);
+  axom::Array<IndexType> counts(NUM_QUERY);
+  axom::Array<IndexType> candidates;
+  axom::Array<FloatType> distances;
+
+  for(int k : {1, 5, 17})
+  {
+    bvh.findNearestNeighbors(k,
+                             offsets,
+                             counts,
+                             candidates,
+                             distances,
+                             NUM_QUERY,
+                             query_pts.view());
+
+    EXPECT_EQ(candidates.size(), k * NUM_QUERY);
+    EXPECT_EQ(distances.size(), k * NUM_QUERY);
+
+    for(IndexType i = 0; i < NUM_QUERY; ++i)
+    {
+      // brute force
+      std::vector<FloatType> expected(NUM_SRC);
+      for(IndexType j = 0; j < NUM_SRC; ++j)
+      {
+        expected[j] =
+          std::sqrt(primal::squared_distance(query_pts[i], src_pts[j]));
+      }
+      std::sort(expected.begin(), expected.end());
+
+      EXPECT_EQ(counts[i], k);
+      EXPECT_EQ(offsets[i], i * k);
+      for(int j = 0; j < counts[i]; ++j)
+      {
+        const IndexType idx = offsets[i] + j;
+        const IndexType cand = candidates[idx];
+        ASSERT_TRUE(cand >= 0 && cand < NUM_SRC);
+        EXPECT_NEAR(distances[idx], expected[j], 1e-5);
+        EXPECT_NEAR(
+          distances[idx],
+          std::sqrt(primal::squared_distance(query_pts[i], src_pts[cand])),
+          1e-5);
+      }
+    }
+  }
+
+  // k larger than the number of entities in the BVH
+  constexpr IndexType NUM_SMALL = 3;
+  constexpr int K_LARGE = 5;
+  spin::BVH<NDIMS, ExecSpace, FloatType> small_bvh;
+  small_bvh.initialize(boxes.view(), NUM_SMALL);
+  small_bvh.findNearestNeighbors(K_LARGE,
+                                 offsets,
+                                 counts,
+                                 candidates,
+                                 distances,
+                                 NUM_QUERY,
+                                 query_pts.view());
+  for(IndexType i = 0; i < NUM_QUERY; ++i)
+  {
+    EXPECT_EQ(counts[i], NUM_SMALL);
+    for(int j = 0; j < K_LARGE; ++j)
+    {
+      const IndexType cand = candidates[offsets[i] + j];
+      if(j < NUM_SMALL)
+      {
+        EXPECT_TRUE(cand >= 0 && cand < NUM_SMALL);
+      }
+      else
+      {
+        EXPECT_EQ(cand, -1);
+      }
+    }
+  }
+
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Tests refitting a BVH to moving bounding boxes.
+ *
+ *  The bounding boxes of a random point cloud are inserted into the BVH and
+ *  subsequently displaced. The refitted BVH must return the same candidates
+ *  as a BVH that is rebuilt from scratch over the displaced boxes.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_refit()
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+  using VectorType = primal::Vector<FloatType, NDIMS>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  constexpr IndexType NUM_BOXES = 500;
+  constexpr FloatType HALF_WIDTH = 0.05;
+  constexpr unsigned int SEED = 7;
+
+  axom::Array<PointType> centers(NUM_BOXES);
+  axom::Array<BoxType> boxes(NUM_BOXES);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      centers[i][d] = axom::utilities::random_real<FloatType>(-1., 1., SEED);
+    }
+    boxes[i] = BoxType(centers[i]);
+    boxes[i].expand(HALF_WIDTH);
+  }
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  EXPECT_EQ(bvh.getSurfaceAreaRatio(), 0.);
+  EXPECT_EQ(bvh.refit(boxes.view(), NUM_BOXES), spin::BVH_BUILD_FAILED);
+
+  bvh.initialize(boxes.view(), NUM_BOXES);
+  const double initial_ratio = bvh.getSurfaceAreaRatio();
+  EXPECT_GE(initial_ratio, 1.);
+
+  // refitting to the same boxes does not change the BVH
+  EXPECT_EQ(bvh.refit(boxes.view(), NUM_BOXES), spin::BVH_BUILD_OK);
+  EXPECT_DOUBLE_EQ(bvh.getSurfaceAreaRatio(), initial_ratio);
+
+  // number of boxes must match the original build
+  EXPECT_EQ(bvh.refit(boxes.view(), NUM_BOXES - 1), spin::BVH_BUILD_FAILED);
+
+  // displace the boxes: a rigid translation plus some random motion
+  VectorType shift;
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    shift[d] = 0.25 * (d + 1);
+  }
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType c = centers[i] + shift;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      c[d] += axom::utilities::random_real<FloatType>(-.2, .2, SEED);
+    }
+    boxes[i] = BoxType(c);
+    boxes[i].expand(HALF_WIDTH);
+  }
+
+  EXPECT_EQ(bvh.refit(boxes.view(), NUM_BOXES), spin::BVH_BUILD_OK);
+  EXPECT_GE(bvh.getSurfaceAreaRatio(), 1.);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> rebuilt;
+  rebuilt.initialize(boxes.view(), NUM_BOXES);
+
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    EXPECT_NEAR(bvh.getBounds().getMin()[d],
+                rebuilt.getBounds().getMin()[d],
+                1e-5);
+    EXPECT_NEAR(bvh.getBounds().getMax()[d],
+                rebuilt.getBounds().getMax()[d],
+                1e-5);
+  }
+
+  // query with the boxes themselves and compare the candidate sets
+  axom::Array<IndexType> offsets(NUM_BOXES), offsets2(NUM_BOXES);
+  axom::Array<IndexType> counts(NUM_BOXES), counts2(NUM_BOXES);
+  axom::Array<IndexType> candidates, candidates2;
+  bvh.findBoundingBoxes(offsets, counts, candidates, NUM_BOXES, boxes.view());
+  rebuilt.findBoundingBoxes(offsets2,
+                            counts2,
+                            candidates2,
+                            NUM_BOXES,
+                            boxes.view());
+
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    ASSERT_EQ(counts[i], counts2[i]);
+    EXPECT_GE(counts[i], 1);
+
+    std::vector<IndexType> c1(candidates.data() + offsets[i],
+                              candidates.data() + offsets[i] + counts[i]);
+    std::vector<IndexType> c2(candidates2.data() + offsets2[i],
+                              candidates2.data() + offsets2[i] + counts2[i]);
+    std::sort(c1.begin(), c1.end());
+    std::sort(c2.begin(), c2.end());
+    EXPECT_EQ(c1, c2);
+  }
+
+  // refitting a BVH with a single box
+  spin::BVH<NDIMS, ExecSpace, FloatType> single;
+  single.initialize(boxes.view(), 1);
+  EXPECT_EQ(single.refit(boxes.view(), 1), spin::BVH_BUILD_OK);
+
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Sorts and returns the candidates of the ith query.
+ */
+std::vector<IndexType> sorted_candidates(const axom::Array<IndexType>& offsets,
+                                         const axom::Array<IndexType>& counts,
+                                         const axom::Array<IndexType>& candidates,
+                                         IndexType i)
+{
+  std::vector<IndexType> cands(candidates.data() + offsets[i],
+                               candidates.data() + offsets[i] + counts[i]);
+  std::sort(cands.begin(), cands.end());
+  return cands;
+}
+
+/*!
+ * \brief Tests the BinnedSAH construction policy of the BVH.
+ *
+ *  Builds a BVH with the BinnedSAH policy and with the default LinearBVH
+ *  policy over a random set of boxes that are stretched along one axis, and
+ *  checks that both return the same candidates for box, ray and point
+ *  queries, including after refitting.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_binned_sah()
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+  using VectorType = primal::Vector<FloatType, NDIMS>;
+  using RayType = primal::Ray<FloatType, NDIMS>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  constexpr IndexType NUM_BOXES = 1000;
+  constexpr unsigned int SEED = 11;
+
+  // generate skewed boxes: long and thin in the first dimension
+  axom::Array<BoxType> boxes(NUM_BOXES);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType lo, hi;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType width = (d == 0) ? 0.5 : 0.01;
+      lo[d] = axom::utilities::random_real<FloatType>(-1., 1., SEED);
+      hi[d] = lo[d] + width;
+    }
+    boxes[i] = BoxType(lo, hi);
+  }
+
+  spin::BVH<NDIMS, ExecSpace, FloatType, spin::BVHType::BinnedSAH> sah_bvh;
+  sah_bvh.initialize(boxes.view(), NUM_BOXES);
+  EXPECT_GE(sah_bvh.getSurfaceAreaRatio(), 1.);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> lbvh;
+  lbvh.initialize(boxes.view(), NUM_BOXES);
+
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    EXPECT_DOUBLE_EQ(sah_bvh.getBounds().getMin()[d],
+                     lbvh.getBounds().getMin()[d]);
+    EXPECT_DOUBLE_EQ(sah_bvh.getBounds().getMax()[d],
+                     lbvh.getBounds().getMax()[d]);
+  }
+
+  axom::Array<IndexType> offsets(NUM_BOXES), offsets2(NUM_BOXES);
+  axom::Array<IndexType> counts(NUM_BOXES), counts2(NUM_BOXES);
+  axom::Array<IndexType> candidates, candidates2;
+
+  // box queries
+  for(int pass = 0; pass < 2; ++pass)
+  {
+    sah_bvh.findBoundingBoxes(offsets,
+                              counts,
+                              candidates,
+                              NUM_BOXES,
+                              boxes.view());
+    lbvh.findBoundingBoxes(offsets2,
+                           counts2,
+                           candidates2,
+                           NUM_BOXES,
+                           boxes.view());
+    for(IndexType i = 0; i < NUM_BOXES; ++i)
+    {
+      EXPECT_GE(counts[i], 1);
+      EXPECT_EQ(sorted_candidates(offsets, counts, candidates, i),
+                sorted_candidates(offsets2, counts2, candidates2, i));
+    }
+
+    // shift the boxes and refit both BVHs before the second pass
+    VectorType shift(0.1);
+    for(IndexType i = 0; i < NUM_BOXES; ++i)
+    {
+      boxes[i] = BoxType(boxes[i].getMin() + shift, boxes[i].getMax() + shift);
+    }
+    EXPECT_EQ(sah_bvh.refit(boxes.view(), NUM_BOXES), spin::BVH_BUILD_OK);
+    EXPECT_EQ(lbvh.refit(boxes.view(), NUM_BOXES), spin::BVH_BUILD_OK);
+  }
+
+  // ray queries, from random origins towards the origin
+  constexpr IndexType NUM_RAYS = 100;
+  axom::Array<RayType> rays(NUM_RAYS);
+  for(IndexType i = 0; i < NUM_RAYS; ++i)
+  {
+    PointType origin;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      origin[d] = axom::utilities::random_real<FloatType>(-2., 2., SEED);
+    }
+    rays[i] = RayType(origin, VectorType(origin, PointType(0.)));
+  }
+
+  offsets.resize(NUM_RAYS);
+  counts.resize(NUM_RAYS);
+  offsets2.resize(NUM_RAYS);
+  counts2.resize(NUM_RAYS);
+  sah_bvh.findRays(offsets, counts, candidates, NUM_RAYS, rays.view());
+  lbvh.findRays(offsets2, counts2, candidates2, NUM_RAYS, rays.view());
+  for(IndexType i = 0; i < NUM_RAYS; ++i)
+  {
+    EXPECT_EQ(sorted_candidates(offsets, counts, candidates, i),
+              sorted_candidates(offsets2, counts2, candidates2, i));
+  }
+
+  // nearest neighbor queries
+  constexpr int K = 4;
+  axom::Array<PointType> points(NUM_RAYS);
+  for(IndexType i = 0; i < NUM_RAYS; ++i)
+  {
+    points[i] = rays[i].origin();
+  }
+
+  axom::Array<FloatType> distances, distances2;
+  sah_bvh.findNearestNeighbors(K,
+                               offsets,
+                               counts,
+                               candidates,
+                               distances,
+                               NUM_RAYS,
+                               points.view());
+  lbvh.findNearestNeighbors(K,
+                            offsets2,
+                            counts2,
+                            candidates2,
+                            distances2,
+                            NUM_RAYS,
+                            points.view());
+  for(IndexType i = 0; i < K * NUM_RAYS; ++i)
+  {
+    EXPECT_NEAR(distances[i], distances2[i], 1e-5);
+  }
+
+  // a BVH with a single box
+  spin::BVH<NDIMS, ExecSpace, FloatType, spin::BVHType::BinnedSAH> single;
+  single.initialize(boxes.view(), 1);
+  offsets.resize(1);
+  counts.resize(1);
+  single.findBoundingBoxes(offsets, counts, candidates, 1, boxes.view());
+  EXPECT_EQ(counts[0], 1);
+  EXPECT_EQ(candidates[offsets[0]], 0);
+
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Tests the depth of a BinnedSAH BVH over a pathological input.
+ *
+ *  The boxes are spaced exponentially along a line, so the SAH cost favors
+ *  splitting off the largest box at each level. Checks that the depth stays
+ *  within the traversal stack, and that the queries find every box.
+ */
+template <typename ExecSpace, int NDIMS>
+void check_binned_sah_depth()
+{
+  using FloatType = double;
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+  using SAHType =
+    spin::BVH<NDIMS, ExecSpace, FloatType, spin::BVHType::BinnedSAH>;
+  using SAHPolicy = spin::policy::BinnedSAHBVH<FloatType, NDIMS, ExecSpace>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  constexpr IndexType NUM_BOXES = 500;
+
+  // disjoint boxes, each one 1.5 times larger than the previous one
+  axom::Array<BoxType> boxes(NUM_BOXES);
+  axom::Array<PointType> centroids(NUM_BOXES);
+  FloatType lo = 1.;
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    const FloatType hi = 1.5 * lo;
+    boxes[i] = BoxType(PointType(lo), PointType(0.5 * (lo + hi)));
+    centroids[i] = boxes[i].getCentroid();
+    lo = hi;
+  }
+
+  SAHType bvh;
+  bvh.initialize(boxes.view(), NUM_BOXES);
+  EXPECT_LE(bvh.getDepth(), SAHPolicy::MAX_DEPTH);
+  EXPECT_LT(bvh.getDepth(), 64);
+
+  // each box and its centroid only overlap the box itself
+  axom::Array<IndexType> offsets(NUM_BOXES);
+  axom::Array<IndexType> counts(NUM_BOXES);
+  axom::Array<IndexType> candidates;
+  bvh.findBoundingBoxes(offsets, counts, candidates, NUM_BOXES, boxes.view());
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    ASSERT_EQ(counts[i], 1);
+    EXPECT_EQ(candidates[offsets[i]], i);
+  }
+
+  bvh.findPoints(offsets, counts, candidates, NUM_BOXES, centroids.view());
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    ASSERT_EQ(counts[i], 1);
+    EXPECT_EQ(candidates[offsets[i]], i);
+  }
+
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Tests the batched query variants of the BVH against the candidates
+ *  returned by findBoundingBoxes() and findPoints() for several batch sizes.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_batched_queries()
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  constexpr IndexType NUM_BOXES = 500;
+  constexpr unsigned int SEED = 5;
+
+  axom::Array<BoxType> boxes(NUM_BOXES);
+  axom::Array<PointType> points(NUM_BOXES);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType lo;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      lo[d] = axom::utilities::random_real<FloatType>(-1., 1., SEED);
+      points[i][d] = axom::utilities::random_real<FloatType>(-1., 1., SEED);
+    }
+    boxes[i] = BoxType(lo, lo + primal::Vector<FloatType, NDIMS>(0.2));
+  }
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  bvh.initialize(boxes.view(), NUM_BOXES);
+
+  axom::Array<IndexType> offsets(NUM_BOXES), counts(NUM_BOXES), candidates;
+  std::vector<std::vector<IndexType>> expected_boxes(NUM_BOXES);
+  std::vector<std::vector<IndexType>> expected_points(NUM_BOXES);
+
+  IndexType max_box_count = 0;
+  bvh.findBoundingBoxes(offsets, counts, candidates, NUM_BOXES, boxes.view());
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    expected_boxes[i] = sorted_candidates(offsets, counts, candidates, i);
+    max_box_count = std::max(max_box_count, counts[i]);
+  }
+
+  IndexType max_point_count = 0;
+  bvh.findPoints(offsets, counts, candidates, NUM_BOXES, points.view());
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    expected_points[i] = sorted_candidates(offsets, counts, candidates, i);
+    max_point_count = std::max(max_point_count, counts[i]);
+  }
+
+  for(IndexType batchSize : {IndexType {1}, IndexType {7}, IndexType {100},
+                             NUM_BOXES * NUM_BOXES})
+  {
+    std::vector<std::vector<IndexType>> found(NUM_BOXES);
+    IndexType largest_batch = 0;
+    int num_batches = 0;
+
+    auto collect = [&](axom::ArrayView<const IndexType> queryIds,
+                       axom::ArrayView<const IndexType> candidateIds) {
+      EXPECT_EQ(queryIds.size(), candidateIds.size());
+      EXPECT_GT(queryIds.size(), 0);
+      largest_batch = std::max(largest_batch, queryIds.size());
+      ++num_batches;
+      for(IndexType j = 0; j < queryIds.size(); ++j)
+      {
+        found[queryIds[j]].push_back(candidateIds[j]);
+      }
+    };
+
+    bvh.findBoundingBoxesBatched(NUM_BOXES, boxes.view(), batchSize, collect);
+
+    for(IndexType i = 0; i < NUM_BOXES; ++i)
+    {
+      std::sort(found[i].begin(), found[i].end());
+      EXPECT_EQ(found[i], expected_boxes[i]);
+    }
+
+    // batches are bounded unless a single query has more candidates
+    EXPECT_LE(largest_batch, std::max(batchSize, max_box_count));
+    if(batchSize >= NUM_BOXES * NUM_BOXES)
+    {
+      EXPECT_EQ(num_batches, 1);
+    }
+
+    found = std::vector<std::vector<IndexType>>(NUM_BOXES);
+    largest_batch = 0;
+    bvh.findPointsBatched(NUM_BOXES, points.view(), batchSize, collect);
+
+    for(IndexType i = 0; i < NUM_BOXES; ++i)
+    {
+      std::sort(found[i].begin(), found[i].end());
+      EXPECT_EQ(found[i], expected_points[i]);
+    }
+    EXPECT_LE(largest_batch, std::max(batchSize, max_point_count));
+  }
+
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Tests the traversals for hierarchical approximations.
+ *
+ *  Each query approximates the bins that are far from it by their number of
+ *  boxes, found by visiting their leaves, and counts the remaining boxes
+ *  exactly. Every box must be counted once, and all the boxes close to the
+ *  query must be counted exactly.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_approximate_traversal()
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  constexpr IndexType NUM_BOXES = 300;
+  constexpr IndexType NUM_QUERY = 100;
+  constexpr FloatType NEAR_DIST = 0.5;
+  constexpr unsigned int SEED = 7;
+
+  axom::Array<BoxType> boxes(NUM_BOXES);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType lo;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      lo[d] = axom::utilities::random_real<FloatType>(-1., 1., SEED);
+    }
+    boxes[i] = BoxType(lo, lo + primal::Vector<FloatType, NDIMS>(0.1));
+  }
+
+  axom::Array<PointType> query_pts(NUM_QUERY);
+  for(IndexType i = 0; i < NUM_QUERY; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      query_pts[i][d] =
+        axom::utilities::random_real<FloatType>(-1.5, 1.5, SEED);
+    }
+  }
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  bvh.initialize(boxes.view(), NUM_BOXES);
+  const auto it = bvh.getTraverser();
+
+  // Number of boxes in each bin
+  const IndexType nbins = it.getNumBins();
+  axom::Array<IndexType> bin_counts(nbins);
+  const auto bin_counts_v = bin_counts.view();
+  axom::for_all<ExecSpace>(
+    nbins,
+    AXOM_LAMBDA(IndexType bin) {
+      IndexType count = 0;
+      it.traverse_bin_leaves(bin, [&](std::int32_t, const std::int32_t*) {
+        ++count;
+      });
+      bin_counts_v[bin] = count;
+    });
+
+  // The root bins hold all the boxes
+  EXPECT_EQ(bin_counts[0] + bin_counts[1], NUM_BOXES);
+
+  axom::Array<IndexType> totals(NUM_QUERY);
+  axom::Array<IndexType> near_counts(NUM_QUERY);
+  const auto totals_v = totals.view();
+  const auto near_counts_v = near_counts.view();
+  const auto boxes_v = boxes.view();
+  const auto query_v = query_pts.view();
+  axom::for_all<ExecSpace>(
+    NUM_QUERY,
+    AXOM_LAMBDA(IndexType i) {
+      IndexType total = 0;
+      IndexType near_count = 0;
+      auto approximate = [&](const PointType& p,
+                             const BoxType& bin_box,
+                             std::int32_t bin) -> bool {
+        if(primal::squared_distance(p, bin_box) <= NEAR_DIST * NEAR_DIST)
+        {
+          return false;
+        }
+        total += bin_counts_v[bin];
+        return true;
+      };
+      auto count_exactly = [&](std::int32_t current_node,
+                               const std::int32_t* leaf_nodes) {
+        const BoxType& box = boxes_v[leaf_nodes[current_node]];
+        ++total;
+        if(primal::squared_distance(query_v[i], box) <= NEAR_DIST * NEAR_DIST)
+        {
+          ++near_count;
+        }
+      };
+      it.traverse_approximate(query_v[i], count_exactly, approximate);
+      totals_v[i] = total;
+      near_counts_v[i] = near_count;
+    });
+
+  for(IndexType i = 0; i < NUM_QUERY; ++i)
+  {
+    IndexType expected_near = 0;
+    for(IndexType j = 0; j < NUM_BOXES; ++j)
+    {
+      if(primal::squared_distance(query_pts[i], boxes[j]) <=
+         NEAR_DIST * NEAR_DIST)
+      {
+        ++expected_near;
+      }
+    }
+    EXPECT_EQ(totals[i], NUM_BOXES);
+    EXPECT_EQ(near_counts[i], expected_near);
+  }
+
+  axom::setDefaultAllocator(current_allocator);
+}
+
 } /* end unnamed namespace */
 
 //------------------------------------------------------------------------------
@@ -1568,6 +2259,53 @@ TEST(spin_bvh, single_bbox_sequential)
   check_0_or_1_bbox_2d<axom::SEQ_EXEC, float>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_nearest_neighbors_sequential)
+{
+  check_find_nearest_neighbors<axom::SEQ_EXEC, double, 2>();
+  check_find_nearest_neighbors<axom::SEQ_EXEC, double, 3>();
+  check_find_nearest_neighbors<axom::SEQ_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_sequential)
+{
+  check_refit<axom::SEQ_EXEC, double, 2>();
+  check_refit<axom::SEQ_EXEC, double, 3>();
+  check_refit<axom::SEQ_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binned_sah_sequential)
+{
+  check_binned_sah<axom::SEQ_EXEC, double, 2>();
+  check_binned_sah<axom::SEQ_EXEC, double, 3>();
+  check_binned_sah<axom::SEQ_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binned_sah_depth_sequential)
+{
+  check_binned_sah_depth<axom::SEQ_EXEC, 2>();
+  check_binned_sah_depth<axom::SEQ_EXEC, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, batched_queries_sequential)
+{
+  check_batched_queries<axom::SEQ_EXEC, double, 2>();
+  check_batched_queries<axom::SEQ_EXEC, double, 3>();
+  check_batched_queries<axom::SEQ_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, approximate_traversal_sequential)
+{
+  check_approximate_traversal<axom::SEQ_EXEC, double, 2>();
+  check_approximate_traversal<axom::SEQ_EXEC, double, 3>();
+  check_approximate_traversal<axom::SEQ_EXEC, float, 3>();
+}
+
 //------------------------------------------------------------------------------
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
 
@@ -1646,6 +2384,53 @@ TEST(spin_bvh, single_bbox_omp)
   check_0_or_1_bbox_2d<axom::OMP_EXEC, float>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_nearest_neighbors_omp)
+{
+  check_find_nearest_neighbors<axom::OMP_EXEC, double, 2>();
+  check_find_nearest_neighbors<axom::OMP_EXEC, double, 3>();
+  check_find_nearest_neighbors<axom::OMP_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_omp)
+{
+  check_refit<axom::OMP_EXEC, double, 2>();
+  check_refit<axom::OMP_EXEC, double, 3>();
+  check_refit<axom::OMP_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binned_sah_omp)
+{
+  check_binned_sah<axom::OMP_EXEC, double, 2>();
+  check_binned_sah<axom::OMP_EXEC, double, 3>();
+  check_binned_sah<axom::OMP_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, binned_sah_depth_omp)
+{
+  check_binned_sah_depth<axom::OMP_EXEC, 2>();
+  check_binned_sah_depth<axom::OMP_EXEC, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, batched_queries_omp)
+{
+  check_batched_queries<axom::OMP_EXEC, double, 2>();
+  check_batched_queries<axom::OMP_EXEC, double, 3>();
+  check_batched_queries<axom::OMP_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, approximate_traversal_omp)
+{
+  check_approximate_traversal<axom::OMP_EXEC, double, 2>();
+  check_approximate_traversal<axom::OMP_EXEC, double, 3>();
+  check_approximate_traversal<axom::OMP_EXEC, float, 3>();
+}
+
 #endif
 
 //------------------------------------------------------------------------------